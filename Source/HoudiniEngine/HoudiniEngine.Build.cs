@@ -337,7 +337,8 @@ public class HoudiniEngine : ModuleRules
              {
                 "Landscape",
                 "PhysicsCore",
-                "PhysicsUtilities"
+                "PhysicsUtilities",
+                "Sockets"
              }
         );
 
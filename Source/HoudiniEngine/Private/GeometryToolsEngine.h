@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 
 #include <algorithm>
 #include <array>
@@ -5667,7 +5668,10 @@ void ConvexHull3<InputType, ComputeType>::Update(int i)
 
     unsigned int numFaces = static_cast<unsigned int>(mHullUnordered.size());
     std::vector<int> queryResult(numFaces);
-    if (mNumThreads > 1 && numFaces >= mNumThreads)
+    // This runs for every inserted point: only split the queries in tasks
+    // when each task has enough faces to process to outweigh the scheduling.
+    unsigned int const minFacesPerThread = 256;
+    if (mNumThreads > 1 && numFaces >= mNumThreads * minFacesPerThread)
     {
         // Partition the data for multiple threads.
         unsigned int numFacesPerThread = numFaces / mNumThreads;
@@ -5679,26 +5683,17 @@ void ConvexHull3<InputType, ComputeType>::Update(int i)
         }
         jmax[mNumThreads - 1] = numFaces - 1;
 
-        // Execute the point-plane queries in multiple threads.
-        std::vector<std::thread> process(mNumThreads);
-        for (unsigned int t = 0; t < mNumThreads; ++t)
+        // Execute the point-plane queries in multiple tasks.
+        // (uses the task graph instead of spawning a thread per partition)
+        ParallelFor(static_cast<int32>(mNumThreads), [this, i, &jmin, &jmax,
+            &queryResult](int32 t)
         {
-            process[t] = std::thread([this, i, t, &jmin, &jmax, 
-                &queryResult]()
+            for (unsigned int j = jmin[t]; j <= jmax[t]; ++j)
             {
-                for (unsigned int j = jmin[t]; j <= jmax[t]; ++j)
-                {
-                    TriangleKey<true> const& tri = mHullUnordered[j];
-                    queryResult[j] = mQuery.ToPlane(i, tri.V[0], tri.V[1], tri.V[2]);
-                }
-            });
-        }
-
-        // Wait for all threads to finish.
-        for (unsigned int t = 0; t < mNumThreads; ++t)
-        {
-            process[t].join();
-        }
+                TriangleKey<true> const& tri = mHullUnordered[j];
+                queryResult[j] = mQuery.ToPlane(i, tri.V[0], tri.V[1], tri.V[2]);
+            }
+        });
     }
     else
     {
@@ -7831,7 +7826,7 @@ OrientedBox3<InputType> MinimumVolumeBox3<InputType, ComputeType>::operator()(
     mUniqueIndices.clear();
 
     // Get the convex hull of the points.
-    ConvexHull3<InputType, ComputeType> ch3;
+    ConvexHull3<InputType, ComputeType> ch3(mNumThreads);
     ch3(mNumPoints, mPoints, (InputType)0);
     int dimension = ch3.GetDimension();
 
@@ -7951,12 +7946,18 @@ OrientedBox3<InputType> MinimumVolumeBox3<InputType, ComputeType>::operator()(
 
     if (mThreadProcessEdges)
     {
-        std::thread doEdges([this, &mesh, &minBoxEdges]()
+        // Process the edges and the faces in two tasks.
+        ParallelFor(2, [this, &mesh, &minBox, &minBoxEdges](int32 task)
         {
-            ProcessEdges(mesh, minBoxEdges);
+            if (task == 0)
+            {
+                ProcessEdges(mesh, minBoxEdges);
+            }
+            else
+            {
+                ProcessFaces(mesh, minBox);
+            }
         });
-        ProcessFaces(mesh, minBox);
-        doEdges.join();
     }
     else
     {
@@ -8030,12 +8031,18 @@ OrientedBox3<InputType> MinimumVolumeBox3<InputType, ComputeType>::operator()(
 
     if (mThreadProcessEdges)
     {
-        std::thread doEdges([this, &mesh, &minBoxEdges]()
+        // Process the edges and the faces in two tasks.
+        ParallelFor(2, [this, &mesh, &minBox, &minBoxEdges](int32 task)
         {
-            ProcessEdges(mesh, minBoxEdges);
+            if (task == 0)
+            {
+                ProcessEdges(mesh, minBoxEdges);
+            }
+            else
+            {
+                ProcessFaces(mesh, minBox);
+            }
         });
-        ProcessFaces(mesh, minBox);
-        doEdges.join();
     }
     else
     {
@@ -8139,26 +8146,21 @@ void MinimumVolumeBox3<InputType, ComputeType>::ProcessFaces(ETManifoldMesh cons
         }
         imax[mNumThreads - 1] = numFaces - 1;
 
-        // Execute the face processing in multiple threads.
-        std::vector<std::thread> process(mNumThreads);
-        for (unsigned int t = 0; t < mNumThreads; ++t)
+        // Execute the face processing in multiple tasks.
+        // (uses the task graph instead of spawning a thread per partition)
+        ParallelFor(static_cast<int32>(mNumThreads), [this, &imin, &imax, &triangles,
+            &normal, &triNormalMap, &emap, &localMinBox](int32 t)
         {
-            process[t] = std::thread([this, t, &imin, &imax, &triangles,
-                &normal, &triNormalMap, &emap, &localMinBox]()
+            for (unsigned int i = imin[t]; i <= imax[t]; ++i)
             {
-                for (unsigned int i = imin[t]; i <= imax[t]; ++i)
-                {
-                    auto const& supportTri = triangles[i];
-                    ProcessFace(supportTri, normal, triNormalMap, emap, localMinBox[t]);
-                }
-            });
-        }
+                auto const& supportTri = triangles[i];
+                ProcessFace(supportTri, normal, triNormalMap, emap, localMinBox[t]);
+            }
+        });
 
-        // Wait for all threads to finish.
+        // Gather the results of all tasks.
         for (unsigned int t = 0; t < mNumThreads; ++t)
         {
-            process[t].join();
-
             // Update the minimum-volume box candidate.
             if (minBox.volume == mNegOne || localMinBox[t].volume < minBox.volume)
             {
@@ -33,11 +33,13 @@
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniEngineManager.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputManagerImpl.h"
@@ -70,6 +72,8 @@ FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
 	, HoudiniEngineSchedulerThread(nullptr)
 	, HoudiniEngineScheduler(nullptr)
+	, SessionPool(nullptr)
+	, bSessionWarmUpInProgress(false)
 	, HoudiniEngineManagerThread(nullptr)
 	, HoudiniEngineManager(nullptr)
 	//, bHAPIVersionMismatch(false)
@@ -205,10 +209,13 @@ FHoudiniEngine::StartupModule()
 	bFirstSessionCreated = false;
 
 	// Create HAPI scheduler and processing thread.
-	HoudiniEngineScheduler = new FHoudiniEngineScheduler();
+	HoudiniEngineScheduler = new FHoudiniEngineScheduler(0);
 	HoudiniEngineSchedulerThread = FRunnableThread::Create(
 		HoudiniEngineScheduler, TEXT("HoudiniSchedulerThread"), 0, TPri_Normal);
 
+	// Create the session pool, its sessions are only started along with the main session
+	SessionPool = new FHoudiniEngineSessionPool();
+
 	// Create Houdini Asset Manager
 	HoudiniEngineManager = new FHoudiniEngineManager();
 
@@ -243,6 +250,11 @@ FHoudiniEngine::StartupModule()
 				FHoudiniEngineManager* const Manager = HEngine.GetHoudiniEngineManager();
 				if (Manager)
 					Manager->StartHoudiniTicking();
+
+				// Start the session in the background so it's ready when the first HDA is used
+				const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+				if (GIsEditor && !IsRunningCommandlet() && HoudiniRuntimeSettings && HoudiniRuntimeSettings->bWarmUpSessionOnEditorStart)
+					HEngine.StartSessionWarmUp();
 			});
 		}
 	}
@@ -306,6 +318,14 @@ FHoudiniEngine::ShutdownModule()
 	// Destroy the Unreal Object Input manager
 	FUnrealObjectInputManager::DestroySingleton();
 
+	// Stop the pool sessions and their schedulers
+	if (SessionPool)
+	{
+		SessionPool->StopSessions();
+		delete SessionPool;
+		SessionPool = nullptr;
+	}
+
 	// Do scheduler and thread clean up.
 	if (HoudiniEngineScheduler)
 		HoudiniEngineScheduler->Stop();
@@ -351,8 +371,23 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
+	if (InTask.SessionIndex > 0)
+	{
+		// Tasks for pool sessions are processed by that session's scheduler
+		if (!SessionPool || !SessionPool->AddTask(InTask.SessionIndex, InTask))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Unable to add task for %s: invalid session %d."), *InTask.ActorName, InTask.SessionIndex);
+
+			FHoudiniEngineTaskInfo TaskInfo(
+				HAPI_RESULT_INVALID_SESSION, InTask.AssetId, InTask.TaskType, EHoudiniEngineTaskState::FinishedWithFatalError);
+			AddTaskInfo(InTask.HapiGUID, TaskInfo);
+			return;
+		}
+	}
+	else if ( HoudiniEngineScheduler )
+	{
 		HoudiniEngineScheduler->AddTask(InTask);
+	}
 
 	FScopeLock ScopeLock(&CriticalSection);
 	FHoudiniEngineTaskInfo TaskInfo;
@@ -362,6 +397,20 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+void
+FHoudiniEngine::CancelTask(const FGuid& InHapiGUID, const int32& InSessionIndex)
+{
+	if (InSessionIndex > 0)
+	{
+		if (SessionPool)
+			SessionPool->CancelTask(InSessionIndex, InHapiGUID);
+	}
+	else if (HoudiniEngineScheduler)
+	{
+		HoudiniEngineScheduler->CancelTask(InHapiGUID);
+	}
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -443,6 +492,11 @@ FHoudiniEngine::GetHoudiniExecutable()
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
+	// Use the session of the session pool the calling thread is currently working with
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	if (SessionIndex > 0)
+		return SessionPool ? SessionPool->GetSession(SessionIndex) : nullptr;
+
 	return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
 }
 
@@ -601,6 +655,84 @@ FHoudiniEngine::GetDefaultCookOptions()
 	return CookOptions;
 }
 
+void
+FHoudiniEngine::UpdatePathForServer() const
+{
+	// Get the existing PATH env var
+	FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
+	// Make sure we only extend the PATH once!
+	if (OrigPathVar.Contains(LibHAPILocation))
+		return;
+
+	// Modify our PATH so that HARC will find HARS.exe
+	const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
+	FString ModifiedPath =
+#if PLATFORM_MAC
+		// On Mac our binaries are split between two folders
+		LibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
+#endif
+		LibHAPILocation + PathDelimiter + OrigPathVar;
+
+	FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
+}
+
+HAPI_Result
+FHoudiniEngine::ConnectThriftSession(
+	HAPI_Session* SessionPtr,
+	const bool& bStartAutomaticServer,
+	const float& AutomaticServerTimeout,
+	const EHoudiniRuntimeSettingsSessionType& SessionType,
+	const FString& ServerPipeName,
+	const int32& ServerPort,
+	const FString& ServerHost,
+	bool& bOutStartedServer)
+{
+	bOutStartedServer = false;
+
+	HAPI_ThriftServerOptions ServerOptions;
+	FMemory::Memzero< HAPI_ThriftServerOptions >(ServerOptions);
+	ServerOptions.autoClose = true;
+	ServerOptions.timeoutMs = AutomaticServerTimeout;
+
+	HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
+	if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_Socket)
+	{
+		// Try to connect to an existing socket session first
+		SessionResult = FHoudiniApi::CreateThriftSocketSession(
+			SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort);
+
+		// Start a session and try to connect to it if we failed
+		if (bStartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
+		{
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::StartThriftSocketServer(&ServerOptions, ServerPort, nullptr, nullptr))
+				return HAPI_RESULT_FAILURE;
+
+			bOutStartedServer = true;
+			SessionResult = FHoudiniApi::CreateThriftSocketSession(
+				SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort);
+		}
+	}
+	else if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+	{
+		// Try to connect to an existing pipe session first
+		SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+			SessionPtr, TCHAR_TO_UTF8(*ServerPipeName));
+
+		// Start a session and try to connect to it if we failed
+		if (bStartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
+		{
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::StartThriftNamedPipeServer(&ServerOptions, TCHAR_TO_UTF8(*ServerPipeName), nullptr, nullptr))
+				return HAPI_RESULT_FAILURE;
+
+			bOutStartedServer = true;
+			SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+				SessionPtr, TCHAR_TO_UTF8(*ServerPipeName));
+		}
+	}
+
+	return SessionResult;
+}
+
 bool
 FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	const bool& StartAutomaticServer,
@@ -627,36 +759,10 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 
 	HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
 
-	HAPI_ThriftServerOptions ServerOptions;
-	FMemory::Memzero< HAPI_ThriftServerOptions >(ServerOptions);
-	ServerOptions.autoClose = true;
-	ServerOptions.timeoutMs = AutomaticServerTimeout;
-
 	// Unless we automatically start the server,
 	// consider we're in SessionSync mode
 	bEnableSessionSync = true;
 
-	auto UpdatePathForServer = [&]
-	{
-		// Get the existing PATH env var
-		FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
-		// Make sure we only extend the PATH once!
-		if (OrigPathVar.Contains(LibHAPILocation))
-			return;
-
-		// Modify our PATH so that HARC will find HARS.exe
-		const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-		FString ModifiedPath =
-#if PLATFORM_MAC
-			// On Mac our binaries are split between two folders
-			LibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
-#endif
-			LibHAPILocation + PathDelimiter + OrigPathVar;
-
-		FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
-	};
-
-
 	// Clear the connection error before starting a new session
 	if(SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_None)
 		FHoudiniApi::ClearConnectionError();
@@ -664,46 +770,19 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	switch (SessionType)
 	{
 		case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
-		{
-			// Try to connect to an existing socket session first
-			SessionResult = FHoudiniApi::CreateThriftSocketSession(
-				SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort );
-
-			// Start a session and try to connect to it if we failed
-			if ( StartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS )
-			{
-				UpdatePathForServer();
-				FHoudiniApi::StartThriftSocketServer(
-					&ServerOptions, ServerPort, nullptr, nullptr);
-
-				// We've started the server manually, disable session sync
-				bEnableSessionSync = false;
-
-				SessionResult = FHoudiniApi::CreateThriftSocketSession(
-					SessionPtr, TCHAR_TO_UTF8(*ServerHost), ServerPort);
-			}
-		}
-		break;
-
 		case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
 		{
-			// Try to connect to an existing pipe session first
-			SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-				SessionPtr, TCHAR_TO_UTF8(*ServerPipeName) );
-
-			// Start a session and try to connect to it if we failed
-			if (StartAutomaticServer && SessionResult != HAPI_RESULT_SUCCESS)
-			{
+			if (StartAutomaticServer)
 				UpdatePathForServer();
-				FHoudiniApi::StartThriftNamedPipeServer(
-					&ServerOptions, TCHAR_TO_UTF8(*ServerPipeName), nullptr, nullptr);
 
-				// We've started the server manually, disable session sync
-				bEnableSessionSync = false;
+			// Try to connect to an existing session first, start a server and connect to it if that fails
+			bool bStartedServer = false;
+			SessionResult = ConnectThriftSession(
+				SessionPtr, StartAutomaticServer, AutomaticServerTimeout, SessionType, ServerPipeName, ServerPort, ServerHost, bStartedServer);
 
-				SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-					SessionPtr, TCHAR_TO_UTF8(*ServerPipeName));
-			}
+			// We've started the server manually, disable session sync
+			if (bStartedServer)
+				bEnableSessionSync = false;
 		}
 		break;
 
@@ -835,10 +914,12 @@ FHoudiniEngine::SessionSyncConnect(
 }
 
 bool
-FHoudiniEngine::InitializeHAPISession()
+FHoudiniEngine::InitializeHAPISession(HAPI_Session* InSession)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngine::InitializeHAPISession);
 
+	HAPI_Session* SessionPtr = InSession ? InSession : &Session;
+
 	// The HAPI stubs needs to be initialized
 	if (!FHoudiniApi::IsHAPIInitialized())
 	{
@@ -847,7 +928,7 @@ FHoudiniEngine::InitializeHAPISession()
 	}
 
 	// We need a Valid Session
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(GetSession()))
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(SessionPtr))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to initialize HAPI: The session is invalid."));
 		return false;
@@ -903,7 +984,7 @@ FHoudiniEngine::InitializeHAPISession()
 
 	bool bUseCookingThread = true;
 	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
+		SessionPtr,
 		&CookOptions,
 		bUseCookingThread,
 		HoudiniRuntimeSettings->CookingThreadStackSize,
@@ -932,9 +1013,10 @@ FHoudiniEngine::InitializeHAPISession()
 	}
 
 	// Let HAPI know we are running inside UE4
-	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+	FHoudiniApi::SetServerEnvString(SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
 
-	if (bEnableSessionSync)
+	// The session sync infos of a warm up session are set once it becomes the main session
+	if (bEnableSessionSync && SessionPtr == &Session)
 	{
 		// Set the session sync infos if needed
 		UploadSessionSyncInfoToHoudini();
@@ -956,6 +1038,8 @@ FHoudiniEngine::OnSessionLost()
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
+	AssetLibraryCache.Empty();
+	AttributeCatalog.Empty();
 
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -981,6 +1065,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	if (!FHoudiniApi::IsHAPIInitialized())
 		return false;
 
+	// The pool sessions can't outlive the main session
+	StopSessionPool();
+
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(SessionPtr))
 	{
 		// SessionPtr is valid, clean up and close the session
@@ -992,6 +1079,12 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
 	bEnableSessionSync = false;
+	AssetLibraryCache.Empty();
+	AttributeCatalog.Empty();
+
+	// A cook the scheduler is waiting on can't complete anymore, have it poll the cook state now
+	if (HoudiniEngineScheduler)
+		HoudiniEngineScheduler->WakeUpCookWait();
 
 	HoudiniEngineManager->StopHoudiniTicking();
 
@@ -1048,6 +1141,7 @@ FHoudiniEngine::RestartSession()
 	// Start ticking only if we successfully started the session
 	if (bSuccess)
 	{
+		StartSessionPool();
 		StartTicking();
 		return true;
 	}
@@ -1101,6 +1195,7 @@ FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionT
 	// Start ticking only if we successfully started the session
 	if (bSuccess)
 	{
+		StartSessionPool();
 		StartTicking();
 		return true;
 	}
@@ -1154,6 +1249,7 @@ FHoudiniEngine::ConnectSession(const EHoudiniRuntimeSettingsSessionType& Session
 	// Start ticking only if we successfully started the session
 	if (bSuccess)
 	{
+		StartSessionPool();
 		StartTicking();
 		return true;
 	}
@@ -1164,6 +1260,216 @@ FHoudiniEngine::ConnectSession(const EHoudiniRuntimeSettingsSessionType& Session
 	}
 }
 
+void
+FHoudiniEngine::StartSessionPool()
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (!SessionPool || !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bEnableSessionPool)
+		return;
+
+	// Session sync relies on the user's Houdini session, don't spread the HDAs across other sessions
+	if (bEnableSessionSync)
+		return;
+
+	const int32 NumPoolSessions = HoudiniRuntimeSettings->SessionPoolSize - 1 - SessionPool->GetNumPoolSessions();
+	if (NumPoolSessions <= 0)
+		return;
+
+	FString StatusText = FString::Printf(TEXT("Starting %d additional Houdini Engine sessions..."), NumPoolSessions);
+	FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
+
+	SessionPool->StartSessions(
+		NumPoolSessions,
+		HoudiniRuntimeSettings->SessionType,
+		HoudiniRuntimeSettings->ServerPipeName,
+		HoudiniRuntimeSettings->ServerPort,
+		HoudiniRuntimeSettings->ServerHost,
+		HoudiniRuntimeSettings->AutomaticServerTimeout);
+}
+
+void
+FHoudiniEngine::StopSessionPool()
+{
+	if (SessionPool)
+	{
+		for (int32 SessionIndex = 1; SessionIndex <= SessionPool->GetNumPoolSessions(); SessionIndex++)
+		{
+			AssetLibraryCache.Empty(SessionIndex);
+			AttributeCatalog.Empty(SessionIndex);
+		}
+
+		SessionPool->StopSessions();
+	}
+}
+
+void
+FHoudiniEngine::StartSessionWarmUp()
+{
+	if (bSessionWarmUpInProgress || !FHoudiniApi::IsHAPIInitialized())
+		return;
+
+	// Nothing to do if a session has already been started
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session))
+		return;
+
+	// Only out of process sessions can be connected to in the background
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings
+		|| (HoudiniRuntimeSettings->SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+			&& HoudiniRuntimeSettings->SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe))
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("Starting the Houdini Engine warm up session..."));
+
+	// Prevent the manager from starting the session on its own while we're starting it
+	bSessionWarmUpInProgress = true;
+	SetFirstSessionCreated(true);
+
+	// Only the server launch and connection run on a worker thread, the session is initialized and
+	// the engine's state updated on the game thread once it is connected
+	const bool bStartAutomaticServer = HoudiniRuntimeSettings->bStartAutomaticServer;
+	const float AutomaticServerTimeout = HoudiniRuntimeSettings->AutomaticServerTimeout;
+	const EHoudiniRuntimeSettingsSessionType SessionType = HoudiniRuntimeSettings->SessionType;
+	const FString ServerPipeName = HoudiniRuntimeSettings->ServerPipeName;
+	const int32 ServerPort = HoudiniRuntimeSettings->ServerPort;
+	const FString ServerHost = HoudiniRuntimeSettings->ServerHost;
+
+	// Set the environment HARS needs before it is started
+	FPlatformMisc::SetEnvironmentVar(TEXT("HAPI_CLIENT_NAME"), TEXT("unreal"));
+	FHoudiniEngineRuntimeUtils::SetHoudiniHomeEnvironmentVariable();
+	if (bStartAutomaticServer)
+		UpdatePathForServer();
+
+	FHoudiniApi::ClearConnectionError();
+
+	Async(EAsyncExecution::Thread, [bStartAutomaticServer, AutomaticServerTimeout, SessionType, ServerPipeName, ServerPort, ServerHost]()
+	{
+		// Connect in a separate session, it only replaces the main session once ready
+		HAPI_Session WarmUpSession;
+		WarmUpSession.type = HAPI_SESSION_MAX;
+		WarmUpSession.id = -1;
+
+		bool bStartedServer = false;
+		const HAPI_Result Result = ConnectThriftSession(
+			&WarmUpSession, bStartAutomaticServer, AutomaticServerTimeout, SessionType, ServerPipeName, ServerPort, ServerHost, bStartedServer);
+		const bool bConnected = Result == HAPI_RESULT_SUCCESS;
+
+		AsyncTask(ENamedThreads::GameThread, [WarmUpSession, bConnected, bStartedServer]()
+		{
+			if (FHoudiniEngine::HoudiniEngineInstance)
+				FHoudiniEngine::Get().FinishSessionWarmUp(WarmUpSession, bConnected, bStartedServer);
+		});
+	});
+}
+
+void
+FHoudiniEngine::FinishSessionWarmUp(const HAPI_Session& InSession, const bool& bInConnected, const bool& bInStartedServer)
+{
+	bSessionWarmUpInProgress = false;
+
+	if (!bInConnected)
+	{
+		// Let the first Houdini Asset start the session as usual
+		FString ConnectionError = FHoudiniEngineUtils::GetConnectionError();
+		HOUDINI_LOG_WARNING(TEXT("Failed to start the Houdini Engine warm up session - %s"), *ConnectionError);
+		SetFirstSessionCreated(false);
+		return;
+	}
+
+	HAPI_Session WarmUpSession = InSession;
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&Session))
+	{
+		// A session was started manually in the meantime, we don't need this one
+		FHoudiniApi::CloseSession(&WarmUpSession);
+		return;
+	}
+
+	if (!InitializeHAPISession(&WarmUpSession))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to initialize the Houdini Engine warm up session."));
+		FHoudiniApi::CloseSession(&WarmUpSession);
+		SetFirstSessionCreated(false);
+		return;
+	}
+
+	// Same as StartSession(): session sync is only used with servers we didn't start
+	bEnableSessionSync = !bInStartedServer;
+	HOUDINI_CHECK_ERROR(FHoudiniApi::GetSessionEnvInt(
+		&WarmUpSession, HAPI_SESSIONENVINT_LICENSE, (int32 *)&LicenseType));
+
+	Session = WarmUpSession;
+	SetSessionStatus(EHoudiniSessionStatus::Connected);
+
+	if (bEnableSessionSync)
+	{
+		UploadSessionSyncInfoToHoudini();
+		HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Session Sync enabled."));
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine warm up session started."));
+
+	StartSessionPool();
+	StartTicking();
+
+	PreloadAssetLibraries();
+}
+
+void
+FHoudiniEngine::PreloadAssetLibraries()
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings)
+		return;
+
+	// The HDAs listed in the settings come first, in order, as other HDAs can depend on them
+	TArray<UHoudiniAsset*> HoudiniAssets;
+	for (const TSoftObjectPtr<UHoudiniAsset>& SoftAsset : HoudiniRuntimeSettings->WarmUpHoudiniAssets)
+	{
+		UHoudiniAsset* HoudiniAsset = SoftAsset.LoadSynchronous();
+		if (IsValid(HoudiniAsset))
+			HoudiniAssets.AddUnique(HoudiniAsset);
+	}
+
+	// Then the HDAs used in the level
+	if (HoudiniRuntimeSettings->bWarmUpLevelHoudiniAssets && FHoudiniEngineRuntime::IsInitialized())
+	{
+		FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+		for (int32 Idx = 0; Idx < Runtime.GetRegisteredHoudiniComponentCount(); Idx++)
+		{
+			UHoudiniAssetComponent* HAC = Runtime.GetRegisteredHoudiniComponentAt(Idx);
+			UHoudiniAsset* HoudiniAsset = IsValid(HAC) ? HAC->GetHoudiniAsset() : nullptr;
+			if (IsValid(HoudiniAsset))
+				HoudiniAssets.AddUnique(HoudiniAsset);
+		}
+	}
+
+	if (HoudiniAssets.Num() <= 0)
+		return;
+
+	const int32 NumSessions = 1 + (SessionPool ? SessionPool->GetNumPoolSessions() : 0);
+	HOUDINI_LOG_MESSAGE(TEXT("Preloading %d HDA libraries in %d session(s)..."), HoudiniAssets.Num(), NumSessions);
+
+	// Each session's libraries are loaded by that session's scheduler, so the loads
+	// are serialized with the other HAPI calls made in that session
+	for (int32 SessionIndex = 0; SessionIndex < NumSessions; SessionIndex++)
+	{
+		for (UHoudiniAsset* HoudiniAsset : HoudiniAssets)
+		{
+			FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetLibraryLoad, FGuid::NewGuid());
+			Task.Asset = HoudiniAsset;
+			Task.ActorName = HoudiniAsset->GetName();
+			Task.SessionIndex = SessionIndex;
+			AddTask(Task);
+		}
+	}
+}
+
+bool
+FHoudiniEngine::IsSessionPoolEnabled() const
+{
+	return SessionPool && SessionPool->GetNumPoolSessions() > 0;
+}
+
 void
 FHoudiniEngine::StartTicking()
 {
@@ -27,6 +27,8 @@
 #pragma once
 
 #include "HAPI/HAPI_Common.h"
+#include "HoudiniEngineAssetLibraryCache.h"
+#include "HoudiniEngineAttributeCatalog.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniRuntimeSettings.h"
@@ -36,6 +38,7 @@
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 class FHoudiniEngineManager;
+class FHoudiniEngineSessionPool;
 class UHoudiniAssetComponent;
 class UStaticMesh;
 class UMaterial;
@@ -80,6 +83,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		static const FString GetHoudiniExecutable();
 
 		// Session accessor
+		// Returns the session used by the calling thread: the main session, 
+		// or one of the session pool's sessions (see FHoudiniEngineScopedSession).
 		virtual const HAPI_Session* GetSession() const;
 
 		virtual const EHoudiniSessionStatus& GetSessionStatus() const;
@@ -120,6 +125,26 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Connect to an existing HE session
 		bool ConnectSession(const EHoudiniRuntimeSettingsSessionType& SessionType);
 
+		// Starts the additional sessions of the session pool, if enabled in the settings
+		void StartSessionPool();
+		// Stops the additional sessions of the session pool
+		void StopSessionPool();
+		// Indicates if additional sessions are currently available
+		bool IsSessionPoolEnabled() const;
+
+		FHoudiniEngineSessionPool* GetSessionPool() { return SessionPool; }
+
+		// Starts the session in the background, then preloads the libraries of the warm up HDAs in it
+		void StartSessionWarmUp();
+		// Indicates that the warm up session is currently being started
+		bool IsSessionWarmUpInProgress() const { return bSessionWarmUpInProgress; }
+
+		// Library ids of the HDAs loaded in the sessions
+		FHoudiniEngineAssetLibraryCache& GetAssetLibraryCache() { return AssetLibraryCache; }
+
+		// Attribute catalogs of the parts of the geo nodes being translated
+		FHoudiniEngineAttributeCatalog& GetAttributeCatalog() { return AttributeCatalog; }
+
 		// Starts the HoudiniEngineManager ticking
 		void StartTicking();
 		// Stops the HoudiniEngineManager ticking and invalidate the session
@@ -127,8 +152,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		bool IsTicking() const;
 
-		// Initialize HAPI
-		bool InitializeHAPISession();
+		// Initialize HAPI, on the main session if InSession is null
+		bool InitializeHAPISession(HAPI_Session* InSession = nullptr);
 
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
@@ -152,6 +177,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Cancel a task, interrupting it if it is currently cooking.
+		virtual void CancelTask(const FGuid& InHapiGUID, const int32& InSessionIndex);
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
@@ -248,6 +275,27 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 	private:
 
+		// Called on the game thread once the warm up session is connected, initializes it and makes it the main session
+		void FinishSessionWarmUp(const HAPI_Session& InSession, const bool& bInConnected, const bool& bInStartedServer);
+
+		// Adds the HAPI library folder to the PATH, so HARC can find HARS
+		void UpdatePathForServer() const;
+
+		// Connects a socket or named pipe session, starting a server first if allowed and needed.
+		// Doesn't modify the engine's state, so it can be called from any thread.
+		static HAPI_Result ConnectThriftSession(
+			HAPI_Session* SessionPtr,
+			const bool& bStartAutomaticServer,
+			const float& AutomaticServerTimeout,
+			const EHoudiniRuntimeSettingsSessionType& SessionType,
+			const FString& ServerPipeName,
+			const int32& ServerPort,
+			const FString& ServerHost,
+			bool& bOutStartedServer);
+
+		// Loads the libraries of the warm up HDAs in all sessions, from a worker thread
+		void PreloadAssetLibraries();
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -274,6 +322,18 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
 		FHoudiniEngineScheduler * HoudiniEngineScheduler;
 
+		// Additional sessions used to cook HDAs in parallel.
+		FHoudiniEngineSessionPool * SessionPool;
+
+		// Library ids of the HDAs loaded in each session
+		FHoudiniEngineAssetLibraryCache AssetLibraryCache;
+
+		// Attribute catalogs of the geo nodes in each session
+		FHoudiniEngineAttributeCatalog AttributeCatalog;
+
+		// Indicates that the session is being started in the background
+		bool bSessionWarmUpInProgress;
+
 		// Thread used to execute the manager.
 		FRunnableThread * HoudiniEngineManagerThread;
 		// Scheduler used to monitor and process Houdini Asset Components
@@ -0,0 +1,147 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineAssetLibraryCache.h"
+
+#include "HoudiniAsset.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+
+FString
+FHoudiniEngineAssetLibraryCache::GetLibraryKey(const UHoudiniAsset* InHoudiniAsset, const bool& bInFromFile)
+{
+	if (!IsValid(InHoudiniAsset))
+		return FString();
+
+	if (!bInFromFile)
+	{
+		const FString& AssetBytesHash = InHoudiniAsset->GetAssetBytesHash();
+		return AssetBytesHash.IsEmpty() ? FString() : TEXT("Memory:") + AssetBytesHash;
+	}
+
+	const FString AssetFileName = FHoudiniEngineUtils::GetHoudiniAssetFilePath(InHoudiniAsset);
+	if (AssetFileName.IsEmpty())
+		return FString();
+
+	// The file's modification time changes the key, modified HDAs are reloaded
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*AssetFileName);
+	return FString::Printf(TEXT("File:%s:%lld"), *AssetFileName, TimeStamp.GetTicks());
+}
+
+HAPI_AssetLibraryId
+FHoudiniEngineAssetLibraryCache::FindLibrary(const int32& InSessionIndex, const FString& InLibraryKey) const
+{
+	if (InLibraryKey.IsEmpty())
+		return -1;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	const TMap<FString, FCachedLibrary>* Libraries = SessionLibraries.Find(InSessionIndex);
+	const FCachedLibrary* FoundLibrary = Libraries ? Libraries->Find(InLibraryKey) : nullptr;
+	return FoundLibrary ? FoundLibrary->LibraryId : -1;
+}
+
+void
+FHoudiniEngineAssetLibraryCache::AddLibrary(const int32& InSessionIndex, const FString& InLibraryKey, const HAPI_AssetLibraryId& InLibraryId)
+{
+	if (InLibraryKey.IsEmpty() || InLibraryId < 0)
+		return;
+
+	FCachedLibrary CachedLibrary;
+	CachedLibrary.LibraryId = InLibraryId;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	SessionLibraries.FindOrAdd(InSessionIndex).Add(InLibraryKey, CachedLibrary);
+}
+
+bool
+FHoudiniEngineAssetLibraryCache::FindSubAssetNames(const int32& InSessionIndex, const HAPI_AssetLibraryId& InLibraryId, TArray<HAPI_StringHandle>& OutAssetNames) const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	const TMap<FString, FCachedLibrary>* Libraries = SessionLibraries.Find(InSessionIndex);
+	if (!Libraries)
+		return false;
+
+	for (const auto& Entry : *Libraries)
+	{
+		if (Entry.Value.LibraryId != InLibraryId || Entry.Value.SubAssetNames.Num() <= 0)
+			continue;
+
+		OutAssetNames = Entry.Value.SubAssetNames;
+		return true;
+	}
+
+	return false;
+}
+
+void
+FHoudiniEngineAssetLibraryCache::AddSubAssetNames(const int32& InSessionIndex, const HAPI_AssetLibraryId& InLibraryId, const TArray<HAPI_StringHandle>& InAssetNames)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	TMap<FString, FCachedLibrary>* Libraries = SessionLibraries.Find(InSessionIndex);
+	if (!Libraries)
+		return;
+
+	// Different keys can share the same library if their content was identical
+	for (auto& Entry : *Libraries)
+	{
+		if (Entry.Value.LibraryId == InLibraryId)
+			Entry.Value.SubAssetNames = InAssetNames;
+	}
+}
+
+void
+FHoudiniEngineAssetLibraryCache::RemoveAsset(const UHoudiniAsset* InHoudiniAsset)
+{
+	const FString FileKey = GetLibraryKey(InHoudiniAsset, true);
+	const FString MemoryKey = GetLibraryKey(InHoudiniAsset, false);
+
+	FScopeLock ScopeLock(&CriticalSection);
+	for (auto& Entry : SessionLibraries)
+	{
+		Entry.Value.Remove(FileKey);
+		Entry.Value.Remove(MemoryKey);
+	}
+}
+
+void
+FHoudiniEngineAssetLibraryCache::Empty(const int32& InSessionIndex)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	if (InSessionIndex == INDEX_NONE)
+		SessionLibraries.Empty();
+	else
+		SessionLibraries.Remove(InSessionIndex);
+}
+
+int32
+FHoudiniEngineAssetLibraryCache::Num(const int32& InSessionIndex) const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	const TMap<FString, FCachedLibrary>* Libraries = SessionLibraries.Find(InSessionIndex);
+	return Libraries ? Libraries->Num() : 0;
+}
@@ -0,0 +1,85 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "HAL/CriticalSection.h"
+
+class UHoudiniAsset;
+
+// Library ids of the HDAs loaded in each Houdini Engine session.
+// Loading an HDA library is expensive (the whole HDA is sent to the session), so once a library has been loaded 
+// in a session, following instantiations of any asset with the same content in that session reuse its id.
+// Libraries are identified by a key describing their content: the hash of the HDA data when loaded from memory,
+// or the HDA file path and modification time when loaded from file.
+class HOUDINIENGINE_API FHoudiniEngineAssetLibraryCache
+{
+	public:
+
+		// Returns the key identifying the content of the library loaded for an asset, from its source file or its memory copy.
+		// Returns an empty string if the asset has no content to load from that source.
+		static FString GetLibraryKey(const UHoudiniAsset* InHoudiniAsset, const bool& bInFromFile);
+
+		// Returns the library id for the key in the given session, or -1 if it needs to be loaded.
+		HAPI_AssetLibraryId FindLibrary(const int32& InSessionIndex, const FString& InLibraryKey) const;
+
+		// Stores the library id for the key in the given session.
+		void AddLibrary(const int32& InSessionIndex, const FString& InLibraryKey, const HAPI_AssetLibraryId& InLibraryId);
+
+		// Returns the cached sub-asset names of a library loaded in the given session.
+		bool FindSubAssetNames(const int32& InSessionIndex, const HAPI_AssetLibraryId& InLibraryId, TArray<HAPI_StringHandle>& OutAssetNames) const;
+
+		// Stores the sub-asset names of a library loaded in the given session.
+		void AddSubAssetNames(const int32& InSessionIndex, const HAPI_AssetLibraryId& InLibraryId, const TArray<HAPI_StringHandle>& InAssetNames);
+
+		// Removes the asset's libraries from all sessions, needs to be called before the asset's content changes (reimport).
+		void RemoveAsset(const UHoudiniAsset* InHoudiniAsset);
+
+		// Removes all the libraries of a session, or of all the sessions if InSessionIndex is INDEX_NONE.
+		void Empty(const int32& InSessionIndex = INDEX_NONE);
+
+		// Returns the number of libraries cached in a session
+		int32 Num(const int32& InSessionIndex) const;
+
+	private:
+
+		struct FCachedLibrary
+		{
+			HAPI_AssetLibraryId LibraryId = -1;
+
+			// Names of the assets contained in the library, empty until first requested.
+			// The string handles remain valid as long as the session is.
+			TArray<HAPI_StringHandle> SubAssetNames;
+		};
+
+		// Cached libraries per session, indexed by their key.
+		TMap<int32, TMap<FString, FCachedLibrary>> SessionLibraries;
+
+		// Synchronization primitive, the libraries can be preloaded from a worker thread.
+		mutable FCriticalSection CriticalSection;
+};
@@ -0,0 +1,263 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineAttributeCatalog.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineString.h"
+
+#include "Misc/ScopeLock.h"
+
+// Outermost catalog scope of the current thread
+static thread_local FHoudiniEngineAttributeCatalogScope* HoudiniCurrentAttributeCatalogScope = nullptr;
+
+void
+FHoudiniEngineAttributeCatalog::SetCookCount(const HAPI_NodeId& InGeoId, const int32& InCookCount)
+{
+	const FGeoKey Key(FMath::Max(FHoudiniEngineRuntime::GetCurrentSessionIndex(), 0), InGeoId);
+
+	FScopeLock ScopeLock(&CriticalSection);
+	if (InCookCount < 0)
+	{
+		GeoCatalogs.Remove(Key);
+		return;
+	}
+
+	// Nodes are only cataloged for the lifetime of a scope, which removes their catalogs when it ends
+	FHoudiniEngineAttributeCatalogScope* Scope = HoudiniCurrentAttributeCatalogScope;
+	if (!Scope || &Scope->Catalog != this)
+		return;
+
+	if (!GeoCatalogs.Contains(Key))
+		Scope->GeoKeys.Add(Key);
+
+	FGeoCatalog& GeoCatalog = GeoCatalogs.FindOrAdd(Key);
+	if (GeoCatalog.CookCount == InCookCount)
+		return;
+
+	// The node has cooked, its parts need to be cataloged again
+	GeoCatalog.CookCount = InCookCount;
+	GeoCatalog.Parts.Empty();
+}
+
+bool
+FHoudiniEngineAttributeCatalog::FindAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char* InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	const FGeoKey Key(FMath::Max(FHoudiniEngineRuntime::GetCurrentSessionIndex(), 0), InGeoId);
+
+	bool bHasPartCatalog = false;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		const FGeoCatalog* GeoCatalog = GeoCatalogs.Find(Key);
+		if (!GeoCatalog)
+			return false;
+
+		bHasPartCatalog = GeoCatalog->Parts.Contains(InPartId);
+	}
+
+	if (!bHasPartCatalog)
+	{
+		// Build the part's catalog outside of the lock, other sessions can be queried meanwhile
+		FPartCatalog PartCatalog;
+		if (!BuildPartCatalog(InGeoId, InPartId, PartCatalog))
+			return false;
+
+		FScopeLock ScopeLock(&CriticalSection);
+		FGeoCatalog* GeoCatalog = GeoCatalogs.Find(Key);
+		if (!GeoCatalog)
+			return false;
+
+		if (!GeoCatalog->Parts.Contains(InPartId))
+			GeoCatalog->Parts.Add(InPartId, MoveTemp(PartCatalog));
+	}
+
+	const FString AttribName(InAttribName);
+
+	// Owners are searched in the same order as when querying HAPI directly
+	int32 FoundOwner = INDEX_NONE;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		FGeoCatalog* GeoCatalog = GeoCatalogs.Find(Key);
+		FPartCatalog* PartCatalog = GeoCatalog ? GeoCatalog->Parts.Find(InPartId) : nullptr;
+		if (!PartCatalog)
+			return false;
+
+		const int32 FirstOwner = (InOwner == HAPI_ATTROWNER_INVALID) ? 0 : (int32)InOwner;
+		const int32 LastOwner = (InOwner == HAPI_ATTROWNER_INVALID) ? HAPI_ATTROWNER_MAX - 1 : (int32)InOwner;
+		for (int32 OwnerIdx = FirstOwner; OwnerIdx <= LastOwner; OwnerIdx++)
+		{
+			const FCatalogAttribute* Attribute = PartCatalog->Attributes[OwnerIdx].Find(AttribName);
+			if (!Attribute)
+				continue;
+
+			if (Attribute->bHasInfo)
+			{
+				OutAttributeInfo = Attribute->Info;
+				return true;
+			}
+
+			FoundOwner = OwnerIdx;
+			break;
+		}
+	}
+
+	if (FoundOwner == INDEX_NONE)
+	{
+		// The attribute doesn't exist on the requested owner(s)
+		FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+		OutAttributeInfo.exists = false;
+		return true;
+	}
+
+	// Fetch the attribute's info outside of the lock, like the part catalogs
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	FHoudiniCookStats::AddAttributeLookupRoundTrips(1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, InAttribName, (HAPI_AttributeOwner)FoundOwner, &AttributeInfo))
+	{
+		return false;
+	}
+
+	{
+		// The catalog may have been invalidated meanwhile, only cache the info if the attribute is still there
+		FScopeLock ScopeLock(&CriticalSection);
+		FGeoCatalog* GeoCatalog = GeoCatalogs.Find(Key);
+		FPartCatalog* PartCatalog = GeoCatalog ? GeoCatalog->Parts.Find(InPartId) : nullptr;
+		FCatalogAttribute* Attribute = PartCatalog ? PartCatalog->Attributes[FoundOwner].Find(AttribName) : nullptr;
+		if (Attribute && !Attribute->bHasInfo)
+		{
+			Attribute->Info = AttributeInfo;
+			Attribute->bHasInfo = true;
+		}
+	}
+
+	OutAttributeInfo = AttributeInfo;
+	return true;
+}
+
+void
+FHoudiniEngineAttributeCatalog::Empty(const int32& InSessionIndex)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	if (InSessionIndex == INDEX_NONE)
+	{
+		GeoCatalogs.Empty();
+		return;
+	}
+
+	for (auto It = GeoCatalogs.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Key == InSessionIndex)
+			It.RemoveCurrent();
+	}
+}
+
+int32
+FHoudiniEngineAttributeCatalog::NumGeoCatalogs() const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return GeoCatalogs.Num();
+}
+
+void
+FHoudiniEngineAttributeCatalog::RemoveGeoCatalogs(const TArray<FGeoKey>& InKeys)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	for (const FGeoKey& Key : InKeys)
+		GeoCatalogs.Remove(Key);
+}
+
+bool
+FHoudiniEngineAttributeCatalog::BuildPartCatalog(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FPartCatalog& OutCatalog)
+{
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	FHoudiniCookStats::AddAttributeLookupRoundTrips(1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo))
+		return false;
+
+	// Gather the name handles of all owners, so they can be converted in a single batch
+	TArray<HAPI_StringHandle> NameHandles;
+	int32 OwnerNameCounts[HAPI_ATTROWNER_MAX];
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		OwnerNameCounts[OwnerIdx] = PartInfo.attributeCounts[OwnerIdx];
+		if (OwnerNameCounts[OwnerIdx] <= 0)
+			continue;
+
+		const int32 FirstName = NameHandles.AddUninitialized(OwnerNameCounts[OwnerIdx]);
+		FHoudiniCookStats::AddAttributeLookupRoundTrips(1);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, (HAPI_AttributeOwner)OwnerIdx,
+			&NameHandles[FirstName], OwnerNameCounts[OwnerIdx]))
+		{
+			return false;
+		}
+	}
+
+	TArray<FString> Names;
+	if (NameHandles.Num() > 0)
+	{
+		FHoudiniCookStats::AddAttributeLookupRoundTrips(2);
+		if (!FHoudiniEngineString::SHArrayToFStringArray(NameHandles, Names) || Names.Num() != NameHandles.Num())
+			return false;
+	}
+
+	int32 NameIdx = 0;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		for (int32 Idx = 0; Idx < OwnerNameCounts[OwnerIdx]; Idx++)
+			OutCatalog.Attributes[OwnerIdx].Add(Names[NameIdx++]);
+	}
+
+	return true;
+}
+
+FHoudiniEngineAttributeCatalogScope::FHoudiniEngineAttributeCatalogScope(FHoudiniEngineAttributeCatalog& InCatalog)
+	: Catalog(InCatalog)
+	, bIsOutermost(HoudiniCurrentAttributeCatalogScope == nullptr)
+{
+	if (bIsOutermost)
+		HoudiniCurrentAttributeCatalogScope = this;
+}
+
+FHoudiniEngineAttributeCatalogScope::~FHoudiniEngineAttributeCatalogScope()
+{
+	if (!bIsOutermost)
+		return;
+
+	HoudiniCurrentAttributeCatalogScope = nullptr;
+	Catalog.RemoveGeoCatalogs(GeoKeys);
+}
@@ -0,0 +1,130 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "HAL/CriticalSection.h"
+
+// Catalog of the attributes of the parts of the geo nodes being translated.
+// Attribute lookups otherwise need one GetAttributeInfo round trip per owner that is tried. The catalog of a part 
+// is built once, from the names of all of its attributes, and caches the info of the attributes that are queried.
+// The catalogs of a geo node are only used once its cook count has been set, and are dropped when it changes.
+// Geo nodes are only cataloged while an FHoudiniEngineAttributeCatalogScope is alive, and their catalogs are
+// removed when it ends, so the catalogs of deleted nodes don't accumulate.
+class HOUDINIENGINE_API FHoudiniEngineAttributeCatalog
+{
+	public:
+
+		// Sets the current cook count of a geo node, invalidating its catalogs if the node has cooked since they were built.
+		// A negative cook count removes the node's catalogs.
+		// Does nothing if no catalog scope is alive on the calling thread.
+		void SetCookCount(const HAPI_NodeId& InGeoId, const int32& InCookCount);
+
+		// Finds an attribute's info in a part's catalog, building it if needed.
+		// If InOwner is HAPI_ATTROWNER_INVALID, the owners are searched in order and the first match is returned.
+		// Returns false if the geo node has no catalog, in which case HAPI needs to be queried directly.
+		bool FindAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char* InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// Removes the catalogs of a session, or of all the sessions if InSessionIndex is INDEX_NONE.
+		void Empty(const int32& InSessionIndex = INDEX_NONE);
+
+		// Number of geo nodes that are currently cataloged
+		int32 NumGeoCatalogs() const;
+
+	private:
+
+		friend struct FHoudiniEngineAttributeCatalogScope;
+
+		typedef TPair<int32, HAPI_NodeId> FGeoKey;
+
+		// Removes the catalogs of the given geo nodes
+		void RemoveGeoCatalogs(const TArray<FGeoKey>& InKeys);
+
+		// Attribute names are case sensitive in Houdini
+		template<typename ValueType>
+		struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, ValueType>, FString, false>
+		{
+			static const FString& GetSetKey(const TPair<FString, ValueType>& Element) { return Element.Key; }
+			static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+			static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+		};
+
+		struct FCatalogAttribute
+		{
+			// The info is only fetched the first time the attribute is queried
+			bool bHasInfo = false;
+			HAPI_AttributeInfo Info;
+		};
+
+		typedef TMap<FString, FCatalogAttribute, FDefaultSetAllocator, FCaseSensitiveKeyFuncs<FCatalogAttribute>> FOwnerAttributes;
+
+		struct FPartCatalog
+		{
+			FOwnerAttributes Attributes[HAPI_ATTROWNER_MAX];
+		};
+
+		struct FGeoCatalog
+		{
+			int32 CookCount = -1;
+			TMap<HAPI_PartId, FPartCatalog> Parts;
+		};
+
+		// Builds a part's catalog from the names of its attributes
+		static bool BuildPartCatalog(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FPartCatalog& OutCatalog);
+
+		// Geo catalogs, indexed by session index and geo node id
+		TMap<FGeoKey, FGeoCatalog> GeoCatalogs;
+
+		// Synchronization primitive, outputs can be translated from several threads.
+		mutable FCriticalSection CriticalSection;
+};
+
+// Catalogs the geo nodes whose cook count is set by the calling thread for the lifetime of the scope,
+// typically while the outputs of a cook are built and translated.
+// Nested scopes share the geo nodes of the outermost scope.
+struct HOUDINIENGINE_API FHoudiniEngineAttributeCatalogScope
+{
+	FHoudiniEngineAttributeCatalogScope(FHoudiniEngineAttributeCatalog& InCatalog);
+	~FHoudiniEngineAttributeCatalogScope();
+
+	private:
+
+		friend class FHoudiniEngineAttributeCatalog;
+
+		FHoudiniEngineAttributeCatalog& Catalog;
+
+		// Geo nodes cataloged in this scope
+		TArray<FHoudiniEngineAttributeCatalog::FGeoKey> GeoKeys;
+
+		bool bIsOutermost;
+};
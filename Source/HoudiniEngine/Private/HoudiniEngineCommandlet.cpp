@@ -22,4 +22,744 @@
 * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
 * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
 * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
\ No newline at end of file
+*/
+
+#include "HoudiniEngineCommandlet.h"
+
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include <string>
+
+FHoudiniBenchmarkResult::FHoudiniBenchmarkResult()
+	: BytesReceived(0)
+	, PeakUsedPhysicalDelta(0)
+	, FailedIterations(0)
+{
+}
+
+UHoudiniEngineCommandlet::UHoudiniEngineCommandlet()
+{
+	HelpDescription = TEXT("Headless Houdini Engine tools. In -benchmark mode, repeatedly instantiates and cooks HDAs and writes per phase timings to a JSON report.");
+
+	HelpUsage = TEXT("HoudiniEngine Usage: HoudiniEngine -benchmark {options} [file.hda ...]");
+
+	HelpParamNames = {
+		"help",
+		"benchmark",
+		"manifest",
+		"cold",
+		"warm",
+		"output",
+		"session",
+		"connect",
+		"baseline",
+		"threshold"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"Benchmark the HDAs given as arguments or in the manifest.",
+		"JSON manifest listing the HDAs to benchmark with their parameter overrides and input files: { \"assets\": [ { \"path\": \"a.hda\", \"asset\": \"Sop/a\", \"parameters\": { \"size\": [1, 2, 3] }, \"inputs\": [ \"in.bgeo\" ] } ] }",
+		"Number of cold iterations (library load, instantiation and cook) per HDA. Defaults to 3.",
+		"Number of warm iterations (parameter and input upload and cook on the existing node) per HDA. Defaults to 10.",
+		"Path of the JSON report. Defaults to Saved/HoudiniEngine/Benchmark.json.",
+		"Session type: pipe (default), socket or inprocess.",
+		"Connect to an already running session (HARS, or a Houdini session started with the Engine server) instead of starting one.",
+		"A previous report to compare with. The commandlet fails if a phase's p50 regressed by more than the threshold.",
+		"Regression threshold for -baseline, as a percentage of the baseline p50. Defaults to 10."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = false;
+	ShowErrorCount = false;
+
+	Mode = EHoudiniEngineCommandletMode::None;
+	ColdIterations = 3;
+	WarmIterations = 10;
+	RegressionThreshold = 10.0f;
+}
+
+void
+UHoudiniEngineCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+FString
+UHoudiniEngineCommandlet::GetBenchmarkPhaseName(const EHoudiniBenchmarkPhase& InPhase)
+{
+	switch (InPhase)
+	{
+		case EHoudiniBenchmarkPhase::LoadLibrary:
+			return TEXT("LoadLibrary");
+		case EHoudiniBenchmarkPhase::Instantiate:
+			return TEXT("Instantiate");
+		case EHoudiniBenchmarkPhase::ParameterUpload:
+			return TEXT("ParameterUpload");
+		case EHoudiniBenchmarkPhase::InputUpload:
+			return TEXT("InputUpload");
+		case EHoudiniBenchmarkPhase::Cook:
+			return TEXT("Cook");
+		case EHoudiniBenchmarkPhase::OutputFetch:
+			return TEXT("OutputFetch");
+		default:
+			break;
+	}
+
+	return FString();
+}
+
+double
+UHoudiniEngineCommandlet::ComputePercentile(const TArray<double>& InSamples, const float& InPercentile)
+{
+	if (InSamples.Num() <= 0)
+		return 0.0;
+
+	TArray<double> Sorted = InSamples;
+	Sorted.Sort();
+
+	// Nearest-rank: the smallest sample such that at least InPercentile% of the samples are <= to it
+	const float Percentile = FMath::Clamp(InPercentile, 0.0f, 100.0f);
+	const int32 Rank = FMath::CeilToInt(Percentile / 100.0f * Sorted.Num());
+	return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+}
+
+bool
+UHoudiniEngineCommandlet::StartHoudiniEngineSession(const EHoudiniRuntimeSettingsSessionType& InSessionType, const bool& bInConnect)
+{
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	if (bInConnect)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("Connecting to a Houdini Engine session..."));
+		if (!HoudiniEngine.ConnectSession(InSessionType))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to connect to the Houdini Engine session."));
+			return false;
+		}
+	}
+	else
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("Starting Houdini Engine session..."));
+		if (!HoudiniEngine.CreateSession(InSessionType, "hapi_benchmark_cmdlet"))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool
+UHoudiniEngineCommandlet::ReadBenchmarkManifest(const FString& InManifestPath, TArray<FHoudiniBenchmarkAsset>& OutAssets) const
+{
+	FString ManifestString;
+	if (!FFileHelper::LoadFileToString(ManifestString, *InManifestPath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not read the benchmark manifest %s."), *InManifestPath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> ManifestObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ManifestString);
+	if (!FJsonSerializer::Deserialize(Reader, ManifestObject) || !ManifestObject.IsValid())
+	{
+		HOUDINI_LOG_ERROR(TEXT("The benchmark manifest %s is not valid JSON."), *InManifestPath);
+		return false;
+	}
+
+	// Relative paths in the manifest are relative to the manifest itself
+	const FString ManifestDir = FPaths::GetPath(FPaths::ConvertRelativePathToFull(InManifestPath));
+	auto MakeAbsolute = [&ManifestDir](const FString& InPath)
+	{
+		return FPaths::IsRelative(InPath) ? FPaths::ConvertRelativePathToFull(ManifestDir, InPath) : InPath;
+	};
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+	if (!ManifestObject->TryGetArrayField(TEXT("assets"), AssetValues) || !AssetValues)
+	{
+		HOUDINI_LOG_ERROR(TEXT("The benchmark manifest %s has no \"assets\" array."), *InManifestPath);
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValues)
+	{
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		if (!AssetValue.IsValid() || !AssetValue->TryGetObject(AssetObject) || !AssetObject)
+			continue;
+
+		FHoudiniBenchmarkAsset Asset;
+		if (!(*AssetObject)->TryGetStringField(TEXT("path"), Asset.FilePath) || Asset.FilePath.IsEmpty())
+		{
+			HOUDINI_LOG_WARNING(TEXT("Skipping a benchmark manifest entry without a path."));
+			continue;
+		}
+		Asset.FilePath = MakeAbsolute(Asset.FilePath);
+
+		(*AssetObject)->TryGetStringField(TEXT("asset"), Asset.AssetName);
+
+		const TSharedPtr<FJsonObject>* ParametersObject = nullptr;
+		if ((*AssetObject)->TryGetObjectField(TEXT("parameters"), ParametersObject) && ParametersObject)
+			Asset.Parameters = *ParametersObject;
+
+		TArray<FString> InputFiles;
+		if ((*AssetObject)->TryGetStringArrayField(TEXT("inputs"), InputFiles))
+		{
+			for (const FString& InputFile : InputFiles)
+				Asset.InputFiles.Add(InputFile.IsEmpty() ? InputFile : MakeAbsolute(InputFile));
+		}
+
+		OutAssets.Add(Asset);
+	}
+
+	return true;
+}
+
+bool
+UHoudiniEngineCommandlet::UploadBenchmarkParameters(const HAPI_NodeId& InNodeId, const TSharedPtr<FJsonObject>& InParameters) const
+{
+	if (!InParameters.IsValid())
+		return true;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	bool bSuccess = true;
+	for (const auto& Entry : InParameters->Values)
+	{
+		HAPI_ParmInfo ParmInfo;
+		FHoudiniApi::ParmInfo_Init(&ParmInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmInfoFromName(Session, InNodeId, TCHAR_TO_UTF8(*Entry.Key), &ParmInfo) || ParmInfo.id < 0)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Benchmark: parameter %s not found."), *Entry.Key);
+			bSuccess = false;
+			continue;
+		}
+
+		// A parameter value can either be a single value or an array of tuple values
+		TArray<TSharedPtr<FJsonValue>> Values;
+		if (Entry.Value->Type == EJson::Array)
+			Values = Entry.Value->AsArray();
+		else
+			Values.Add(Entry.Value);
+
+		const int32 Count = FMath::Min(Values.Num(), ParmInfo.size);
+		HAPI_Result Result = HAPI_RESULT_SUCCESS;
+		if (FHoudiniApi::ParmInfo_IsFloat(&ParmInfo))
+		{
+			TArray<float> FloatValues;
+			for (int32 Idx = 0; Idx < Count; Idx++)
+				FloatValues.Add((float)Values[Idx]->AsNumber());
+
+			if (Count > 0)
+				Result = FHoudiniApi::SetParmFloatValues(Session, InNodeId, FloatValues.GetData(), ParmInfo.floatValuesIndex, Count);
+		}
+		else if (FHoudiniApi::ParmInfo_IsInt(&ParmInfo))
+		{
+			TArray<int32> IntValues;
+			for (int32 Idx = 0; Idx < Count; Idx++)
+				IntValues.Add(Values[Idx]->Type == EJson::Boolean ? (Values[Idx]->AsBool() ? 1 : 0) : (int32)Values[Idx]->AsNumber());
+
+			if (Count > 0)
+				Result = FHoudiniApi::SetParmIntValues(Session, InNodeId, IntValues.GetData(), ParmInfo.intValuesIndex, Count);
+		}
+		else if (FHoudiniApi::ParmInfo_IsString(&ParmInfo))
+		{
+			for (int32 Idx = 0; Idx < Count && Result == HAPI_RESULT_SUCCESS; Idx++)
+			{
+				std::string Value;
+				FHoudiniEngineUtils::ConvertUnrealString(Values[Idx]->AsString(), Value);
+				Result = FHoudiniApi::SetParmStringValue(Session, InNodeId, Value.c_str(), ParmInfo.id, Idx);
+			}
+		}
+		else
+		{
+			HOUDINI_LOG_WARNING(TEXT("Benchmark: parameter %s has an unsupported type."), *Entry.Key);
+			bSuccess = false;
+			continue;
+		}
+
+		if (Result != HAPI_RESULT_SUCCESS)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Benchmark: failed to set parameter %s: %s"), *Entry.Key, *FHoudiniEngineUtils::GetErrorDescription(Result));
+			bSuccess = false;
+		}
+	}
+
+	return bSuccess;
+}
+
+bool
+UHoudiniEngineCommandlet::UploadBenchmarkInputs(const HAPI_NodeId& InNodeId, const TArray<FString>& InInputFiles, TArray<HAPI_NodeId>& InOutInputNodeIds) const
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	InOutInputNodeIds.SetNum(InInputFiles.Num());
+	for (int32 InputIdx = 0; InputIdx < InInputFiles.Num(); InputIdx++)
+	{
+		if (InInputFiles[InputIdx].IsEmpty())
+		{
+			InOutInputNodeIds[InputIdx] = -1;
+			continue;
+		}
+
+		// Input nodes are created once, then the geometry is reloaded in them on every iteration
+		HAPI_NodeId& InputNodeId = InOutInputNodeIds[InputIdx];
+		if (InputNodeId < 0)
+		{
+			const FString Label = FString::Printf(TEXT("benchmark_input%d"), InputIdx);
+			if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::CreateInputNode(Label, InputNodeId))
+			{
+				InputNodeId = -1;
+				return false;
+			}
+		}
+
+		std::string FilePath;
+		FHoudiniEngineUtils::ConvertUnrealString(InInputFiles[InputIdx], FilePath);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::LoadGeoFromFile(Session, InputNodeId, FilePath.c_str()), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(Session, InNodeId, InputIdx, InputNodeId, 0), false);
+	}
+
+	return true;
+}
+
+bool
+UHoudiniEngineCommandlet::FetchBenchmarkOutputs(const HAPI_NodeId& InNodeId, int64& OutBytesReceived) const
+{
+	// Track the bytes read by the attribute helpers
+	FHoudiniCookStats FetchStats;
+	FHoudiniCookStatsScope StatsScope(&FetchStats);
+
+	TArray<HAPI_NodeId> OutputNodes;
+	if (!FHoudiniEngineUtils::GatherAllAssetOutputs(InNodeId, true, false, OutputNodes))
+		return false;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	for (const HAPI_NodeId& OutputNodeId : OutputNodes)
+	{
+		HAPI_GeoInfo GeoInfo;
+		FHoudiniApi::GeoInfo_Init(&GeoInfo);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(Session, OutputNodeId, &GeoInfo), false);
+
+		for (int32 PartId = 0; PartId < GeoInfo.partCount; PartId++)
+		{
+			HAPI_PartInfo PartInfo;
+			FHoudiniApi::PartInfo_Init(&PartInfo);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(Session, OutputNodeId, PartId, &PartInfo), false);
+
+			// Fetch what every output needs: positions and, for meshes, the vertex list
+			HAPI_AttributeInfo AttribInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttribInfo);
+			TArray<float> Positions;
+			FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				OutputNodeId, PartId, HAPI_UNREAL_ATTRIB_POSITION, AttribInfo, Positions, 3, HAPI_ATTROWNER_POINT);
+
+			if (PartInfo.vertexCount > 0)
+			{
+				TArray<int32> VertexList;
+				VertexList.SetNumUninitialized(PartInfo.vertexCount);
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVertexList(
+					Session, OutputNodeId, PartId, VertexList.GetData(), 0, PartInfo.vertexCount), false);
+				FetchStats.BytesReceived += VertexList.Num() * sizeof(int32);
+			}
+		}
+	}
+
+	OutBytesReceived = FetchStats.BytesReceived;
+	return true;
+}
+
+bool
+UHoudiniEngineCommandlet::RunBenchmarkIteration(
+	const FHoudiniBenchmarkAsset& InAsset,
+	const bool& bInCold,
+	HAPI_NodeId& InOutAssetNodeId,
+	TArray<HAPI_NodeId>& InOutInputNodeIds,
+	double OutTimes[(int32)EHoudiniBenchmarkPhase::Count],
+	int64& OutBytesReceived,
+	uint64& InOutPeakUsedPhysical)
+{
+	for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniBenchmarkPhase::Count; PhaseIdx++)
+		OutTimes[PhaseIdx] = 0.0;
+
+	double PhaseStartTime = FPlatformTime::Seconds();
+	auto EndPhase = [&OutTimes, &PhaseStartTime, &InOutPeakUsedPhysical](const EHoudiniBenchmarkPhase& InPhase)
+	{
+		const double Now = FPlatformTime::Seconds();
+		OutTimes[(int32)InPhase] = Now - PhaseStartTime;
+		PhaseStartTime = Now;
+
+		// Sample the memory used at the end of each phase
+		InOutPeakUsedPhysical = FMath::Max<uint64>(InOutPeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+	};
+
+	if (bInCold)
+	{
+		// Cold iterations start from scratch, remove the nodes of the previous iteration (untimed)
+		if (InOutAssetNodeId >= 0)
+			FHoudiniEngineUtils::DeleteHoudiniNode(InOutAssetNodeId);
+		InOutAssetNodeId = -1;
+
+		for (HAPI_NodeId& InputNodeId : InOutInputNodeIds)
+		{
+			if (InputNodeId >= 0)
+				FHoudiniEngineUtils::DeleteHoudiniNode(InputNodeId);
+		}
+		InOutInputNodeIds.Empty();
+
+		PhaseStartTime = FPlatformTime::Seconds();
+
+		// Load (or reload) the library
+		HAPI_AssetLibraryId LibraryId = -1;
+		std::string FilePath;
+		FHoudiniEngineUtils::ConvertUnrealString(InAsset.FilePath, FilePath);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::LoadAssetLibraryFromFile(
+			FHoudiniEngine::Get().GetSession(), FilePath.c_str(), true, &LibraryId), false);
+
+		FString AssetName = InAsset.AssetName;
+		if (AssetName.IsEmpty())
+		{
+			TArray<HAPI_StringHandle> AssetNames;
+			if (!FHoudiniEngineUtils::GetSubAssetNames(LibraryId, AssetNames) || AssetNames.Num() <= 0)
+				return false;
+
+			AssetName = FHoudiniEngineUtils::HapiGetString(AssetNames[0]);
+		}
+		EndPhase(EHoudiniBenchmarkPhase::LoadLibrary);
+
+		// Instantiate the asset without cooking it
+		if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::CreateNode(-1, AssetName, TEXT("benchmark"), false, &InOutAssetNodeId))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Benchmark: failed to instantiate %s: %s"), *AssetName, *FHoudiniEngineUtils::GetErrorDescription());
+			InOutAssetNodeId = -1;
+			return false;
+		}
+		EndPhase(EHoudiniBenchmarkPhase::Instantiate);
+	}
+
+	if (InOutAssetNodeId < 0)
+		return false;
+
+	bool bSuccess = UploadBenchmarkParameters(InOutAssetNodeId, InAsset.Parameters);
+	EndPhase(EHoudiniBenchmarkPhase::ParameterUpload);
+
+	bSuccess &= UploadBenchmarkInputs(InOutAssetNodeId, InAsset.InputFiles, InOutInputNodeIds);
+	EndPhase(EHoudiniBenchmarkPhase::InputUpload);
+
+	if (!FHoudiniEngineUtils::HapiCookNode(InOutAssetNodeId, nullptr, true))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Benchmark: cook failed: %s"), *FHoudiniEngineUtils::GetCookResult());
+		return false;
+	}
+	EndPhase(EHoudiniBenchmarkPhase::Cook);
+
+	bSuccess &= FetchBenchmarkOutputs(InOutAssetNodeId, OutBytesReceived);
+	EndPhase(EHoudiniBenchmarkPhase::OutputFetch);
+
+	return bSuccess;
+}
+
+int32
+UHoudiniEngineCommandlet::RunBenchmark(const TArray<FHoudiniBenchmarkAsset>& InAssets)
+{
+	TArray<FHoudiniBenchmarkResult> Results;
+	Results.SetNum(InAssets.Num());
+	for (int32 AssetIdx = 0; AssetIdx < InAssets.Num(); AssetIdx++)
+	{
+		const FHoudiniBenchmarkAsset& Asset = InAssets[AssetIdx];
+		FHoudiniBenchmarkResult& Result = Results[AssetIdx];
+		HOUDINI_LOG_DISPLAY(TEXT("Benchmarking %s (%d cold, %d warm iterations)..."), *Asset.FilePath, ColdIterations, WarmIterations);
+
+		HAPI_NodeId AssetNodeId = -1;
+		TArray<HAPI_NodeId> InputNodeIds;
+		double Times[(int32)EHoudiniBenchmarkPhase::Count];
+
+		// The process' peak memory covers everything that ran before this asset,
+		// measure the memory used around the asset's iterations instead
+		const uint64 StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		uint64 PeakUsedPhysical = StartUsedPhysical;
+
+		// Warm iterations always run on the node created by the last cold iteration
+		const int32 NumIterations = FMath::Max(ColdIterations, 1) + WarmIterations;
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const bool bCold = Iteration < FMath::Max(ColdIterations, 1);
+			if (!bCold && AssetNodeId < 0)
+				break;
+
+			if (!RunBenchmarkIteration(Asset, bCold, AssetNodeId, InputNodeIds, Times, Result.BytesReceived, PeakUsedPhysical))
+			{
+				Result.FailedIterations++;
+				continue;
+			}
+
+			// An extra cold iteration is needed when -cold=0, don't record it
+			if (bCold && Iteration >= ColdIterations)
+				continue;
+
+			for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniBenchmarkPhase::Count; PhaseIdx++)
+			{
+				if (bCold)
+					Result.ColdTimes[PhaseIdx].Add(Times[PhaseIdx]);
+				else if (PhaseIdx != (int32)EHoudiniBenchmarkPhase::LoadLibrary && PhaseIdx != (int32)EHoudiniBenchmarkPhase::Instantiate)
+					Result.WarmTimes[PhaseIdx].Add(Times[PhaseIdx]);
+			}
+		}
+
+		// Clean up the session before moving to the next asset
+		if (AssetNodeId >= 0)
+			FHoudiniEngineUtils::DeleteHoudiniNode(AssetNodeId);
+		for (const HAPI_NodeId& InputNodeId : InputNodeIds)
+		{
+			if (InputNodeId >= 0)
+				FHoudiniEngineUtils::DeleteHoudiniNode(InputNodeId);
+		}
+
+		Result.PeakUsedPhysicalDelta = PeakUsedPhysical - StartUsedPhysical;
+
+		if (Result.FailedIterations > 0)
+			HOUDINI_LOG_WARNING(TEXT("Benchmarking %s... %d iteration(s) failed"), *Asset.FilePath, Result.FailedIterations);
+		else
+			HOUDINI_LOG_DISPLAY(TEXT("Benchmarking %s... Done"), *Asset.FilePath);
+	}
+
+	TSharedPtr<FJsonObject> Report = WriteBenchmarkReport(InAssets, Results);
+
+	FString ReportString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+	if (!FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to write the benchmark report to %s."), *OutputPath);
+		return 4;
+	}
+	HOUDINI_LOG_DISPLAY(TEXT("Benchmark report written to %s"), *OutputPath);
+
+	int32 NumFailedIterations = 0;
+	for (const FHoudiniBenchmarkResult& Result : Results)
+		NumFailedIterations += Result.FailedIterations;
+
+	return NumFailedIterations > 0 ? 5 : 0;
+}
+
+TSharedPtr<FJsonObject>
+UHoudiniEngineCommandlet::WriteBenchmarkReport(const TArray<FHoudiniBenchmarkAsset>& InAssets, const TArray<FHoudiniBenchmarkResult>& InResults) const
+{
+	auto WritePhases = [](const TArray<double> InTimes[(int32)EHoudiniBenchmarkPhase::Count])
+	{
+		TSharedPtr<FJsonObject> PhasesObject = MakeShareable(new FJsonObject);
+		for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniBenchmarkPhase::Count; PhaseIdx++)
+		{
+			const TArray<double>& Samples = InTimes[PhaseIdx];
+			if (Samples.Num() <= 0)
+				continue;
+
+			// Times are reported in milliseconds
+			TSharedPtr<FJsonObject> PhaseObject = MakeShareable(new FJsonObject);
+			PhaseObject->SetNumberField(TEXT("p50"), ComputePercentile(Samples, 50.0f) * 1000.0);
+			PhaseObject->SetNumberField(TEXT("p90"), ComputePercentile(Samples, 90.0f) * 1000.0);
+			PhaseObject->SetNumberField(TEXT("p99"), ComputePercentile(Samples, 99.0f) * 1000.0);
+			PhaseObject->SetNumberField(TEXT("samples"), Samples.Num());
+			PhasesObject->SetObjectField(GetBenchmarkPhaseName((EHoudiniBenchmarkPhase)PhaseIdx), PhaseObject);
+		}
+		return PhasesObject;
+	};
+
+	TSharedPtr<FJsonObject> Report = MakeShareable(new FJsonObject);
+	Report->SetNumberField(TEXT("cold_iterations"), ColdIterations);
+	Report->SetNumberField(TEXT("warm_iterations"), WarmIterations);
+
+	TArray<TSharedPtr<FJsonValue>> AssetValues;
+	for (int32 AssetIdx = 0; AssetIdx < InAssets.Num() && AssetIdx < InResults.Num(); AssetIdx++)
+	{
+		const FHoudiniBenchmarkAsset& Asset = InAssets[AssetIdx];
+		const FHoudiniBenchmarkResult& Result = InResults[AssetIdx];
+
+		TSharedPtr<FJsonObject> AssetObject = MakeShareable(new FJsonObject);
+		AssetObject->SetStringField(TEXT("name"), Asset.AssetName.IsEmpty() ? FPaths::GetBaseFilename(Asset.FilePath) : Asset.AssetName);
+		AssetObject->SetStringField(TEXT("path"), Asset.FilePath);
+		AssetObject->SetObjectField(TEXT("cold"), WritePhases(Result.ColdTimes));
+		AssetObject->SetObjectField(TEXT("warm"), WritePhases(Result.WarmTimes));
+		AssetObject->SetNumberField(TEXT("output_bytes"), (double)Result.BytesReceived);
+		AssetObject->SetNumberField(TEXT("peak_memory_mb"), (double)Result.PeakUsedPhysicalDelta / (1024.0 * 1024.0));
+		AssetObject->SetNumberField(TEXT("failed_iterations"), Result.FailedIterations);
+		AssetValues.Add(MakeShareable(new FJsonValueObject(AssetObject)));
+	}
+	Report->SetArrayField(TEXT("assets"), AssetValues);
+	Report->SetNumberField(TEXT("peak_memory_mb"), (double)FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0));
+
+	return Report;
+}
+
+int32
+UHoudiniEngineCommandlet::CompareWithBaseline(const TSharedPtr<FJsonObject>& InReport, const FString& InBaselinePath) const
+{
+	FString BaselineString;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineString, *InBaselinePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineString), Baseline)
+		|| !Baseline.IsValid())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not read the benchmark baseline %s."), *InBaselinePath);
+		return 1;
+	}
+
+	// Index the baseline assets by name
+	TMap<FString, TSharedPtr<FJsonObject>> BaselineAssets;
+	const TArray<TSharedPtr<FJsonValue>>* BaselineValues = nullptr;
+	if (Baseline->TryGetArrayField(TEXT("assets"), BaselineValues) && BaselineValues)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *BaselineValues)
+		{
+			const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+			FString Name;
+			if (Value.IsValid() && Value->TryGetObject(AssetObject) && AssetObject && (*AssetObject)->TryGetStringField(TEXT("name"), Name))
+				BaselineAssets.Add(Name, *AssetObject);
+		}
+	}
+
+	// Ignore differences under a millisecond, they're mostly noise
+	const double MinDifference = 1.0;
+
+	int32 NumRegressions = 0;
+	const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+	if (!InReport->TryGetArrayField(TEXT("assets"), AssetValues) || !AssetValues)
+		return 0;
+
+	for (const TSharedPtr<FJsonValue>& Value : *AssetValues)
+	{
+		const TSharedPtr<FJsonObject>& AssetObject = Value->AsObject();
+		const FString Name = AssetObject->GetStringField(TEXT("name"));
+		const TSharedPtr<FJsonObject>* BaselineAsset = BaselineAssets.Find(Name);
+		if (!BaselineAsset)
+		{
+			HOUDINI_LOG_DISPLAY(TEXT("Benchmark: %s is not in the baseline."), *Name);
+			continue;
+		}
+
+		for (const FString& Pass : { FString(TEXT("cold")), FString(TEXT("warm")) })
+		{
+			const TSharedPtr<FJsonObject>* Phases = nullptr;
+			const TSharedPtr<FJsonObject>* BaselinePhases = nullptr;
+			if (!AssetObject->TryGetObjectField(Pass, Phases) || !(*BaselineAsset)->TryGetObjectField(Pass, BaselinePhases))
+				continue;
+
+			for (const auto& PhaseEntry : (*Phases)->Values)
+			{
+				const TSharedPtr<FJsonObject>* BaselinePhase = nullptr;
+				if (!(*BaselinePhases)->TryGetObjectField(PhaseEntry.Key, BaselinePhase))
+					continue;
+
+				const double Current = PhaseEntry.Value->AsObject()->GetNumberField(TEXT("p50"));
+				const double Previous = (*BaselinePhase)->GetNumberField(TEXT("p50"));
+				if (Current - Previous > MinDifference && Current > Previous * (1.0 + RegressionThreshold / 100.0))
+				{
+					HOUDINI_LOG_ERROR(TEXT("Benchmark regression: %s %s %s p50 went from %.2fms to %.2fms."),
+						*Name, *Pass, *PhaseEntry.Key, Previous, Current);
+					NumRegressions++;
+				}
+			}
+		}
+	}
+
+	return NumRegressions;
+}
+
+int32
+UHoudiniEngineCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	if (!Switches.Contains(TEXT("benchmark")))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	Mode = EHoudiniEngineCommandletMode::Benchmark;
+
+	if (Params.Contains(TEXT("cold")))
+		ColdIterations = FMath::Max(0, FCString::Atoi(*Params.FindChecked(TEXT("cold"))));
+	if (Params.Contains(TEXT("warm")))
+		WarmIterations = FMath::Max(0, FCString::Atoi(*Params.FindChecked(TEXT("warm"))));
+	if (Params.Contains(TEXT("threshold")))
+		RegressionThreshold = FMath::Max(0.0f, FCString::Atof(*Params.FindChecked(TEXT("threshold"))));
+
+	OutputPath = Params.Contains(TEXT("output"))
+		? Params.FindChecked(TEXT("output"))
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("Benchmark.json"));
+	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+
+	// Gather the HDAs to benchmark
+	TArray<FHoudiniBenchmarkAsset> Assets;
+	if (Params.Contains(TEXT("manifest")) && !ReadBenchmarkManifest(Params.FindChecked(TEXT("manifest")), Assets))
+		return 1;
+
+	for (const FString& Token : Tokens)
+	{
+		FHoudiniBenchmarkAsset Asset;
+		Asset.FilePath = FPaths::ConvertRelativePathToFull(Token);
+		Assets.Add(Asset);
+	}
+
+	if (Assets.Num() <= 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("No HDA to benchmark, specify HDA files or a -manifest."));
+		return 1;
+	}
+
+	EHoudiniRuntimeSettingsSessionType SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe;
+	const FString SessionTypeString = Params.Contains(TEXT("session")) ? Params.FindChecked(TEXT("session")) : FString();
+	if (SessionTypeString.Equals(TEXT("socket"), ESearchCase::IgnoreCase))
+		SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_Socket;
+	else if (SessionTypeString.Equals(TEXT("inprocess"), ESearchCase::IgnoreCase))
+		SessionType = EHoudiniRuntimeSettingsSessionType::HRSST_InProcess;
+
+	if (!StartHoudiniEngineSession(SessionType, Switches.Contains(TEXT("connect"))))
+		return 2;
+
+	int32 Result = RunBenchmark(Assets);
+
+	if (Result != 4 && Params.Contains(TEXT("baseline")))
+	{
+		FString ReportString;
+		TSharedPtr<FJsonObject> Report;
+		if (FFileHelper::LoadFileToString(ReportString, *OutputPath)
+			&& FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ReportString), Report)
+			&& Report.IsValid()
+			&& CompareWithBaseline(Report, Params.FindChecked(TEXT("baseline"))) > 0)
+		{
+			Result = 6;
+		}
+	}
+
+	FHoudiniEngine::Get().StopSession();
+
+	return Result;
+}
@@ -24,4 +24,141 @@
 * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniEngine.h"
+
+#include "HoudiniEngineCommandlet.generated.h"
+
+class FJsonObject;
+
+enum class EHoudiniEngineCommandletMode : uint8
+{
+	// Unspecified
+	None,
+	// Repeatedly cook HDAs and report timings
+	Benchmark
+};
+
+// Pipeline phases timed by the benchmark
+enum class EHoudiniBenchmarkPhase : uint8
+{
+	LoadLibrary,
+	Instantiate,
+	ParameterUpload,
+	InputUpload,
+	Cook,
+	OutputFetch,
+	Count
+};
+
+// An HDA to benchmark, as specified on the command line or in the manifest
+struct FHoudiniBenchmarkAsset
+{
+	// Absolute path to the HDA file
+	FString FilePath;
+
+	// Asset to instantiate, if empty the first asset of the library is used
+	FString AssetName;
+
+	// Parameter values to apply before each cook
+	TSharedPtr<FJsonObject> Parameters;
+
+	// Geometry files loaded and connected to the asset's inputs, by input index
+	TArray<FString> InputFiles;
+};
+
+// Timings gathered for one HDA
+struct FHoudiniBenchmarkResult
+{
+	FHoudiniBenchmarkResult();
+
+	// Time spent per phase (in seconds), one sample per cold/warm iteration
+	TArray<double> ColdTimes[(int32)EHoudiniBenchmarkPhase::Count];
+	TArray<double> WarmTimes[(int32)EHoudiniBenchmarkPhase::Count];
+
+	// Bytes received from the session while fetching the outputs of the last iteration
+	int64 BytesReceived;
+
+	// Peak increase of the physical memory used by the process while this asset was benchmarked,
+	// relative to the memory used before its first iteration
+	uint64 PeakUsedPhysicalDelta;
+
+	int32 FailedIterations;
+};
+
+UCLASS()
+class HOUDINIENGINE_API UHoudiniEngineCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniEngineCommandlet();
+
+	void PrintUsage() const;
+
+	/**
+	* Entry point for your commandlet
+	*
+	* @param Params the string containing the parameters for the commandlet
+	*/
+	virtual int32 Main(const FString& Params) override;
+
+	// Returns the name used for a benchmark phase in the report
+	static FString GetBenchmarkPhaseName(const EHoudiniBenchmarkPhase& InPhase);
+
+	// Nearest-rank percentile (0-100) of the given samples, 0 if there are none
+	static double ComputePercentile(const TArray<double>& InSamples, const float& InPercentile);
+
+protected:
+
+	bool StartHoudiniEngineSession(const EHoudiniRuntimeSettingsSessionType& InSessionType, const bool& bInConnect);
+
+	// Reads the HDA list, either from a JSON manifest or from a list of HDA files
+	bool ReadBenchmarkManifest(const FString& InManifestPath, TArray<FHoudiniBenchmarkAsset>& OutAssets) const;
+
+	int32 RunBenchmark(const TArray<FHoudiniBenchmarkAsset>& InAssets);
+
+	// Runs one cold or warm iteration, cold iterations recreate the asset node.
+	bool RunBenchmarkIteration(
+		const FHoudiniBenchmarkAsset& InAsset,
+		const bool& bInCold,
+		HAPI_NodeId& InOutAssetNodeId,
+		TArray<HAPI_NodeId>& InOutInputNodeIds,
+		double OutTimes[(int32)EHoudiniBenchmarkPhase::Count],
+		int64& OutBytesReceived,
+		uint64& InOutPeakUsedPhysical);
+
+	bool UploadBenchmarkParameters(const HAPI_NodeId& InNodeId, const TSharedPtr<FJsonObject>& InParameters) const;
+
+	bool UploadBenchmarkInputs(const HAPI_NodeId& InNodeId, const TArray<FString>& InInputFiles, TArray<HAPI_NodeId>& InOutInputNodeIds) const;
+
+	bool FetchBenchmarkOutputs(const HAPI_NodeId& InNodeId, int64& OutBytesReceived) const;
+
+	TSharedPtr<FJsonObject> WriteBenchmarkReport(const TArray<FHoudiniBenchmarkAsset>& InAssets, const TArray<FHoudiniBenchmarkResult>& InResults) const;
+
+	// Compares the report with a previous one, returns the number of regressions found
+	int32 CompareWithBaseline(const TSharedPtr<FJsonObject>& InReport, const FString& InBaselinePath) const;
+
+private:
+
+	// Mode in which commandlet is running
+	EHoudiniEngineCommandletMode Mode;
+
+	// Number of cold iterations (library load + instantiation + cook) per HDA
+	int32 ColdIterations;
+
+	// Number of warm iterations (parameter/input upload + cook on an existing node) per HDA
+	int32 WarmIterations;
+
+	// Path of the JSON report
+	FString OutputPath;
+
+	// p50 increase (in percent) above which a phase is reported as a regression against the baseline
+	float RegressionThreshold;
+};
@@ -0,0 +1,124 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineCookWait.h"
+
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitSpinTime(
+	TEXT("HoudiniEngine.CookWaitSpinTime"),
+	0.002f,
+	TEXT("Time (in seconds) during which the cook status is polled continuously before starting to sleep between polls.\n")
+	TEXT("0.002: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitMinSleep(
+	TEXT("HoudiniEngine.CookWaitMinSleep"),
+	0.001f,
+	TEXT("Initial sleep time (in seconds) between two cook status polls, once the spin time has elapsed.\n")
+	TEXT("The sleep time then doubles after each poll until it reaches HoudiniEngine.CookWaitMaxSleep.\n")
+	TEXT("0.001: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitMaxSleep(
+	TEXT("HoudiniEngine.CookWaitMaxSleep"),
+	0.05f,
+	TEXT("Maximum sleep time (in seconds) between two cook status polls.\n")
+	TEXT("0.05: Default\n")
+);
+
+FHoudiniEngineCookWait::FHoudiniEngineCookWait(FEvent* InWakeUpEvent)
+	: FHoudiniEngineCookWait(
+		CVarHoudiniEngineCookWaitSpinTime.GetValueOnAnyThread(),
+		CVarHoudiniEngineCookWaitMinSleep.GetValueOnAnyThread(),
+		CVarHoudiniEngineCookWaitMaxSleep.GetValueOnAnyThread(),
+		InWakeUpEvent)
+{
+}
+
+FHoudiniEngineCookWait::FHoudiniEngineCookWait(
+	const double& InSpinTime,
+	const double& InMinSleepTime,
+	const double& InMaxSleepTime,
+	FEvent* InWakeUpEvent)
+	: SpinTime(FMath::Max(InSpinTime, 0.0))
+	, MinSleepTime(FMath::Max(InMinSleepTime, 0.0))
+	, MaxSleepTime(FMath::Max(InMaxSleepTime, 0.0))
+	, WakeUpEvent(InWakeUpEvent)
+{
+	MinSleepTime = FMath::Min(MinSleepTime, MaxSleepTime);
+	Reset();
+}
+
+void
+FHoudiniEngineCookWait::Reset()
+{
+	StartTime = FPlatformTime::Seconds();
+	CurrentSleepTime = MinSleepTime;
+}
+
+double
+FHoudiniEngineCookWait::GetElapsedTime() const
+{
+	return FPlatformTime::Seconds() - StartTime;
+}
+
+void
+FHoudiniEngineCookWait::Wait()
+{
+	if (GetElapsedTime() < SpinTime)
+	{
+		// Still in the spin phase, simply give the other threads a chance to run
+		FPlatformProcess::YieldThread();
+		return;
+	}
+
+	if (CurrentSleepTime <= 0.0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+	else if (WakeUpEvent)
+	{
+		// Sleep, unless someone wakes us up
+		const uint32 WaitTimeMS = FMath::Max(1u, (uint32)FMath::RoundToInt(CurrentSleepTime * 1000.0));
+		if (WakeUpEvent->Wait(WaitTimeMS))
+		{
+			// We've been woken up: the status is about to change, go back to polling quickly
+			CurrentSleepTime = MinSleepTime;
+			return;
+		}
+	}
+	else
+	{
+		FPlatformProcess::SleepNoStats(CurrentSleepTime);
+	}
+
+	// Back off
+	CurrentSleepTime = FMath::Min(FMath::Max(CurrentSleepTime * 2.0, 0.001), MaxSleepTime);
+}
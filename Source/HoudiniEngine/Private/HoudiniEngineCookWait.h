@@ -0,0 +1,78 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FEvent;
+
+// Helper used when waiting for a HAPI cook to complete.
+// Instead of sleeping a fixed amount of time between each call to HAPI_GetStatus,
+// the cook status is first polled in a tight loop for a short while (most small cooks
+// finish within that window), then the sleep time between polls grows exponentially
+// up to a maximum value. If a wake up event is provided, the wait can be interrupted
+// so the waiting thread checks the status again immediately.
+class HOUDINIENGINE_API FHoudiniEngineCookWait
+{
+public:
+
+	// Uses the values of the HoudiniEngine.CookWait* console variables.
+	FHoudiniEngineCookWait(FEvent* InWakeUpEvent = nullptr);
+
+	FHoudiniEngineCookWait(
+		const double& InSpinTime,
+		const double& InMinSleepTime,
+		const double& InMaxSleepTime,
+		FEvent* InWakeUpEvent = nullptr);
+
+	// Restarts the spin phase, call this when starting to wait for a new cook.
+	void Reset();
+
+	// Yields the calling thread until the next status poll.
+	void Wait();
+
+	// Returns the time elapsed (in seconds) since the wait was started/reset.
+	double GetElapsedTime() const;
+
+	// Time (in seconds) during which the cook status is polled without sleeping.
+	double SpinTime;
+	// Sleep time (in seconds) used right after the spin phase.
+	double MinSleepTime;
+	// Upper bound (in seconds) of the sleep time between two polls.
+	double MaxSleepTime;
+
+private:
+
+	// Optional event used to cut a wait short.
+	FEvent* WakeUpEvent;
+
+	// Time at which the wait was started
+	double StartTime;
+
+	// Sleep time that will be used by the next wait
+	double CurrentSleepTime;
+};
@@ -29,8 +29,10 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniCookStats.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
@@ -39,7 +41,11 @@
 #include "HoudiniNodeSyncComponent.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
+#include "HoudiniScratchAllocator.h"
+#include "HoudiniStaticMeshBuildQueue.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -48,6 +54,7 @@
 
 #if WITH_EDITOR
 	#include "Editor.h"
+	#include "Engine/Selection.h"
 	#include "EditorViewportClient.h"
 	#include "Kismet/KismetMathLibrary.h"
 
@@ -73,6 +80,15 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineLiveSyncTickTime(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCancelOutOfDateCooks(
+	TEXT("HoudiniEngine.CancelOutOfDateCooks"),
+	1,
+	TEXT("Cancels an HDA's cook if its parameters or inputs are modified before the cook finishes.\n")
+	TEXT("The cook is interrupted, its results are not processed and the HDA is recooked with its latest values.\n")
+	TEXT("0: Disabled, every cook is processed\n")
+	TEXT("1: Enabled (Default)\n")
+);
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -118,6 +134,9 @@ FHoudiniEngineManager::StopHoudiniTicking()
 			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);			
 			TickerHandle.Reset();
 
+			// The pending static mesh builds will not be ticked anymore, complete them now
+			FHoudiniStaticMeshBuildQueue::Get().FinishAll();
+
 			// Reset time for delayed notification.
 			FHoudiniEngine::Get().SetHapiNotificationStartedTime(0.0);
 
@@ -138,6 +157,35 @@ bool FHoudiniEngineManager::IsTicking() const
 	return TickerHandle.IsValid();
 }
 
+// Returns true if the component is in a state that needs processing on every tick.
+// The only two non-active states are NeedInstantiation (loaded, not instantiated in H yet, not modified)
+// and None (no processing currently).
+static bool
+IsComponentActive(const UHoudiniAssetComponent* InHAC)
+{
+	const EHoudiniAssetState AssetState = InHAC->GetAssetState();
+	return AssetState != EHoudiniAssetState::NeedInstantiation
+		&& AssetState != EHoudiniAssetState::None;
+}
+
+// Processing order of the components: selected, visible, active, then idle ones
+static int32
+GetComponentProcessingPriority(const UHoudiniAssetComponent* InHAC)
+{
+	const AActor* Owner = InHAC->GetOwner();
+#if WITH_EDITOR
+	if (Owner && Owner->IsSelectedInEditor())
+		return 0;
+#endif
+	if (Owner && Owner->WasRecentlyRendered(1.0f))
+		return 1;
+
+	if (IsComponentActive(InHAC))
+		return 2;
+
+	return 3;
+}
+
 bool
 FHoudiniEngineManager::Tick(float DeltaTime)
 {
@@ -154,14 +202,39 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		return true;
 	}
 
-	// Build a set of components that need to be processed
-	// 1 - selected HACs
-	// 2 - "Active" HACs
-	// 3 - The "next" inactive HAC
+	// Complete the static mesh builds that finished compiling asynchronously
+	FHoudiniStaticMeshBuildQueue::Get().Tick();
+
+	// Build a set of components that need to be processed.
+	// Instead of scanning every registered HAC, we only look at:
+	// - HACs that queued themselves (state, parameter, input or transform change)
+	// - HACs that were active or still loading last tick (they re-queue themselves below)
+	// - selected HACs
+	// - the "next" registered HAC (round robin), as a safety net for changes that aren't notified
 	TArray<UHoudiniAssetComponent*> ComponentsToProcess;
 	if (FHoudiniEngineRuntime::IsInitialized())
 	{
-		FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
+		FHoudiniEngineRuntime::Get().DequeueDirtyHoudiniComponents(ComponentsToProcess);
+
+#if WITH_EDITOR
+		// Selected HACs are always processed
+		if (GEditor)
+		{
+			for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+			{
+				AActor* SelectedActor = Cast<AActor>(*It);
+				if (!IsValid(SelectedActor))
+					continue;
+
+				TInlineComponentArray<UHoudiniAssetComponent*> SelectedComponents(SelectedActor);
+				for (UHoudiniAssetComponent* SelectedComponent : SelectedComponents)
+				{
+					if (IsValid(SelectedComponent) && SelectedComponent->IsRegisteredInRuntime())
+						ComponentsToProcess.AddUnique(SelectedComponent);
+				}
+			}
+		}
+#endif
 
 		//FScopeLock ScopeLock(&CriticalSection);
 		ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
@@ -170,94 +243,110 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		if (CurrentIndex >= ComponentCount)
 			CurrentIndex = 0;
 
-		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
+		if (ComponentCount > 0)
 		{
-			UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
-			if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+			UHoudiniAssetComponent* NextComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CurrentIndex);
+			if (!IsValid(NextComponent))
 			{
-				// Invalid component, do not process
-				continue;
+				// Stale components are cleaned up one at a time, as the round robin goes through them.
+				// The next component moves to the current index, so don't increment it.
+				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentIndex);
 			}
-			else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+			else
 			{
-				// Component being deleted, do not process
-				continue;
+				// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first in its group
+				NextComponent->LastTickTime = 0.0;
+				ComponentsToProcess.AddUnique(NextComponent);
+
+				// Increment the current index for the next tick
+				CurrentIndex++;
 			}
-			
+		}
+	}
+
+	// Filter the components that can't be processed this tick
+	for (int32 nIdx = ComponentsToProcess.Num() - 1; nIdx >= 0; nIdx--)
+	{
+		UHoudiniAssetComponent* CurrentComponent = ComponentsToProcess[nIdx];
+		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+		{
+			// Invalid component, do not process
+			ComponentsToProcess.RemoveAtSwap(nIdx);
+			continue;
+		}
+		else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+		{
+			// Component being deleted, do not process
+			ComponentsToProcess.RemoveAtSwap(nIdx);
+			continue;
+		}
+
+		{
+			UWorld* World = CurrentComponent->GetHACWorld();
+			if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
 			{
-				UWorld* World = CurrentComponent->GetHACWorld();
-				if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
+				if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
 				{
-					if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
-					{
-						// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
-						continue;
-					}
+					// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
+					// Keep it queued so it's processed once PIE ends.
+					FHoudiniEngineRuntime::MarkHoudiniComponentDirty(CurrentComponent);
+					ComponentsToProcess.RemoveAtSwap(nIdx);
+					continue;
 				}
 			}
+		}
 
+		if (!CurrentComponent->IsFullyLoaded())
+		{
+			// Let the component figure out whether it's fully loaded or not.
+			CurrentComponent->HoudiniEngineTick();
 			if (!CurrentComponent->IsFullyLoaded())
 			{
-				// Let the component figure out whether it's fully loaded or not.
-				CurrentComponent->HoudiniEngineTick();
-				if (!CurrentComponent->IsFullyLoaded())
-					continue; // We need to wait some more.
-			}
-
-			if (!CurrentComponent->IsValidComponent())
-			{
-				// This component is no longer valid. Prevent it from being processed, and remove it.
-				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+				// We need to wait some more.
+				FHoudiniEngineRuntime::MarkHoudiniComponentDirty(CurrentComponent);
+				ComponentsToProcess.RemoveAtSwap(nIdx);
 				continue;
 			}
-
-			AActor* Owner = CurrentComponent->GetOwner();
-			if (Owner && Owner->IsSelectedInEditor())
-			{
-				// 1. Add selected HACs
-				// If the component's owner is selected, add it to the set
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if (CurrentComponent->GetAssetState() != EHoudiniAssetState::NeedInstantiation
-				&& CurrentComponent->GetAssetState() != EHoudiniAssetState::None)
-			{
-				// 2. Add "Active" HACs, the only two non-active states are:
-				// NeedInstantiation (loaded, not instantiated in H yet, not modified)
-				// None (no processing currently)
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if(nIdx == CurrentIndex)
-			{
-				// 3. Add the "Current" HAC
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-
-			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
-			if (nIdx == CurrentIndex)
-			{
-				CurrentComponent->LastTickTime = 0.0;
-			}
 		}
 
-		// Increment the current index for the next tick
-		CurrentIndex++;
+		if (!CurrentComponent->IsValidComponent())
+		{
+			// This component is no longer valid. Prevent it from being processed, and remove it.
+			FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+			ComponentsToProcess.RemoveAtSwap(nIdx);
+			continue;
+		}
 	}
 
-	// Sort the components by last tick time
-	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B) { return A.LastTickTime < B.LastTickTime; });
+	// Sort the components by priority, then by last tick time
+	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B)
+	{
+		const int32 PriorityA = GetComponentProcessingPriority(&A);
+		const int32 PriorityB = GetComponentProcessingPriority(&B);
+		if (PriorityA != PriorityB)
+			return PriorityA < PriorityB;
+
+		return A.LastTickTime < B.LastTickTime;
+	});
 
 	// Time limit for processing
 	double dProcessTimeLimit = CVarHoudiniEngineTickTimeLimit.GetValueOnAnyThread();
 	double dProcessStartTime = FPlatformTime::Seconds();
 
 	// Process all the components in the list
-	for(UHoudiniAssetComponent* CurrentComponent : ComponentsToProcess)
+	for (int32 ProcessIdx = 0; ProcessIdx < ComponentsToProcess.Num(); ProcessIdx++)
 	{
+		UHoudiniAssetComponent* CurrentComponent = ComponentsToProcess[ProcessIdx];
+
 		double dNow = FPlatformTime::Seconds();
 		if (dProcessTimeLimit > 0.0
 			&& dNow - dProcessStartTime > dProcessTimeLimit)
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Manager: Stopped processing after %f seconds."), (dNow - dProcessStartTime));
+
+			// Queue the components we didn't get to for the next tick
+			for (int32 RemainingIdx = ProcessIdx; RemainingIdx < ComponentsToProcess.Num(); RemainingIdx++)
+				FHoudiniEngineRuntime::MarkHoudiniComponentDirty(ComponentsToProcess[RemainingIdx]);
 			break;
 		}
 
@@ -268,6 +357,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		// We don't want to the template component processing to trigger session creation
 		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
 		{
+			// Templates are polled for as long as they're in this state
+			FHoudiniEngineRuntime::MarkHoudiniComponentDirty(CurrentComponent);
+
 			if (CurrentComponent->IsTemplate() && !CurrentComponent->HasOpenEditor())
 			{
 				// This component template no longer has an open editor and can be deregistered.
@@ -310,8 +402,22 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			// See if we should start the default "first" session
 			AutoStartFirstSessionIfNeeded(CurrentComponent);
 
+			// Select the session this component will be cooked in
+			AssignSessionIfNeeded(CurrentComponent);
+
 			EHoudiniAssetState PrevState = CurrentComponent->GetAssetState();
-			ProcessComponent(CurrentComponent);
+			{
+				// All HAPI calls made while processing the component go to its session
+				FHoudiniEngineScopedSession ScopedSession(CurrentComponent->GetSessionIndex());
+
+				// Changes made while processing the component (parameter updates, output translation,
+				// input uploads...) are not user changes and must not make its cooks out of date,
+				// or a parameter driven by the HDA's own outputs would cancel every cook.
+				const bool bWasProcessing = FHoudiniEngineRuntime::IsProcessingHoudiniComponents();
+				FHoudiniEngineRuntime::SetProcessingHoudiniComponents(true);
+				ProcessComponent(CurrentComponent);
+				FHoudiniEngineRuntime::SetProcessingHoudiniComponents(bWasProcessing);
+			}
 			EHoudiniAssetState NewState = CurrentComponent->GetAssetState();
 
 			// In order to process components faster / with less ticks,
@@ -354,6 +460,12 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			// Update the tick time for this component
 			CurrentComponent->LastTickTime = dNow;
 		}
+
+		// Active components are waiting on a task or have more processing to do, 
+		// keep them queued until they're back to an idle state
+		if (IsComponentActive(CurrentComponent))
+			FHoudiniEngineRuntime::MarkHoudiniComponentDirty(CurrentComponent);
+
 #if WITH_EDITORONLY_DATA
 		// See if we need to update this HDA's details panel
 		if (CurrentComponent->bNeedToUpdateEditorProperties)
@@ -373,6 +485,8 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			// The node has to be deleted in the session it was created in
+			FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteSessionIndexAt(DeleteIdx));
 			FGuid HapiDeletionGUID;
 			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
@@ -464,6 +578,100 @@ FHoudiniEngineManager::AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InC
 	}
 }
 
+void
+FHoudiniEngineManager::AssignSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC)
+{
+	if (!IsValid(InCurrentHAC))
+		return;
+
+	FHoudiniEngineSessionPool* SessionPool = FHoudiniEngine::Get().GetSessionPool();
+	const int32 SessionIndex = InCurrentHAC->GetSessionIndex();
+	if (SessionIndex > 0 && (!SessionPool || !SessionPool->GetSession(SessionIndex)))
+	{
+		// The component's pool session is gone (session restart or pool disabled), go back to the main session
+		if (SessionPool)
+			SessionPool->UnpinObject(InCurrentHAC);
+		InCurrentHAC->SetSessionIndex(INDEX_NONE);
+	}
+
+	// HACs connected by asset inputs pass their node ids to each other, so they have to share a session.
+	// They are all kept in the main session.
+	TArray<UHoudiniAssetComponent*> LinkedHACs;
+	for (UHoudiniInput* CurrentInput : InCurrentHAC->GetInputs())
+	{
+		if (!IsValid(CurrentInput) || !CurrentInput->IsAssetInput())
+			continue;
+
+		const TArray<UHoudiniInputObject*>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInput->GetInputType());
+		if (!ObjectArray)
+			continue;
+
+		for (UHoudiniInputObject* CurrentInputObject : *ObjectArray)
+		{
+			UHoudiniAssetComponent* InputHAC = CurrentInputObject ? Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject()) : nullptr;
+			if (IsValid(InputHAC))
+				LinkedHACs.Add(InputHAC);
+		}
+	}
+
+	for (UHoudiniAssetComponent* DownstreamHAC : InCurrentHAC->GetDownstreamHoudiniAssets())
+	{
+		if (IsValid(DownstreamHAC))
+			LinkedHACs.Add(DownstreamHAC);
+	}
+
+	if (LinkedHACs.Num() > 0 && SessionPool && FHoudiniEngine::Get().IsSessionPoolEnabled())
+	{
+		for (UHoudiniAssetComponent* LinkedHAC : LinkedHACs)
+			MoveToMainSessionIfNeeded(LinkedHAC);
+
+		MoveToMainSessionIfNeeded(InCurrentHAC);
+		if (InCurrentHAC->GetSessionIndex() == INDEX_NONE && InCurrentHAC->GetAssetState() == EHoudiniAssetState::PreInstantiation)
+			InCurrentHAC->SetSessionIndex(SessionPool->PinObject(InCurrentHAC, 0));
+
+		return;
+	}
+
+	// Only assign sessions to components that are about to be instantiated
+	if (InCurrentHAC->GetSessionIndex() != INDEX_NONE
+		|| InCurrentHAC->GetAssetState() != EHoudiniAssetState::PreInstantiation
+		|| InCurrentHAC->GetAssetId() >= 0)
+		return;
+
+	if (!SessionPool || !FHoudiniEngine::Get().IsSessionPoolEnabled())
+		return;
+
+	// Node sync components work with the user's nodes in the main session
+	if (InCurrentHAC->IsA<UHoudiniNodeSyncComponent>())
+	{
+		InCurrentHAC->SetSessionIndex(SessionPool->PinObject(InCurrentHAC, 0));
+		return;
+	}
+
+	InCurrentHAC->SetSessionIndex(SessionPool->PinObject(InCurrentHAC));
+}
+
+void
+FHoudiniEngineManager::MoveToMainSessionIfNeeded(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC) || InHAC->GetSessionIndex() <= 0)
+		return;
+
+	if (InHAC->GetAssetState() == EHoudiniAssetState::PreInstantiation)
+	{
+		// The HAC's nodes, if any, have been deleted from the pool session by its rebuild
+		if (FHoudiniEngineSessionPool* SessionPool = FHoudiniEngine::Get().GetSessionPool())
+			SessionPool->PinObject(InHAC, 0);
+		InHAC->SetSessionIndex(0);
+	}
+	else if (InHAC->GetAssetState() == EHoudiniAssetState::None)
+	{
+		// The rebuild deletes the nodes in the pool session, since the HAC is processed in its current session
+		HOUDINI_LOG_MESSAGE(TEXT("%s is connected to other Houdini Assets, moving it to the main session."), *InHAC->GetDisplayName());
+		InHAC->MarkAsNeedRebuild();
+	}
+}
+
 void
 FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 {
@@ -505,6 +713,14 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		return;
 	}
 
+	// The session is being started in the background, wait for it before doing anything that needs it
+	if (FHoudiniEngine::Get().IsSessionWarmUpInProgress()
+		&& AssetStateToProcess != EHoudiniAssetState::NewHDA
+		&& AssetStateToProcess != EHoudiniAssetState::None)
+	{
+		return;
+	}
+
 	switch (AssetStateToProcess)
 	{
 		case EHoudiniAssetState::NeedInstantiation:
@@ -631,11 +847,19 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// Start recording the stats of this cook
+			HAC->CurrentCookStats = FHoudiniCookStats();
+			FHoudiniCookStatsScope CookStatsScope(&HAC->CurrentCookStats);
+
 			HAC->OnPrePreCook();
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
 			HAC->OnPostPreCook();
 
+			// Keep track of the parameter/input values used by this cook
+			HAC->CookedInputsVersion = HAC->CookInputsVersion;
+			HAC->bCookCancelRequested = false;
+
 			// Create a Cooking task only if necessary
 			bool bCookStarted = false;
 			if (IsCookingEnabledForHoudiniAsset(HAC))
@@ -657,6 +881,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					// Updates the HAC's state
 					HAC->SetAssetState(EHoudiniAssetState::Cooking);
 					HAC->HapiGUID = TaskGUID;
+					HAC->CookTaskStartTime = FPlatformTime::Seconds();
 					bCookStarted = true;
 				}
 			}
@@ -676,6 +901,18 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// If parameters or inputs have changed since the cook started, its results are already out of date.
+			// Interrupt it, so we can start cooking the new values right away instead of waiting for it to finish.
+			// The previous cook must not have been discarded already, so a steady stream of changes can't keep
+			// the HDA from ever finishing a cook.
+			if (CVarHoudiniEngineCancelOutOfDateCooks.GetValueOnAnyThread() > 0
+				&& HAC->IsCookOutOfDate() && HAC->CanDiscardOutOfDateCook()
+				&& !HAC->bCookCancelRequested && HAC->HapiGUID.IsValid())
+			{
+				FHoudiniEngine::Get().CancelTask(HAC->HapiGUID, HAC->GetSessionIndex());
+				HAC->bCookCancelRequested = true;
+			}
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
@@ -699,7 +936,20 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			HAC->HandleOnPreOutputProcessing();
 			HAC->OnPreOutputProcessing();
 			
-			if (PostCook(HAC, bSuccess, HAC->GetAssetId()))
+			bool bPostCookSuccess = false;
+			{
+				// Output fetch and mesh build are recorded separately, everything else is component update
+				FHoudiniCookStatsScope CookStatsScope(&HAC->CurrentCookStats);
+				FHoudiniCookStatsPhaseScope ComponentUpdateScope(EHoudiniCookStatsPhase::ComponentUpdate);
+				// The translators' temporaries are allocated linearly and all released once the outputs are processed.
+				// The arena holds those shared with the worker threads, the scope those of the game thread.
+				FHoudiniCookScratchArena ScratchArena;
+				FHoudiniCookScratchArenaScope ScratchArenaScope(&ScratchArena);
+				FHoudiniScratchScope ScratchScope;
+				bPostCookSuccess = PostCook(HAC, bSuccess, HAC->GetAssetId());
+			}
+
+			if (bPostCookSuccess)
 			{
 				// Cook was successful, process the results
 				NewState = EHoudiniAssetState::PreProcess;
@@ -709,6 +959,10 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				// Cook failed, skip output processing
 				NewState = EHoudiniAssetState::None;
 			}
+
+			HAC->CurrentCookStats.bOutputsProcessed = bPostCookSuccess;
+			HAC->CookStatsHistory.Add(HAC->CurrentCookStats);
+
 			HAC->SetAssetState(NewState);
 			break;
 		}
@@ -723,6 +977,10 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			UpdateProcess(HAC);
 
+			// The proxy meshes were just rebuilt: draw them dynamically until the cooks settle down
+			if (HAC->HasAnyCurrentProxyOutput())
+				HAC->SetProxyMeshesBeingUpdated(true);
+
 			HAC->HandleOnPostOutputProcessing();
 			HAC->OnPostOutputProcessing();
 			FHoudiniEngineUtils::UpdateBlueprintEditor(HAC);
@@ -731,6 +989,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::None:
 		{
+			HAC->UpdateProxyMeshesDrawPath();
+
 			// Update world inputs if we have any
 			FHoudiniInputTranslator::UpdateWorldInputs(HAC);
 
@@ -883,6 +1143,7 @@ FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset,
 	//Task.bLoadedComponent = bLocalLoadedComponent;
 	Task.AssetLibraryId = AssetLibraryId;
 	Task.AssetHapiName = PickedAssetName;
+	Task.SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 
 	FHoudiniEngineString(PickedAssetName).ToFString(OutHAPIAssetName);
 
@@ -959,6 +1220,22 @@ FHoudiniEngineManager::UpdateInstantiating(UHoudiniAssetComponent* HAC, EHoudini
 		bSuccess = false;
 	}
 
+	if (bSuccess && HAC->GetSessionIndex() > 0 && FHoudiniPDGManager::IsPDGAsset(TaskInfo.AssetId))
+	{
+		// PDG asset links are updated from the main session only, 
+		// delete the node from the pool session and instantiate the HDA again in the main session
+		HOUDINI_LOG_MESSAGE(TEXT("    %s is a PDG asset, moving it to the main session."), *DisplayName);
+
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(TaskInfo.AssetId, true, HAC->GetSessionIndex());
+
+		if (FHoudiniEngineSessionPool* SessionPool = FHoudiniEngine::Get().GetSessionPool())
+			SessionPool->PinObject(HAC, 0);
+		HAC->SetSessionIndex(0);
+
+		NewState = EHoudiniAssetState::PreInstantiation;
+		return true;
+	}
+
 	if (bSuccess)
 	{
 		HOUDINI_LOG_MESSAGE(TEXT("    %s FinishedInstantiation."), *DisplayName);
@@ -1102,6 +1379,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 
 	Task.bUseOutputNodes = bUseOutputNodes;
 	Task.bOutputTemplateGeos = bOutputTemplateGeos;
+	Task.SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 
 	FHoudiniEngine::Get().AddTask(Task);
 
@@ -1176,6 +1454,26 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	// If the task is still in progress, return now
 	if (!bUpdateState)
 		return false;
+
+	HAC->CurrentCookStats.AddPhaseTime(EHoudiniCookStatsPhase::Cook, FPlatformTime::Seconds() - HAC->CookTaskStartTime);
+
+	// A cancelled cook has no results to process and always has to be cooked again.
+	// If the cancellation arrived after the cook completed, the task isn't aborted: its results are processed.
+	const bool bCookWasCancelled = HAC->bCookCancelRequested && TaskInfo.TaskState == EHoudiniEngineTaskState::Aborted;
+	const bool bDiscardOutOfDateCook = !HAC->bCookCancelRequested
+		&& CVarHoudiniEngineCancelOutOfDateCooks.GetValueOnAnyThread() > 0 && HAC->IsCookOutOfDate() && HAC->CanDiscardOutOfDateCook();
+	HAC->bCookCancelRequested = false;
+	if (bCookWasCancelled || bDiscardOutOfDateCook)
+	{
+		// The results of this cook are already out of date, don't translate its outputs
+		// and cook again with the latest parameters and inputs instead.
+		HOUDINI_LOG_MESSAGE(TEXT("   %s Cook is out of date - skipping output processing and recooking."), *DisplayName);
+		HAC->CookStatsHistory.Add(HAC->CurrentCookStats);
+		HAC->bLastCookDiscarded = true;
+		NewState = EHoudiniAssetState::PreCook;
+		return true;
+	}
+	HAC->bLastCookDiscarded = false;
 	   
 	// Handle PostCook
 	NewState = EHoudiniAssetState::PostCook;
@@ -1232,7 +1530,10 @@ FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 	}
 
 	// Try to upload changed parameters
-	FHoudiniParameterTranslator::UploadChangedParameters(HAC);
+	{
+		FHoudiniCookStatsPhaseScope ParameterUploadScope(EHoudiniCookStatsPhase::ParameterUpload);
+		FHoudiniParameterTranslator::UploadChangedParameters(HAC);
+	}
 
 	// Try to upload changed inputs
 	FHoudiniInputTranslator::UploadChangedInputs(HAC);
@@ -1439,6 +1740,10 @@ FHoudiniEngineManager::StartTaskAssetDelete(const HAPI_NodeId& InNodeId, FGuid&
 	// Create asset deletion task object and submit it for processing.
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetDeletion, OutTaskGUID);
 	Task.AssetId = OBJNodeToDelete;
+	// Deletions stay in order with the instantiations and cooks: a lower priority could starve them,
+	// or run them after a later instantiation reusing the same node names.
+	Task.Priority = EHoudiniEngineTaskPriority::Normal;
+	Task.SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
@@ -170,6 +170,14 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Pins the HAC to one of the session pool's sessions before its instantiation
+	void AssignSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
+
+	// Moves a HAC cooked in a pool session to the main session.
+	// An idle HAC is rebuilt: its nodes are deleted from the pool session, and it is pinned to the main session
+	// when it is instantiated again. Busy HACs are moved once they are done.
+	void MoveToMainSessionIfNeeded(UHoudiniAssetComponent* InHAC);
+
 private:
 
 	// Ticker handle, used for processing HAC.
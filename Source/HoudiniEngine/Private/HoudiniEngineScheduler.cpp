@@ -27,47 +27,28 @@
 #include "HoudiniEngineScheduler.h"
 
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniAsset.h"
+#include "HoudiniEngineCookWait.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
-
 // Update frequency in (ms) for polling the scheduler
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
+FHoudiniEngineScheduler::FHoudiniEngineScheduler(const int32& InSessionIndex)
 	: WakeUpEvent(FEventRef(EEventMode::AutoReset))
-	, Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+	, CookWakeUpEvent(FEventRef(EEventMode::AutoReset))
+	, CurrentTaskType(EHoudiniEngineTaskType::None)
 	, bStopping(false)
+	, SessionIndex(InSessionIndex)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
-	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
-	}
 }
 
 void
@@ -192,6 +173,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
 
 	// We need to spin until instantiation is finished.
+	FHoudiniEngineCookWait CookWait(CookWakeUpEvent.Get());
 	while (true)
 	{
 		int Status = HAPI_STATE_STARTING_COOK;
@@ -263,7 +245,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		}
 
 		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		CookWait.Wait();
 	}
 }
 
@@ -323,8 +305,14 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 
 	EHoudiniEngineTaskState GlobalTaskResult = EHoudiniEngineTaskState::Success;
+	bool bCancelled = false;
 	for (auto& CurrentNodeId : NodesToCook)
 	{
+		// Don't cook the remaining nodes if the task has been cancelled
+		bCancelled = ConsumeTaskCancellation(Task.HapiGUID);
+		if (bCancelled)
+			break;
+
 		Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentNodeId, &CookOptions);
 		if (Result != HAPI_RESULT_SUCCESS)
 		{
@@ -350,6 +338,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		double LastUpdateTime = FPlatformTime::Seconds();
 
 		// We need to spin until cooking is finished.
+		FHoudiniEngineCookWait CookWait(CookWakeUpEvent.Get());
 		while (true)
 		{
 			int32 Status = HAPI_STATE_STARTING_COOK;
@@ -408,10 +397,24 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 			}
 
 			// We want to yield.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			CookWait.Wait();
 		}
 	}	
 
+	if (bCancelled || ConsumeTaskCancellation(Task.HapiGUID))
+	{
+		// The cook has been interrupted, or is out of date: its results should not be used.
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Aborted,
+			AssetId,
+			Task,
+			TEXT("Cook Cancelled"));
+
+		return;
+	}
+
 	switch (GlobalTaskResult)
 	{
 		case EHoudiniEngineTaskState::Success:
@@ -473,6 +476,21 @@ FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 	// At this point component most likely does not exist.
 }
 
+void
+FHoudiniEngineScheduler::TaskLoadAssetLibrary(const FHoudiniEngineTask & Task)
+{
+	// The asset may have been garbage collected since the task was queued
+	UHoudiniAsset* HoudiniAsset = Task.Asset.Get();
+	if (IsValid(HoudiniAsset) && FHoudiniEngine::Get().GetSession())
+	{
+		// Loading the library caches its id in the session
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+		FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset, AssetLibraryId);
+	}
+
+	// We do not insert task info as this is a fire and forget operation.
+}
+
 void
 FHoudiniEngineScheduler::AddResponseTaskInfo(
 	HAPI_Result Result, EHoudiniEngineTaskType TaskType, EHoudiniEngineTaskState TaskState,
@@ -507,21 +525,32 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 	{
 		while (true)
 		{
+			// Retrieve the next task, by priority.
 			FHoudiniEngineTask Task;
-
+			if (!Tasks.Dequeue(Task))
 			{
-				FScopeLock ScopeLock(&CriticalSection);
+				// No task can be cancelled anymore
+				FScopeLock ScopeLock(&CancellationLock);
+				CancelledTasks.Empty();
+				break;
+			}
 
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
+			if (ConsumeTaskCancellation(Task.HapiGUID))
+			{
+				// The task has been cancelled before it started, skip it.
+				AddResponseMessageTaskInfo(
+					HAPI_RESULT_SUCCESS,
+					Task.TaskType,
+					EHoudiniEngineTaskState::Aborted,
+					Task.AssetId, Task, TEXT("Cancelled"));
 
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
+				continue;
+			}
 
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
+			{
+				FScopeLock ScopeLock(&CancellationLock);
+				CurrentTaskGUID = Task.HapiGUID;
+				CurrentTaskType = Task.TaskType;
 			}
 
 			bool bTaskProcessed = true;
@@ -552,6 +581,12 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 					break;
 				}
 
+				case EHoudiniEngineTaskType::AssetLibraryLoad:
+				{
+					TaskLoadAssetLibrary(Task);
+					break;
+				}
+
 				default:
 				{
 					bTaskProcessed = false;
@@ -559,6 +594,13 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 				}
 			}
 
+			{
+				FScopeLock ScopeLock(&CancellationLock);
+				CurrentTaskGUID.Invalidate();
+				CurrentTaskType = EHoudiniEngineTaskType::None;
+				CancelledTasks.Remove(Task.HapiGUID);
+			}
+
 			if (!bTaskProcessed)
 				break;
 		}
@@ -630,64 +672,14 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 
 bool FHoudiniEngineScheduler::HasPendingTasks()
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	return !Tasks.IsEmpty();
 }
 
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
-
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (!Buffer)
-			return;
-
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
-
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
-
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
-
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
-	}
-
 	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
-
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	Tasks.Enqueue(Task);
 
 	// Wake up the thread to process the task.
 	WakeUpEvent->Trigger();
@@ -696,19 +688,58 @@ FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 uint32
 FHoudiniEngineScheduler::Run()
 {
+	FHoudiniEngineScopedSession ScopedSession(SessionIndex);
 	ProcessQueuedTasks();
 	return 0;
 }
 
+void
+FHoudiniEngineScheduler::CancelTask(const FGuid& InTaskGUID)
+{
+	if (!InTaskGUID.IsValid())
+		return;
+
+	FScopeLock ScopeLock(&CancellationLock);
+	CancelledTasks.Add(InTaskGUID);
+
+	if (CurrentTaskGUID == InTaskGUID && CurrentTaskType == EHoudiniEngineTaskType::AssetCooking)
+	{
+		// The task is cooking, interrupt the cook in this scheduler's session.
+		// The cook status will then report the cook as finished, and the task will be aborted.
+		FHoudiniEngineScopedSession ScopedSession(SessionIndex);
+		FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession());
+		WakeUpCookWait();
+	}
+}
+
+bool
+FHoudiniEngineScheduler::ConsumeTaskCancellation(const FGuid& InTaskGUID)
+{
+	if (!InTaskGUID.IsValid())
+		return false;
+
+	FScopeLock ScopeLock(&CancellationLock);
+	return CancelledTasks.Remove(InTaskGUID) > 0;
+}
+
+void
+FHoudiniEngineScheduler::WakeUpCookWait()
+{
+	CookWakeUpEvent->Trigger();
+}
+
 void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+	WakeUpEvent->Trigger();
+	CookWakeUpEvent->Trigger();
 }
 
 void
 FHoudiniEngineScheduler::Tick()
 {
+	FHoudiniEngineScopedSession ScopedSession(SessionIndex);
 	ProcessQueuedTasks();
 }
 
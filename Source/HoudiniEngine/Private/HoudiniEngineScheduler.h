@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniEngineTaskQueue.h"
 #include "HAL/Event.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
@@ -37,7 +38,8 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
 
-	FHoudiniEngineScheduler();
+	// InSessionIndex is the index of the session this scheduler's tasks are processed in
+	FHoudiniEngineScheduler(const int32& InSessionIndex = 0);
 	virtual ~FHoudiniEngineScheduler();
 
 	// FRunnable methods.
@@ -50,9 +52,18 @@ public:
 
 	bool HasPendingTasks();
 
-	// Adds a task.
+	// Adds a task. Can be called from any thread, the task is never dropped.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Cancels a task. If the task is currently cooking, the cook is interrupted via HAPI_Interrupt.
+	// If it hasn't started yet, it is skipped when dequeued. In both cases, the task finishes
+	// with the Aborted state. Can be called from any thread.
+	void CancelTask(const FGuid& InTaskGUID);
+
+	// Wakes up the scheduler thread if it is currently waiting for a cook to complete,
+	// so the cook status is polled again immediately.
+	void WakeUpCookWait();
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -92,32 +103,39 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
-private:
+	// Load an HDA's library in this scheduler's session.
+	void TaskLoadAssetLibrary(const FHoudiniEngineTask & Task);
+
+	// Returns true if the task has been cancelled, and stops tracking its cancellation.
+	bool ConsumeTaskCancellation(const FGuid& InTaskGUID);
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
+private:
 
 	// Frequency update (sleep time between each update)
 	static const float UpdateFrequency;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
-
 	// Event to wake up thread when tasks become available. 
 	FEventRef WakeUpEvent;
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
+	// Event to wake up thread when it is waiting for a cook to complete.
+	FEventRef CookWakeUpEvent;
 
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Queue of scheduled tasks, ordered by priority.
+	FHoudiniEngineTaskQueue Tasks;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Guards the current and cancelled task GUIDs.
+	FCriticalSection CancellationLock;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// GUID and type of the task currently being processed.
+	FGuid CurrentTaskGUID;
+	EHoudiniEngineTaskType CurrentTaskType;
+
+	// Tasks that have been cancelled before or while being processed.
+	TSet<FGuid> CancelledTasks;
 
 	// Stopping flag. 
 	bool bStopping;
+
+	// Index of the session used by this scheduler's tasks
+	int32 SessionIndex;
 };
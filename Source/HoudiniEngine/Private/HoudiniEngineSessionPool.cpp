@@ -0,0 +1,422 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineSessionPool.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineScheduler.h"
+#include "HoudiniEngineTask.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/RunnableThread.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+FHoudiniEngineSessionPool::FHoudiniEngineSessionPool()
+{
+}
+
+FHoudiniEngineSessionPool::~FHoudiniEngineSessionPool()
+{
+	StopSessions();
+	RetiredSessions.Empty();
+}
+
+int32
+FHoudiniEngineSessionPool::StartSessions(
+	const int32& InNumSessions,
+	const EHoudiniRuntimeSettingsSessionType& SessionType,
+	const FString& ServerPipeName,
+	const int32& ServerPort,
+	const FString& ServerHost,
+	const float& AutomaticServerTimeout)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineSessionPool::StartSessions);
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+		return 0;
+
+	if (SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe
+		&& SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket)
+	{
+		HOUDINI_LOG_WARNING(TEXT("The Houdini Engine session pool requires named pipe or socket sessions."));
+		return 0;
+	}
+
+	HAPI_ThriftServerOptions ServerOptions;
+	FMemory::Memzero<HAPI_ThriftServerOptions>(ServerOptions);
+	ServerOptions.autoClose = true;
+	ServerOptions.timeoutMs = AutomaticServerTimeout;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+
+	// Each pool session gets its own server, on a pipe or port that isn't used by the main session.
+	// Start all the servers first, so the HARS processes start up concurrently
+	struct FPoolServer
+	{
+		FString PipeName;
+		int32 Port = INDEX_NONE;
+	};
+
+	TArray<FPoolServer> Servers;
+	TSet<int32> ReservedPorts;
+	ReservedPorts.Add(ServerPort);
+	for (int32 Idx = 0; Idx < InNumSessions; Idx++)
+	{
+		FPoolServer Server;
+		HAPI_Result Result = HAPI_RESULT_FAILURE;
+		if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+		{
+			// Pipe names include the process id, so other editor instances' pools don't collide with ours
+			Server.PipeName = FString::Printf(TEXT("%s_%d_%d"), *ServerPipeName, FPlatformProcess::GetCurrentProcessId(), NumServersStarted++);
+			Result = FHoudiniApi::StartThriftNamedPipeServer(&ServerOptions, TCHAR_TO_UTF8(*Server.PipeName), nullptr, nullptr);
+		}
+		else
+		{
+			Server.Port = FindFreePort(ReservedPorts);
+			if (Server.Port <= 0)
+			{
+				HOUDINI_LOG_ERROR(TEXT("Failed to start a Houdini Engine pool server - no free port available."));
+				continue;
+			}
+
+			ReservedPorts.Add(Server.Port);
+			Result = FHoudiniApi::StartThriftSocketServer(&ServerOptions, Server.Port, nullptr, nullptr);
+		}
+
+		if (Result != HAPI_RESULT_SUCCESS)
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to start a Houdini Engine pool server - %s"), *FHoudiniEngineUtils::GetConnectionError());
+			continue;
+		}
+
+		Servers.Add(Server);
+	}
+
+	int32 NumStarted = 0;
+	for (const FPoolServer& Server : Servers)
+	{
+		HAPI_Session NewSession;
+		NewSession.type = HAPI_SESSION_MAX;
+		NewSession.id = -1;
+
+		HAPI_Result Result = HAPI_RESULT_FAILURE;
+		if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+		{
+			Result = FHoudiniApi::CreateThriftNamedPipeSession(&NewSession, TCHAR_TO_UTF8(*Server.PipeName));
+		}
+		else
+		{
+			Result = FHoudiniApi::CreateThriftSocketSession(&NewSession, TCHAR_TO_UTF8(*ServerHost), Server.Port);
+		}
+
+		const int32 SessionIndex = GetNumPoolSessions() + 1;
+		if (Result != HAPI_RESULT_SUCCESS)
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine pool session %d - %s"),
+				SessionIndex, *FHoudiniEngineUtils::GetConnectionError());
+			continue;
+		}
+
+		Result = FHoudiniApi::Initialize(
+			&NewSession,
+			&CookOptions,
+			true,
+			HoudiniRuntimeSettings->CookingThreadStackSize,
+			TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+			TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
+			TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
+			TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
+			TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
+
+		if (Result != HAPI_RESULT_SUCCESS && Result != HAPI_RESULT_ALREADY_INITIALIZED)
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to initialize Houdini Engine pool session %d - %s"),
+				SessionIndex, *FHoudiniEngineUtils::GetErrorDescription(Result));
+			FHoudiniApi::CloseSession(&NewSession);
+			continue;
+		}
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetServerEnvString(&NewSession, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to set the client name of Houdini Engine pool session %d."), SessionIndex);
+		}
+
+		AddPoolSession(NewSession, false);
+		NumStarted++;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Started %d Houdini Engine pool sessions."), NumStarted);
+
+	return NumStarted;
+}
+
+int32
+FHoudiniEngineSessionPool::FindFreePort(const TSet<int32>& InReservedPorts)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem)
+		return INDEX_NONE;
+
+	// Let the OS pick a free port, the server is started right after so it is very unlikely to be taken in between
+	for (int32 Attempt = 0; Attempt < 8; Attempt++)
+	{
+		FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("HoudiniEngineSessionPoolPort"), false);
+		if (!Socket)
+			return INDEX_NONE;
+
+		TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+		Address->SetLoopbackAddress();
+		Address->SetPort(0);
+
+		int32 Port = INDEX_NONE;
+		if (Socket->Bind(*Address))
+			Port = Socket->GetPortNo();
+
+		Socket->Close();
+		SocketSubsystem->DestroySocket(Socket);
+
+		if (Port > 0 && !InReservedPorts.Contains(Port))
+			return Port;
+	}
+
+	return INDEX_NONE;
+}
+
+void
+FHoudiniEngineSessionPool::AddStandInSessions(const int32& InNumSessions)
+{
+	for (int32 Idx = 0; Idx < InNumSessions; Idx++)
+	{
+		HAPI_Session StandInSession;
+		StandInSession.type = HAPI_SESSION_MAX;
+		StandInSession.id = -1;
+
+		AddPoolSession(StandInSession, true);
+	}
+}
+
+void
+FHoudiniEngineSessionPool::AddPoolSession(const HAPI_Session& InSession, const bool& bInStandIn)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const int32 SessionIndex = PoolSessions.Num() + 1;
+
+	TUniquePtr<FPoolSession> PoolSession = MakeUnique<FPoolSession>();
+	PoolSession->Session = InSession;
+	PoolSession->bStandIn = bInStandIn;
+	PoolSession->Scheduler = new FHoudiniEngineScheduler(SessionIndex);
+	PoolSession->SchedulerThread = FRunnableThread::Create(
+		PoolSession->Scheduler, *FString::Printf(TEXT("HoudiniSchedulerThread_%d"), SessionIndex), 0, TPri_Normal);
+
+	PoolSessions.Add(MoveTemp(PoolSession));
+}
+
+void
+FHoudiniEngineSessionPool::StopSessions()
+{
+	// Take the sessions out of the pool before stopping the schedulers: the tasks they're 
+	// processing could otherwise block on our lock while we wait for their thread to complete.
+	TArray<TUniquePtr<FPoolSession>> SessionsToStop;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		SessionsToStop = MoveTemp(PoolSessions);
+		PoolSessions.Empty();
+		PinnedObjects.Empty();
+	}
+
+	for (TUniquePtr<FPoolSession>& PoolSessionPtr : SessionsToStop)
+	{
+		FPoolSession& PoolSession = *PoolSessionPtr;
+		if (PoolSession.Scheduler)
+			PoolSession.Scheduler->Stop();
+
+		if (PoolSession.SchedulerThread)
+		{
+			PoolSession.SchedulerThread->WaitForCompletion();
+			delete PoolSession.SchedulerThread;
+			PoolSession.SchedulerThread = nullptr;
+		}
+
+		if (PoolSession.Scheduler)
+		{
+			delete PoolSession.Scheduler;
+			PoolSession.Scheduler = nullptr;
+		}
+
+		if (!PoolSession.bStandIn 
+			&& FHoudiniApi::IsHAPIInitialized()
+			&& HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&PoolSession.Session))
+		{
+			FHoudiniApi::Cleanup(&PoolSession.Session);
+			FHoudiniApi::CloseSession(&PoolSession.Session);
+		}
+	}
+
+	// Session pointers returned by GetSession() may still be used by other threads, keep them valid:
+	// HAPI calls made with a closed session fail instead of reading freed memory.
+	FScopeLock ScopeLock(&CriticalSection);
+	RetiredSessions.Append(MoveTemp(SessionsToStop));
+}
+
+int32
+FHoudiniEngineSessionPool::GetNumPoolSessions() const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return PoolSessions.Num();
+}
+
+const HAPI_Session*
+FHoudiniEngineSessionPool::GetSession(const int32& InSessionIndex) const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const int32 PoolIndex = InSessionIndex - 1;
+	if (!PoolSessions.IsValidIndex(PoolIndex))
+		return nullptr;
+
+	return &PoolSessions[PoolIndex]->Session;
+}
+
+int32
+FHoudiniEngineSessionPool::PinObject(const UObject* InObject, const int32& InForcedSessionIndex)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const int32 NumSessions = PoolSessions.Num() + 1;
+
+	TWeakObjectPtr<const UObject> ObjectPtr(InObject);
+	if (const int32* FoundIndex = PinnedObjects.Find(ObjectPtr))
+	{
+		if (InForcedSessionIndex < 0 || InForcedSessionIndex == *FoundIndex)
+		{
+			// Already pinned, only keep the pin if the session still exists
+			if (*FoundIndex < NumSessions)
+				return *FoundIndex;
+		}
+	}
+
+	int32 SessionIndex = 0;
+	if (InForcedSessionIndex >= 0)
+	{
+		SessionIndex = FMath::Min(InForcedSessionIndex, NumSessions - 1);
+	}
+	else
+	{
+		RemoveStalePins();
+
+		// Pick the session with the least pinned objects
+		TArray<int32> PinCounts;
+		PinCounts.SetNumZeroed(NumSessions);
+		for (const auto& Pin : PinnedObjects)
+		{
+			if (PinCounts.IsValidIndex(Pin.Value))
+				PinCounts[Pin.Value]++;
+		}
+
+		for (int32 Idx = 1; Idx < NumSessions; Idx++)
+		{
+			if (PinCounts[Idx] < PinCounts[SessionIndex])
+				SessionIndex = Idx;
+		}
+	}
+
+	PinnedObjects.Add(ObjectPtr, SessionIndex);
+	return SessionIndex;
+}
+
+void
+FHoudiniEngineSessionPool::UnpinObject(const UObject* InObject)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	PinnedObjects.Remove(TWeakObjectPtr<const UObject>(InObject));
+}
+
+int32
+FHoudiniEngineSessionPool::GetNumPinnedObjects(const int32& InSessionIndex) const
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	int32 Count = 0;
+	for (const auto& Pin : PinnedObjects)
+	{
+		if (Pin.Value == InSessionIndex && Pin.Key.IsValid())
+			Count++;
+	}
+
+	return Count;
+}
+
+void
+FHoudiniEngineSessionPool::RemoveStalePins()
+{
+	for (auto It = PinnedObjects.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+}
+
+bool
+FHoudiniEngineSessionPool::AddTask(const int32& InSessionIndex, const FHoudiniEngineTask& InTask)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const int32 PoolIndex = InSessionIndex - 1;
+	if (!PoolSessions.IsValidIndex(PoolIndex) || !PoolSessions[PoolIndex]->Scheduler)
+		return false;
+
+	PoolSessions[PoolIndex]->Scheduler->AddTask(InTask);
+	return true;
+}
+
+void
+FHoudiniEngineSessionPool::CancelTask(const int32& InSessionIndex, const FGuid& InTaskGUID)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const int32 PoolIndex = InSessionIndex - 1;
+	if (!PoolSessions.IsValidIndex(PoolIndex) || !PoolSessions[PoolIndex]->Scheduler)
+		return;
+
+	PoolSessions[PoolIndex]->Scheduler->CancelTask(InTaskGUID);
+}
+
+FHoudiniEngineScopedSession::FHoudiniEngineScopedSession(const int32& InSessionIndex)
+	: PreviousSessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
+{
+	FHoudiniEngineRuntime::SetCurrentSessionIndex(InSessionIndex);
+}
+
+FHoudiniEngineScopedSession::~FHoudiniEngineScopedSession()
+{
+	FHoudiniEngineRuntime::SetCurrentSessionIndex(PreviousSessionIndex);
+}
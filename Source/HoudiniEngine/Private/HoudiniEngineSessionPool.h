@@ -0,0 +1,146 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Templates/UniquePtr.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FRunnableThread;
+class FHoudiniEngineScheduler;
+struct FHoudiniEngineTask;
+
+// Additional Houdini Engine sessions used to instantiate and cook multiple HDAs in parallel.
+// Session index 0 always refers to the main session owned by FHoudiniEngine, the sessions owned 
+// by the pool use the indices 1 to N. Each pool session has its own scheduler thread.
+// Since node ids are only valid in the session they were created in, objects using Houdini nodes
+// (typically HACs) are pinned to a session and must keep using it.
+class HOUDINIENGINE_API FHoudiniEngineSessionPool
+{
+	public:
+
+		FHoudiniEngineSessionPool();
+		~FHoudiniEngineSessionPool();
+
+		// Starts HARS processes and connects InNumSessions new sessions to them.
+		// Socket servers use free local ports, named pipe servers use pipe names unique to this process.
+		// Sessions whose server failed to start or to connect are skipped.
+		// Returns the number of sessions that were successfully started.
+		int32 StartSessions(
+			const int32& InNumSessions,
+			const EHoudiniRuntimeSettingsSessionType& SessionType,
+			const FString& ServerPipeName,
+			const int32& ServerPort,
+			const FString& ServerHost,
+			const float& AutomaticServerTimeout);
+
+		// Adds sessions that are not connected to a Houdini Engine server.
+		// Tasks sent to these sessions fail, but they can be used to test session assignment and task dispatch.
+		void AddStandInSessions(const int32& InNumSessions);
+
+		// Stops all the pool sessions and their scheduler, and releases all pinned objects.
+		void StopSessions();
+
+		// Returns the number of sessions owned by the pool (the main session is not included).
+		int32 GetNumPoolSessions() const;
+
+		// Returns the pool session for the given index.
+		// Returns null for the main session (0) or for invalid indices.
+		// The returned session stays valid until the pool is destroyed, even if the pool sessions are stopped.
+		const HAPI_Session* GetSession(const int32& InSessionIndex) const;
+
+		// Returns the index of the session the object is pinned to.
+		// If the object isn't pinned yet, it is pinned to the session with the least pinned objects,
+		// or to InForcedSessionIndex if it is valid.
+		int32 PinObject(const UObject* InObject, const int32& InForcedSessionIndex = INDEX_NONE);
+
+		// Releases the object's session
+		void UnpinObject(const UObject* InObject);
+
+		// Returns the number of live objects pinned to the given session
+		int32 GetNumPinnedObjects(const int32& InSessionIndex) const;
+
+		// Sends a task to the scheduler of the given pool session.
+		// Returns false if the session index is not a valid pool session.
+		bool AddTask(const int32& InSessionIndex, const FHoudiniEngineTask& InTask);
+
+		// Cancels a task sent to the given pool session.
+		void CancelTask(const int32& InSessionIndex, const FGuid& InTaskGUID);
+
+	private:
+
+		struct FPoolSession
+		{
+			HAPI_Session Session;
+
+			// Scheduler processing the tasks of this session, and its thread.
+			FHoudiniEngineScheduler* Scheduler = nullptr;
+			FRunnableThread* SchedulerThread = nullptr;
+
+			// Stand-in sessions are not connected to a server.
+			bool bStandIn = false;
+		};
+
+		// Creates the scheduler and its thread for a new pool session
+		void AddPoolSession(const HAPI_Session& InSession, const bool& bInStandIn);
+
+		// Removes pins of objects that have been destroyed
+		void RemoveStalePins();
+
+		// Returns a local port that is currently free and not in InReservedPorts, or INDEX_NONE.
+		static int32 FindFreePort(const TSet<int32>& InReservedPorts);
+
+		// Sessions owned by the pool, session N is stored at N - 1.
+		// Allocated individually so the session pointers stay valid when the pool grows.
+		TArray<TUniquePtr<FPoolSession>> PoolSessions;
+
+		// Sessions that were stopped, kept alive so their HAPI_Session pointers don't dangle
+		TArray<TUniquePtr<FPoolSession>> RetiredSessions;
+
+		// Session index for each pinned object
+		TMap<TWeakObjectPtr<const UObject>, int32> PinnedObjects;
+
+		// Number of named pipe servers started by the pool, used to give each a unique pipe name
+		int32 NumServersStarted = 0;
+
+		// Synchronization primitive.
+		mutable FCriticalSection CriticalSection;
+};
+
+// Sets the session used by the HAPI calls made on the current thread
+// (via FHoudiniEngine::GetSession()) for the lifetime of the scope.
+struct HOUDINIENGINE_API FHoudiniEngineScopedSession
+{
+	FHoudiniEngineScopedSession(const int32& InSessionIndex);
+	~FHoudiniEngineScopedSession();
+
+	private:
+
+		int32 PreviousSessionIndex;
+};
@@ -32,6 +32,46 @@
 
 #include <vector>
 
+// The string table of the scope active on each thread
+static thread_local FHoudiniEngineStringTable* HoudiniCurrentStringTable = nullptr;
+
+// Fetches the strings of unique handles with a single string batch
+static bool
+HoudiniGetStringBatch(const TArray<int32>& InUniqueStringIds, TArray<FString>& OutStrings)
+{
+	OutStrings.Empty();
+
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS
+		!= FHoudiniApi::GetStringBatchSize(FHoudiniEngine::Get().GetSession(), InUniqueStringIds.GetData(),
+			InUniqueStringIds.Num(), &BufferSize))
+		return false;
+
+	if (BufferSize <= 0)
+		return false;
+
+	TArray<char> Buffer;
+	Buffer.SetNumZeroed(BufferSize);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
+		return false;
+
+	// Parse the buffer to a string array
+	OutStrings.Reserve(InUniqueStringIds.Num());
+	int32 StringOffset = 0;
+	while (StringOffset < BufferSize && OutStrings.Num() < InUniqueStringIds.Num())
+	{
+		OutStrings.Add(UTF8_TO_TCHAR(&Buffer[StringOffset]));
+
+		// Move on to next indexed string
+		while (StringOffset < BufferSize && Buffer[StringOffset] != 0)
+			StringOffset++;
+
+		StringOffset++;
+	}
+
+	return OutStrings.Num() == InUniqueStringIds.Num();
+}
+
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
 {}
@@ -116,6 +156,18 @@ bool
 FHoudiniEngineString::ToFName(FName& Name) const
 {
 	Name = NAME_None;
+
+	// Reuse the interned name if a string table is active
+	if (FHoudiniEngineStringTable* Table = FHoudiniEngineStringTable::GetCurrent())
+	{
+		FString InternedString;
+		if (!ToFString(InternedString))
+			return false;
+
+		Name = Table->GetName(Table->FindIndex(StringId));
+		return true;
+	}
+
 	FString NameString = TEXT("");
 	if (ToFString(NameString))
 	{
@@ -130,6 +182,25 @@ bool
 FHoudiniEngineString::ToFString(FString& String) const
 {
 	String = TEXT("");
+
+	FHoudiniEngineStringTable* Table = FHoudiniEngineStringTable::GetCurrent();
+	if (Table && StringId > 0)
+	{
+		// Only call HAPI if the handle hasn't been resolved during this cook
+		int32 Index = Table->FindIndex(StringId);
+		if (Index == INDEX_NONE)
+		{
+			std::string NamePlain = "";
+			if (!ToStdString(NamePlain))
+				return false;
+
+			Index = Table->Add(StringId, UTF8_TO_TCHAR(NamePlain.c_str()));
+		}
+
+		String = Table->GetString(Index);
+		return true;
+	}
+
 	std::string NamePlain = "";
 
 	if (ToStdString(NamePlain))
@@ -187,6 +258,23 @@ FHoudiniEngineString::ToFText(const int32& InStringId, FText& OutText)
 bool
 FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
+	FHoudiniEngineStringTable* Table = FHoudiniEngineStringTable::GetCurrent();
+	if (Table)
+	{
+		// Only the handles that haven't been resolved during this cook are fetched from HAPI
+		TSet<int32> UniqueSH;
+		UniqueSH.Append(InStringIdArray);
+		const bool bReturn = Table->Resolve(UniqueSH.Array());
+
+		OutStringArray.SetNum(InStringIdArray.Num());
+		for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+		{
+			OutStringArray[IdxSH] = Table->GetString(Table->FindIndex(InStringIdArray[IdxSH]));
+		}
+
+		return bReturn;
+	}
+
 	if (SHArrayToFStringArray_Batch(InStringIdArray, OutStringArray))
 		return true;
 
@@ -194,61 +282,77 @@ FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray
 }
 
 bool
-FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+FHoudiniEngineString::SHArrayToIndexedStrings(
+	const TArray<int32>& InStringIdArray, TArray<FString>& OutUniqueStrings, TArray<int32>& OutIndices)
 {
-    bool bReturn = true;
-    OutStringArray.SetNumZeroed(InStringIdArray.Num());
+	OutUniqueStrings.Empty();
+	OutIndices.SetNumUninitialized(InStringIdArray.Num());
 
-    TSet<int32> UniqueSH;
-    for (const auto& CurrentSH : InStringIdArray)
-    {
-        UniqueSH.Add(CurrentSH);
-    }
+	// Use the active string table, or a temporary one for this array only
+	FHoudiniEngineStringTable LocalTable;
+	FHoudiniEngineStringTable* Table = FHoudiniEngineStringTable::GetCurrent();
+	if (!Table)
+		Table = &LocalTable;
 
-    TArray<int32> UniqueSHArray = UniqueSH.Array();
-
-    int32 BufferSize = 0;
-    if (HAPI_RESULT_SUCCESS
-        != FHoudiniApi::GetStringBatchSize(FHoudiniEngine::Get().GetSession(), UniqueSHArray.GetData(),
-                                           UniqueSHArray.Num(), &BufferSize))
-        return false;
+	TArray<int32> UniqueSHArray;
+	{
+		TSet<int32> UniqueSH;
+		UniqueSH.Append(InStringIdArray);
+		UniqueSHArray = UniqueSH.Array();
+	}
+	const bool bReturn = Table->Resolve(UniqueSHArray);
 
-    if (BufferSize <= 0)
-        return false;
+	// Maps the table's indices to indices in OutUniqueStrings.
+	// Handles resolving to the same text share the same table index, so strings are only added once
+	TMap<int32, int32> TableIndexToUniqueIndex;
+	TableIndexToUniqueIndex.Reserve(UniqueSHArray.Num());
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		const int32 TableIndex = Table->FindIndex(InStringIdArray[IdxSH]);
+		const int32* FoundUniqueIndex = TableIndexToUniqueIndex.Find(TableIndex);
+		if (FoundUniqueIndex)
+		{
+			OutIndices[IdxSH] = *FoundUniqueIndex;
+		}
+		else
+		{
+			OutIndices[IdxSH] = OutUniqueStrings.Add(Table->GetString(TableIndex));
+			TableIndexToUniqueIndex.Add(TableIndex, OutIndices[IdxSH]);
+		}
+	}
 
-    TArray<char> Buffer;
-    Buffer.SetNumZeroed(BufferSize);
-    if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
-        return false;
+	return bReturn;
+}
 
-    // Parse the buffer to a string array
-    TMap<int, FString> StringMap;
-    int Index = 0;
-    int StringOffset = 0;
-    while (StringOffset < BufferSize)
-    {
-        // Add the current string to our dictionary.
-        FString StringValue = UTF8_TO_TCHAR(& Buffer[StringOffset]);
-        StringMap.Add(UniqueSHArray[Index], StringValue);
+bool
+FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	OutStringArray.SetNumZeroed(InStringIdArray.Num());
 
-        // Move on to next indexed string
-        Index++;
-        while (Buffer[StringOffset] != 0 && StringOffset < BufferSize)
-            StringOffset++;
+	TSet<int32> UniqueSH;
+	for (const auto& CurrentSH : InStringIdArray)
+	{
+		UniqueSH.Add(CurrentSH);
+	}
 
-        StringOffset++;
-    }
+	TArray<int32> UniqueSHArray = UniqueSH.Array();
+	TArray<FString> UniqueStrings;
+	if (!HoudiniGetStringBatch(UniqueSHArray, UniqueStrings))
+		return false;
 
-    if (StringMap.Num() != UniqueSH.Num())
-        return false;
+	TMap<int, FString> StringMap;
+	for (int32 Index = 0; Index < UniqueSHArray.Num(); Index++)
+	{
+		StringMap.Add(UniqueSHArray[Index], UniqueStrings[Index]);
+	}
 
-    // Fill the output array using the map
-    for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
-    {
-        OutStringArray[IdxSH] = StringMap[InStringIdArray[IdxSH]];
-    }
+	// Fill the output array using the map
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		OutStringArray[IdxSH] = StringMap[InStringIdArray[IdxSH]];
+	}
 
-    return true;
+	return true;
 }
 
 bool
@@ -281,6 +385,110 @@ FHoudiniEngineString::SHArrayToFStringArray_Singles(const TArray<int32>& InStrin
 	return bReturn;
 }
 
+int32
+FHoudiniEngineStringTable::FindIndex(const HAPI_StringHandle& InStringId) const
+{
+	const int32* FoundIndex = StringIdToIndex.Find(InStringId);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
+}
+
+bool
+FHoudiniEngineStringTable::Resolve(const TArray<HAPI_StringHandle>& InUniqueStringIds)
+{
+	TArray<HAPI_StringHandle> MissingStringIds;
+	for (const HAPI_StringHandle& CurrentSH : InUniqueStringIds)
+	{
+		if (!StringIdToIndex.Contains(CurrentSH))
+			MissingStringIds.Add(CurrentSH);
+	}
+
+	if (MissingStringIds.Num() <= 0)
+		return true;
+
+	TArray<FString> MissingStrings;
+	if (HoudiniGetStringBatch(MissingStringIds, MissingStrings))
+	{
+		for (int32 Idx = 0; Idx < MissingStringIds.Num(); Idx++)
+			Add(MissingStringIds[Idx], MissingStrings[Idx]);
+
+		return true;
+	}
+
+	// The batch failed, resolve the handles one by one
+	bool bReturn = true;
+	for (const HAPI_StringHandle& CurrentSH : MissingStringIds)
+	{
+		std::string NamePlain = "";
+		if (!FHoudiniEngineString::ToStdString(CurrentSH, NamePlain))
+			bReturn = false;
+
+		Add(CurrentSH, UTF8_TO_TCHAR(NamePlain.c_str()));
+	}
+
+	return bReturn;
+}
+
+int32
+FHoudiniEngineStringTable::Add(const HAPI_StringHandle& InStringId, const FString& InString)
+{
+	int32 Index = INDEX_NONE;
+	if (const int32* FoundIndex = StringToIndex.Find(InString))
+	{
+		Index = *FoundIndex;
+	}
+	else
+	{
+		Index = Strings.Add(InString);
+		StringToIndex.Add(InString, Index);
+	}
+
+	StringIdToIndex.Add(InStringId, Index);
+	return Index;
+}
+
+FName
+FHoudiniEngineStringTable::GetName(const int32& InIndex)
+{
+	if (!Strings.IsValidIndex(InIndex))
+		return NAME_None;
+
+	if (Names.Num() < Strings.Num())
+		Names.SetNum(Strings.Num());
+
+	if (Names[InIndex].IsNone() && !Strings[InIndex].IsEmpty())
+		Names[InIndex] = FName(*Strings[InIndex]);
+
+	return Names[InIndex];
+}
+
+void
+FHoudiniEngineStringTable::Empty()
+{
+	StringIdToIndex.Empty();
+	StringToIndex.Empty();
+	Strings.Empty();
+	Names.Empty();
+}
+
+FHoudiniEngineStringTable*
+FHoudiniEngineStringTable::GetCurrent()
+{
+	return HoudiniCurrentStringTable;
+}
+
+FHoudiniEngineStringTableScope::FHoudiniEngineStringTableScope()
+	: bIsOutermost(HoudiniCurrentStringTable == nullptr)
+{
+	if (bIsOutermost)
+		HoudiniCurrentStringTable = &Table;
+}
+
+FHoudiniEngineStringTableScope::~FHoudiniEngineStringTableScope()
+{
+	if (bIsOutermost)
+		HoudiniCurrentStringTable = nullptr;
+}
+
 const FString& FHoudiniEngineIndexedStringMap::GetStringForIndex(int Index) const
 {
     StringId Id = Ids[Index];
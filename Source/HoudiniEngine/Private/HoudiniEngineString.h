@@ -29,9 +29,9 @@
 #include <string>
 #include "HoudiniApi.h"
 #include "Containers/Map.h"
+#include "UObject/NameTypes.h"
 class FText;
 class FString;
-class FName;
 
 class HOUDINIENGINE_API FHoudiniEngineString
 {
@@ -67,6 +67,12 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		// Array converter, uses a map to reduce HAPI calls
 		static bool SHArrayToFStringArray_Singles(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Array converter returning each unique string once, in order of first appearance,
+		// and for each handle the index of its string in OutUniqueStrings.
+		// Avoids allocating one FString per handle for attributes with few unique values.
+		static bool SHArrayToIndexedStrings(
+			const TArray<int32>& InStringIdArray, TArray<FString>& OutUniqueStrings, TArray<int32>& OutIndices);
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -79,6 +85,69 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		int32 StringId;
 };
 
+// Interns the strings resolved from HAPI string handles.
+// Each handle is resolved at most once, and handles resolving to the same text share the same string.
+// HAPI string handles are only guaranteed to stay valid until the next cook, so a table should only
+// be kept for the duration of a cook, see FHoudiniEngineStringTableScope.
+class HOUDINIENGINE_API FHoudiniEngineStringTable
+{
+	public:
+
+		// Returns the index of the string interned for a handle, or INDEX_NONE if the handle hasn't been resolved yet.
+		int32 FindIndex(const HAPI_StringHandle& InStringId) const;
+
+		// Resolves the handles that are not interned yet, using string batches to reduce HAPI calls.
+		// Returns false if some of the handles couldn't be resolved, those are interned as empty strings.
+		bool Resolve(const TArray<HAPI_StringHandle>& InUniqueStringIds);
+
+		// Interns the string of a handle, and returns the index of the string.
+		int32 Add(const HAPI_StringHandle& InStringId, const FString& InString);
+
+		const FString& GetString(const int32& InIndex) const { return Strings[InIndex]; };
+
+		// Returns the FName for an interned string, the name is only created the first time it is requested.
+		FName GetName(const int32& InIndex);
+
+		// Number of unique strings
+		int32 Num() const { return Strings.Num(); };
+
+		// Number of handles that have been resolved
+		int32 NumHandles() const { return StringIdToIndex.Num(); };
+
+		void Empty();
+
+		// Returns the table of the scope active on the calling thread, if any.
+		static FHoudiniEngineStringTable* GetCurrent();
+
+	private:
+
+		// Strings returned by HAPI are case sensitive
+		struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+		{
+			static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+			static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+			static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+		};
+
+		TMap<HAPI_StringHandle, int32> StringIdToIndex;
+		TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> StringToIndex;
+		TArray<FString> Strings;
+		TArray<FName> Names;
+};
+
+// Interns all the HAPI strings resolved by the calling thread for the lifetime of the scope.
+// Nested scopes share the table of the outermost scope.
+struct HOUDINIENGINE_API FHoudiniEngineStringTableScope
+{
+	FHoudiniEngineStringTableScope();
+	~FHoudiniEngineStringTableScope();
+
+	private:
+
+		FHoudiniEngineStringTable Table;
+		bool bIsOutermost;
+};
+
 class FHoudiniEngineRawStrings
 {
 public:
@@ -30,12 +30,14 @@
 
 FHoudiniEngineTask::FHoudiniEngineTask()
 	: TaskType(EHoudiniEngineTaskType::None)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
 	, ActorName(TEXT(""))
 	, AssetId(-1)
 	, bUseOutputNodes(false)
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(0)
 {
 	HapiGUID.Invalidate();
 	OtherNodeIds.Empty();
@@ -44,12 +46,14 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid InHapiGUID)
 	: HapiGUID(InHapiGUID)
 	, TaskType(InTaskType)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
 	, ActorName(TEXT(""))
 	, AssetId(-1)
 	, bUseOutputNodes(false)
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(0)
 {
 	OtherNodeIds.Empty();
 }
@@ -66,6 +66,24 @@ enum class EHoudiniEngineTaskType : uint8
 
 	// This type is used when processing the results of a sucessful cook
 	AssetProcess,
+
+	// This type is used to load an HDA's library in a session ahead of its instantiation.
+	AssetLibraryLoad,
+};
+
+UENUM()
+enum class EHoudiniEngineTaskPriority : uint8
+{
+	// Processed before any other task.
+	High,
+
+	// Default priority, used by instantiation, cook and deletion tasks.
+	Normal,
+
+	// Processed once there are no other tasks left.
+	Low,
+
+	Count UMETA(Hidden)
 };
 
 struct HOUDINIENGINE_API FHoudiniEngineTask
@@ -80,6 +98,9 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// Type of this task.
 	EHoudiniEngineTaskType TaskType;
 
+	// Priority of this task in the scheduler's queue.
+	EHoudiniEngineTaskPriority Priority;
+
 	// Houdini asset for instantiation.
 	TWeakObjectPtr< class UHoudiniAsset > Asset;
 
@@ -104,6 +125,9 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Index of the session the task should be processed in (0 is the main session).
+	int32 SessionIndex;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
@@ -0,0 +1,70 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniEngineTaskQueue.h"
+
+FHoudiniEngineTaskQueue::FHoudiniEngineTaskQueue()
+	: NumTasks(0)
+{
+}
+
+void
+FHoudiniEngineTaskQueue::Enqueue(const FHoudiniEngineTask& InTask)
+{
+	const int32 PriorityIndex = FMath::Clamp(static_cast<int32>(InTask.Priority), 0, NumPriorities - 1);
+
+	// Increment the count first so it never goes negative if the consumer dequeues the task right away
+	NumTasks.Increment();
+	Queues[PriorityIndex].Enqueue(InTask);
+}
+
+bool
+FHoudiniEngineTaskQueue::Dequeue(FHoudiniEngineTask& OutTask)
+{
+	for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities; PriorityIndex++)
+	{
+		if (Queues[PriorityIndex].Dequeue(OutTask))
+		{
+			NumTasks.Decrement();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+FHoudiniEngineTaskQueue::IsEmpty() const
+{
+	return NumTasks.GetValue() <= 0;
+}
+
+int32
+FHoudiniEngineTaskQueue::Num() const
+{
+	return NumTasks.GetValue();
+}
@@ -0,0 +1,68 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HoudiniEngineTask.h"
+
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeCounter.h"
+
+// Task queue used by the scheduler.
+// Tasks can be added from any thread without locking (multiple producers), but must only be
+// retrieved by the scheduler's thread (single consumer). The queue grows as needed, so tasks
+// are never dropped or overwritten, regardless of how many are queued at once.
+// Tasks are retrieved by priority, and in the order they were added for a same priority.
+class HOUDINIENGINE_API FHoudiniEngineTaskQueue
+{
+public:
+
+	FHoudiniEngineTaskQueue();
+
+	// Adds a task to the queue. Can be called from any thread.
+	void Enqueue(const FHoudiniEngineTask& InTask);
+
+	// Retrieves the next task to process. Must only be called from the consumer thread.
+	// Returns false if the queue is empty.
+	bool Dequeue(FHoudiniEngineTask& OutTask);
+
+	// Returns true if there are no tasks in the queue.
+	bool IsEmpty() const;
+
+	// Returns the number of queued tasks.
+	int32 Num() const;
+
+private:
+
+	static constexpr int32 NumPriorities = static_cast<int32>(EHoudiniEngineTaskPriority::Count);
+
+	// One lock-free queue per priority.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> Queues[NumPriorities];
+
+	// Number of queued tasks, for all priorities.
+	FThreadSafeCounter NumTasks;
+};
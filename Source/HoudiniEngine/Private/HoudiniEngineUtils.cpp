@@ -43,13 +43,18 @@
 #include "HoudiniAssetActor.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineAssetLibraryCache.h"
+#include "HoudiniEngineCookWait.h"
 #include "HoudiniEngineEditorSettings.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineTimers.h"
+#include "HoudiniEngineVectorConversion.h"
+#include "HoudiniCookStats.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniInput.h"
@@ -62,6 +67,7 @@
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "BlueprintEditor.h"
 #include "Editor/EditorEngine.h"
 #include "Editor/UnrealEdEngine.h"
@@ -467,6 +473,7 @@ FHoudiniEngineUtils::GetCookLog(TArray<UHoudiniAssetComponent*>& InHACs)
 			continue;
 
 		// Get the node errors, warnings and messages
+		FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HAC));
 		FString NodeErrors = FHoudiniEngineUtils::GetNodeErrorsWarningsAndMessages(HAC->GetAssetId());
 		if (NodeErrors.IsEmpty())
 			continue;
@@ -520,6 +527,7 @@ FHoudiniEngineUtils::GetAssetHelp(UHoudiniAssetComponent* HoudiniAssetComponent)
 	if (AssetId < 0)
 		return HelpString;
 
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HoudiniAssetComponent));
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(
 		FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo), HelpString);
 
@@ -545,6 +553,7 @@ FHoudiniEngineUtils::GetAssetHelpURL(UHoudiniAssetComponent* HoudiniAssetCompone
 	if (AssetId < 0)
 		return HelpString;
 
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HoudiniAssetComponent));
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(
 		FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo), HelpString);
 
@@ -1695,6 +1704,29 @@ FHoudiniEngineUtils::LocateLibHAPIInRegistry(
 }
 #endif
 
+FString
+FHoudiniEngineUtils::GetHoudiniAssetFilePath(const UHoudiniAsset* HoudiniAsset)
+{
+	if (!IsValid(HoudiniAsset))
+		return FString();
+
+	// Get the HDA's file path, using the AssetImportData if we have it
+	FString AssetFileName = (HoudiniAsset->AssetImportData != nullptr) ? HoudiniAsset->AssetImportData->GetFirstFilename() : HoudiniAsset->GetAssetFileName();
+	// We need to convert relative file path to absolute
+	if (FPaths::IsRelative(AssetFileName))
+		AssetFileName = FPaths::ConvertRelativePathToFull(AssetFileName);
+
+	// We need to modify the file name for expanded .hdas
+	FString FileExtension = FPaths::GetExtension(AssetFileName);
+	if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
+	{
+		// the .hda directory is what we should be loading
+		AssetFileName = FPaths::GetPath(AssetFileName);
+	}
+
+	return AssetFileName;
+}
+
 bool
 FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId& OutAssetLibraryId)
 {
@@ -1705,10 +1737,14 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	if (!IsValid(HoudiniAsset))
 		return false;
 
+	// Libraries can be preloaded from a worker thread, the session state can only be changed from the game thread
+	const bool bCanUpdateSession = IsInGameThread();
+
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
 		// If we're not initialized now, it likely means the session has been lost
-		FHoudiniEngine::Get().OnSessionLost();
+		if (bCanUpdateSession)
+			FHoudiniEngine::Get().OnSessionLost();
 		return false;
 	}
 
@@ -1718,19 +1754,7 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	if (HoudiniRuntimeSettings)
 		bMemoryCopyFirst = HoudiniRuntimeSettings->bPreferHdaMemoryCopyOverHdaSourceFile;
 
-	// Get the HDA's file path, using the AssetImportData if we have it
-	FString AssetFileName = (HoudiniAsset->AssetImportData != nullptr) ? HoudiniAsset->AssetImportData->GetFirstFilename() : HoudiniAsset->GetAssetFileName();
-	// We need to convert relative file path to absolute
-	if (FPaths::IsRelative(AssetFileName))
-		AssetFileName = FPaths::ConvertRelativePathToFull(AssetFileName);
-
-	// We need to modify the file name for expanded .hdas
-	FString FileExtension = FPaths::GetExtension(AssetFileName);
-	if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
-	{
-		// the .hda directory is what we should be loading
-		AssetFileName = FPaths::GetPath(AssetFileName);
-	}
+	FString AssetFileName = GetHoudiniAssetFilePath(HoudiniAsset);
 
 	//Check whether we can Load from file/memory
 	bool bCanLoadFromMemory = (!HoudiniAsset->IsExpandedHDA() && HoudiniAsset->GetAssetBytesCount() > 0);
@@ -1746,10 +1770,19 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		}
 	}
 
+	// See if a library with the same content has already been loaded in this session
+	const bool bLoadFromFile = bCanLoadFromFile && (!bMemoryCopyFirst || !bCanLoadFromMemory);
+	const FString LibraryKey = FHoudiniEngineAssetLibraryCache::GetLibraryKey(HoudiniAsset, bLoadFromFile);
+	const int32 SessionIndex = FMath::Max(FHoudiniEngineRuntime::GetCurrentSessionIndex(), 0);
+	FHoudiniEngineAssetLibraryCache& LibraryCache = FHoudiniEngine::Get().GetAssetLibraryCache();
+	OutAssetLibraryId = LibraryCache.FindLibrary(SessionIndex, LibraryKey);
+	if (OutAssetLibraryId >= 0)
+		return true;
+
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
 
 	// Lambda to detect license issues
-	auto CheckLicenseValid = [&AssetFileName](const HAPI_Result& Result)
+	auto CheckLicenseValid = [&AssetFileName, bCanUpdateSession](const HAPI_Result& Result)
 	{
 		// HoudiniEngine acquires a license when creating/loading a node, not when creating a session
 		if (Result >= HAPI_RESULT_NO_LICENSE_FOUND && Result < HAPI_RESULT_ASSET_INVALID)
@@ -1757,12 +1790,15 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 			FString ErrorDesc = GetErrorDescription(Result);
 			HOUDINI_LOG_ERROR(TEXT("Error loading Asset %s: License failed: %s."), *AssetFileName, *ErrorDesc);
 
-			// We must stop the session to prevent further attempts at loading an HDA
-			// as this could lead to unreal becoming stuck and unresponsive due to license timeout
-			FHoudiniEngine::Get().StopSession();
+			if (bCanUpdateSession)
+			{
+				// We must stop the session to prevent further attempts at loading an HDA
+				// as this could lead to unreal becoming stuck and unresponsive due to license timeout
+				FHoudiniEngine::Get().StopSession();
 
-			// Set the HE status to "no license"
-			FHoudiniEngine::Get().SetSessionStatus(EHoudiniSessionStatus::NoLicense);
+				// Set the HE status to "no license"
+				FHoudiniEngine::Get().SetSessionStatus(EHoudiniSessionStatus::NoLicense);
+			}
 
 			return false;
 		}
@@ -1870,6 +1906,8 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		return false;
 	}
 
+	LibraryCache.AddLibrary(SessionIndex, LibraryKey, OutAssetLibraryId);
+
 	return true;
 }
 
@@ -1881,6 +1919,12 @@ FHoudiniEngineUtils::GetSubAssetNames(
 	if (AssetLibraryId < 0)
 		return false;
 
+	// The names of a loaded library's assets don't change
+	const int32 SessionIndex = FMath::Max(FHoudiniEngineRuntime::GetCurrentSessionIndex(), 0);
+	FHoudiniEngineAssetLibraryCache& LibraryCache = FHoudiniEngine::Get().GetAssetLibraryCache();
+	if (LibraryCache.FindSubAssetNames(SessionIndex, AssetLibraryId, OutAssetNames))
+		return true;
+
 	int32 AssetCount = 0;
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
 	Result = FHoudiniApi::GetAvailableAssetCount(FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetCount);
@@ -1910,6 +1954,8 @@ FHoudiniEngineUtils::GetSubAssetNames(
 		return false;
 	}
 
+	LibraryCache.AddSubAssetNames(SessionIndex, AssetLibraryId, OutAssetNames);
+
 	return true;
 }
 
@@ -2846,6 +2892,100 @@ FHoudiniEngineUtils::TranslateHapiTransform(const HAPI_TransformEuler& HapiTrans
 	FHoudiniEngineUtils::TranslateHapiTransform(HapiTransformQuat, UnrealTransform);
 }
 
+bool
+FHoudiniEngineUtils::HapiGetInstanceTransforms(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const int32& InCount,
+	TArray<FTransform>& OutTransforms,
+	const int32 InChunkSize)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	auto FetchTransforms = [Session, &InGeoId, &InPartId](const int32 InStart, const int32 InChunkCount, HAPI_Transform* OutHapiTransforms)
+	{
+		return HAPI_RESULT_SUCCESS == FHoudiniApi::GetInstanceTransformsOnPart(
+			Session, InGeoId, InPartId, HAPI_SRT, OutHapiTransforms, InStart, InChunkCount);
+	};
+
+	if (!HapiGetTransformsPipelined(FetchTransforms, InCount, OutTransforms, InChunkSize))
+		return false;
+
+	FHoudiniCookStats::AddBytesReceived(sizeof(HAPI_Transform) * static_cast<int64>(InCount));
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetTransformsPipelined(
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, HAPI_Transform* OutTransforms)> InFetcher,
+	const int32& InCount,
+	TArray<FTransform>& OutTransforms,
+	const int32 InChunkSize)
+{
+	if (InCount <= 0)
+		return false;
+
+	const int32 ChunkSize = InChunkSize > 0 ? InChunkSize : FMath::Max<int32>(THRIFT_MAX_CHUNKSIZE / sizeof(HAPI_Transform), 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(InCount, ChunkSize);
+
+	// Double buffering: chunk N is translated from one buffer while chunk N+1 is fetched in the other
+	TArray<HAPI_Transform> Buffers[2];
+	const int32 NumBuffers = NumChunks > 1 ? 2 : 1;
+	for (int32 BufferIndex = 0; BufferIndex < NumBuffers; BufferIndex++)
+		Buffers[BufferIndex].SetNumZeroed(FMath::Min(ChunkSize, InCount));
+
+	OutTransforms.SetNumUninitialized(InCount);
+
+	auto GetChunkCount = [InCount, ChunkSize](const int32& InChunkIndex)
+	{
+		return FMath::Min(ChunkSize, InCount - InChunkIndex * ChunkSize);
+	};
+
+	auto FetchChunk = [&InFetcher, &Buffers, &GetChunkCount, ChunkSize](const int32 InChunkIndex)
+	{
+		return InFetcher(InChunkIndex * ChunkSize, GetChunkCount(InChunkIndex), Buffers[InChunkIndex % 2].GetData());
+	};
+
+	auto TranslateChunk = [&Buffers, &OutTransforms, &GetChunkCount, ChunkSize](const int32 InChunkIndex)
+	{
+		// Translate in batches, a single transform is too little work for a task
+		const int32 BatchSize = 1024;
+		const int32 ChunkCount = GetChunkCount(InChunkIndex);
+		const HAPI_Transform* HapiTransforms = Buffers[InChunkIndex % 2].GetData();
+		FTransform* UnrealTransforms = OutTransforms.GetData() + InChunkIndex * ChunkSize;
+		ParallelFor(FMath::DivideAndRoundUp(ChunkCount, BatchSize), [&](const int32 BatchIndex)
+		{
+			const int32 End = FMath::Min((BatchIndex + 1) * BatchSize, ChunkCount);
+			for (int32 Idx = BatchIndex * BatchSize; Idx < End; Idx++)
+				TranslateHapiTransform(HapiTransforms[Idx], UnrealTransforms[Idx]);
+		});
+	};
+
+	bool bChunkFetched = FetchChunk(0);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		if (!bChunkFetched)
+		{
+			OutTransforms.Empty();
+			return false;
+		}
+
+		if (ChunkIndex + 1 >= NumChunks)
+		{
+			TranslateChunk(ChunkIndex);
+			break;
+		}
+
+		// HAPI calls stay on this thread: translate the current chunk on a worker while fetching the next one
+		TFuture<void> Translation = Async(EAsyncExecution::ThreadPool, [&TranslateChunk, ChunkIndex]() { TranslateChunk(ChunkIndex); });
+		bChunkFetched = FetchChunk(ChunkIndex + 1);
+
+		// Always wait for the worker, it uses the buffers
+		Translation.Wait();
+	}
+
+	return true;
+}
+
 void
 FHoudiniEngineUtils::TranslateUnrealTransform(const FTransform& UnrealTransform, HAPI_Transform& HapiTransform)
 {
@@ -2944,22 +3084,35 @@ FHoudiniEngineUtils::TranslateUnrealTransform(
 	}
 }
 
-void
-FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector(const TArray<float>& InRawData, TArray<FVector>& OutVectorData)
+// Converts a float stream and widens it to FVectors, using a stack buffer for the converted floats
+static void
+HoudiniConvertToUnrealVectors(
+	const TArray<float>& InRawData, TArray<FVector>& OutVectorData,
+	void (*InConvert)(const float*, float*, const int32&))
 {
 	OutVectorData.SetNum(InRawData.Num() / 3);
 
-	for (int32 OutIndex = 0; OutIndex < OutVectorData.Num(); OutIndex++)
+	constexpr int32 BufferVectors = 256;
+	float Buffer[BufferVectors * 3];
+	for (int32 Start = 0; Start < OutVectorData.Num(); Start += BufferVectors)
 	{
-		const int32& InIndex = OutIndex * 3;
+		const int32 Count = FMath::Min(BufferVectors, OutVectorData.Num() - Start);
+		InConvert(InRawData.GetData() + Start * 3, Buffer, Count);
 
-		// Swap Y/Z and scale meters to centimeters
-		OutVectorData[OutIndex].X = (double)(InRawData[InIndex + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
-		OutVectorData[OutIndex].Y = (double)(InRawData[InIndex + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
-		OutVectorData[OutIndex].Z = (double)(InRawData[InIndex + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
+		for (int32 Idx = 0; Idx < Count; Idx++)
+		{
+			OutVectorData[Start + Idx] = FVector(Buffer[Idx * 3 + 0], Buffer[Idx * 3 + 1], Buffer[Idx * 3 + 2]);
+		}
 	}
 }
 
+void
+FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector(const TArray<float>& InRawData, TArray<FVector>& OutVectorData)
+{
+	// Swap Y/Z and scale meters to centimeters
+	HoudiniConvertToUnrealVectors(InRawData, OutVectorData, &FHoudiniEngineVectorConversion::HoudiniToUnrealPositions);
+}
+
 FVector3f
 FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector3f(const FVector3f& InVector)
 {
@@ -2974,17 +3127,8 @@ FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector3f(const FVector3f& InV
 void
 FHoudiniEngineUtils::ConvertHoudiniScaleToUnrealVector(const TArray<float>& InRawData, TArray<FVector>& OutVectorData)
 {
-	OutVectorData.SetNum(InRawData.Num() / 3);
-
-	for (int32 OutIndex = 0; OutIndex < OutVectorData.Num(); OutIndex++)
-	{
-		const int32& InIndex = OutIndex * 3;
-
-		// Just swap Y/Z
-		OutVectorData[OutIndex].X = (double)InRawData[InIndex + 0];
-		OutVectorData[OutIndex].Y = (double)InRawData[InIndex + 2];
-		OutVectorData[OutIndex].Z = (double)InRawData[InIndex + 1];
-	}
+	// Just swap Y/Z
+	HoudiniConvertToUnrealVectors(InRawData, OutVectorData, &FHoudiniEngineVectorConversion::SwapYZ);
 }
 
 void
@@ -2992,16 +3136,20 @@ FHoudiniEngineUtils::ConvertHoudiniRotQuatToUnrealVector(const TArray<float>& In
 {
 	OutVectorData.SetNum(InRawData.Num() / 4);
 
+	// Extract the quaternions: Swap Y/Z, invert W
+	TArray<float> QuatData;
+	QuatData.SetNumUninitialized(OutVectorData.Num() * 4);
+	FHoudiniEngineVectorConversion::ParallelConvertQuaternions(InRawData.GetData(), QuatData.GetData(), OutVectorData.Num());
+
 	for (int32 OutIndex = 0; OutIndex < OutVectorData.Num(); OutIndex++)
 	{
 		const int32& InIndex = OutIndex * 4;
 
-		// Extract a quaternion: Swap Y/Z, invert W
 		FQuat ObjectRotation(
-			(double)InRawData[InIndex + 0],
-			(double)InRawData[InIndex + 2],
-			(double)InRawData[InIndex + 1],
-			(double)-InRawData[InIndex + 3]);
+			(double)QuatData[InIndex + 0],
+			(double)QuatData[InIndex + 1],
+			(double)QuatData[InIndex + 2],
+			(double)QuatData[InIndex + 3]);
 
 		// Get Euler angles
 		OutVectorData[OutIndex] = ObjectRotation.Euler();
@@ -3011,17 +3159,8 @@ FHoudiniEngineUtils::ConvertHoudiniRotQuatToUnrealVector(const TArray<float>& In
 void
 FHoudiniEngineUtils::ConvertHoudiniRotEulerToUnrealVector(const TArray<float>& InRawData, TArray<FVector>& OutVectorData)
 {
-	OutVectorData.SetNum(InRawData.Num() / 3);
-
-	for (int32 OutIndex = 0; OutIndex < OutVectorData.Num(); OutIndex++)
-	{
-		const int32& InIndex = OutIndex * 3;
-
-		// Just swap Y/Z
-		OutVectorData[OutIndex].X = (double)InRawData[InIndex + 0];
-		OutVectorData[OutIndex].Y = (double)InRawData[InIndex + 2];
-		OutVectorData[OutIndex].Z = (double)InRawData[InIndex + 1];
-	}
+	// Just swap Y/Z
+	HoudiniConvertToUnrealVectors(InRawData, OutVectorData, &FHoudiniEngineVectorConversion::SwapYZ);
 }
 
 bool
@@ -3032,6 +3171,9 @@ FHoudiniEngineUtils::UploadHACTransform(UHoudiniAssetComponent* HAC)
 	if (!HAC || !HAC->bUploadTransformsToHoudiniEngine)
 		return false;
 
+	// The transform may be uploaded outside of the HAC's processing
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HAC));
+
 	// Indicates the HAC has been fully loaded
 	// TODO: Check! (replaces fullyloaded)
 	if (!HAC->IsFullyLoaded())
@@ -3520,6 +3662,7 @@ FHoudiniEngineUtils::HapiSetAttributeFloatData(
 				if (Result != HAPI_RESULT_SUCCESS)
 					return  Result;
 			}
+			FHoudiniCookStats::AddBytesSent(sizeof(float) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
 			return HAPI_RESULT_SUCCESS;
 		}
 	}
@@ -3552,9 +3695,123 @@ FHoudiniEngineUtils::HapiSetAttributeFloatData(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(float) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
+// Sends attribute data produced chunk by chunk.
+// The next chunk is produced on a worker thread while the current one is sent by InSendChunk, on the calling thread.
+template<typename TValue, typename TSendChunk>
+static HAPI_Result
+HapiSetAttributeDataPipelined(
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, TValue* OutValues)> InProducer,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	const int32 InChunkSize,
+	TSendChunk&& InSendChunk)
+{
+	if (InAttributeInfo.count <= 0 || InAttributeInfo.tupleSize < 1)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const int32 ChunkSize = InChunkSize > 0 ? InChunkSize : FMath::Max(THRIFT_MAX_CHUNKSIZE / InAttributeInfo.tupleSize, 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(InAttributeInfo.count, ChunkSize);
+
+	// Double buffering: chunk N is sent from one buffer while chunk N+1 is produced in the other
+	TArray<TValue> Buffers[2];
+	const int32 NumBuffers = NumChunks > 1 ? 2 : 1;
+	for (int32 BufferIndex = 0; BufferIndex < NumBuffers; BufferIndex++)
+		Buffers[BufferIndex].SetNumUninitialized(FMath::Min(ChunkSize, InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
+	auto GetChunkCount = [&InAttributeInfo, ChunkSize](const int32& InChunkIndex)
+	{
+		return FMath::Min(ChunkSize, InAttributeInfo.count - InChunkIndex * ChunkSize);
+	};
+
+	auto ProduceChunk = [&InProducer, &Buffers, &GetChunkCount, ChunkSize](const int32 InChunkIndex)
+	{
+		return InProducer(InChunkIndex * ChunkSize, GetChunkCount(InChunkIndex), Buffers[InChunkIndex % 2].GetData());
+	};
+
+	bool bChunkProduced = ProduceChunk(0);
+	HAPI_Result Result = HAPI_RESULT_FAILURE;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		if (!bChunkProduced)
+			return HAPI_RESULT_FAILURE;
+
+		TFuture<bool> NextChunk;
+		if (ChunkIndex + 1 < NumChunks)
+			NextChunk = Async(EAsyncExecution::ThreadPool, [&ProduceChunk, ChunkIndex]() { return ProduceChunk(ChunkIndex + 1); });
+
+		Result = InSendChunk(Buffers[ChunkIndex % 2].GetData(), ChunkIndex * ChunkSize, GetChunkCount(ChunkIndex));
+
+		// Always wait for the worker, it uses the buffers
+		bChunkProduced = NextChunk.IsValid() ? NextChunk.Get() : true;
+
+		if (Result != HAPI_RESULT_SUCCESS)
+			break;
+	}
+
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(TValue) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
+	return Result;
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, float* OutValues)> InProducer,
+	TFunctionRef<HAPI_Result(const float* InValues, const int32 InStart, const int32 InCount)> InSender,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	const int32 InChunkSize)
+{
+	return HapiSetAttributeDataPipelined<float>(InProducer, InAttributeInfo, InChunkSize, InSender);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiSetAttributeFloatDataStreamed(
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, float* OutValues)> InProducer,
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttributeName,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	const int32 InChunkSize)
+{
+	H_SCOPED_FUNCTION_DYNAMIC_LABEL(InAttributeName);
+
+	return HapiSetAttributeFloatDataPipelined(InProducer,
+		[&](const float* InValues, const int32 InStart, const int32 InCount)
+		{
+			return FHoudiniApi::SetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(),
+				InNodeId, InPartId, TCHAR_TO_ANSI(*InAttributeName),
+				&InAttributeInfo, InValues, InStart, InCount);
+		},
+		InAttributeInfo, InChunkSize);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiSetAttributeIntDataStreamed(
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, int32* OutValues)> InProducer,
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttributeName,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	const int32 InChunkSize)
+{
+	H_SCOPED_FUNCTION_DYNAMIC_LABEL(InAttributeName);
+
+	return HapiSetAttributeDataPipelined<int32>(InProducer, InAttributeInfo, InChunkSize,
+		[&](const int32* InValues, const int32 InStart, const int32 InCount)
+		{
+			return FHoudiniApi::SetAttributeIntData(
+				FHoudiniEngine::Get().GetSession(),
+				InNodeId, InPartId, TCHAR_TO_ANSI(*InAttributeName),
+				&InAttributeInfo, InValues, InStart, InCount);
+		});
+}
+
 HAPI_Result
 FHoudiniEngineUtils::HapiSetAttributeIntData(
 	const TArray<int32>& InIntData,
@@ -3648,6 +3905,7 @@ FHoudiniEngineUtils::HapiSetAttributeIntData(
                 if (Result != HAPI_RESULT_SUCCESS)
                     return Result;
             }
+            FHoudiniCookStats::AddBytesSent(sizeof(int32) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
             return HAPI_RESULT_SUCCESS;
         }
 	}
@@ -3681,6 +3939,9 @@ FHoudiniEngineUtils::HapiSetAttributeIntData(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int32) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -3765,6 +4026,9 @@ FHoudiniEngineUtils::HapiSetAttributeInt8Data(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int8) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -3825,6 +4089,9 @@ FHoudiniEngineUtils::HapiSetAttributeUInt8Data(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(uint8) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -3887,6 +4154,9 @@ FHoudiniEngineUtils::HapiSetAttributeInt16Data(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int16) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -4019,6 +4289,9 @@ FHoudiniEngineUtils::HapiSetAttributeInt64Data(
 #endif
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int64) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -4103,6 +4376,9 @@ FHoudiniEngineUtils::HapiSetAttributeDoubleData(
 			0, InAttributeInfo.count);
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(double) * static_cast<int64>(InAttributeInfo.count) * InAttributeInfo.tupleSize);
+
 	return Result;
 }
 
@@ -4141,6 +4417,9 @@ FHoudiniEngineUtils::HapiSetVertexList(
 			InNodeId, InPartId, InVertexListData.GetData(), 0, InVertexListData.Num());
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int32) * static_cast<int64>(InVertexListData.Num()));
+
 	return Result;
 }
 
@@ -4180,6 +4459,9 @@ FHoudiniEngineUtils::HapiSetFaceCounts(
 			InNodeId, InPartId, InFaceCounts.GetData(), 0, InFaceCounts.Num());
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(int32) * static_cast<int64>(InFaceCounts.Num()));
+
 	return Result;
 }
 
@@ -4438,6 +4720,9 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 			InNodeId, InPartId, NameStr.c_str(), HeightData, 0, InFloatValues.Num());
 	}
 
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniCookStats::AddBytesSent(sizeof(float) * static_cast<int64>(InFloatValues.Num()));
+
 	return Result;
 }
 
@@ -4636,6 +4921,35 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
 	int32& FirstValidVertex,
 	int32& FirstValidPrim,
 	const bool& isPackedPrim)
+{
+	// Get the faces membership for this group
+	bool bAllEquals = false;
+	TArray<int32> PartGroupMembership;
+	if (!FHoudiniEngineUtils::HapiGetGroupMembership(
+		GeoId, PartInfo, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership, bAllEquals))
+	{
+		AllFaceList.Empty();
+		FirstValidPrim = 0;
+		FirstValidVertex = 0;
+		return false;
+	}
+
+	return FHoudiniEngineUtils::GetVertexListForGroupMembership(
+		PartGroupMembership, FullVertexList, NewVertexList,
+		UsedVertices, AllFaceList, AllGroupFaceIndices,
+		FirstValidVertex, FirstValidPrim);
+}
+
+int32
+FHoudiniEngineUtils::GetVertexListForGroupMembership(
+	const TArray<int32>& PartGroupMembership,
+	const TArray<int32>& FullVertexList,
+	TArray<int32>& NewVertexList,
+	TArray<int32>& UsedVertices,
+	TArray<int32>& AllFaceList,
+	TArray<int32>& AllGroupFaceIndices,
+	int32& FirstValidVertex,
+	int32& FirstValidPrim)
 {
 	int32 ProcessedWedges = 0;
 	AllFaceList.Empty();
@@ -4646,13 +4960,6 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
 	for(int32 n = 0; n < NewVertexList.Num(); n++)
 		NewVertexList[n] = -1;
 
-	// Get the faces membership for this group
-	bool bAllEquals = false;
-	TArray<int32> PartGroupMembership;
-	if (!FHoudiniEngineUtils::HapiGetGroupMembership(
-		GeoId, PartInfo, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership, bAllEquals))
-		return false;
-
 	// Go through all primitives.
 	for (int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx)
 	{
@@ -4841,27 +5148,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), 
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -4898,6 +5186,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 			&AttributeInfo, -1, &OutData[0],
 			Start, Count), false);
 
+		FHoudiniCookStats::AddBytesReceived(sizeof(float) * static_cast<int64>(OutData.Num()));
 		return true;
 	}
     else if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT64)
@@ -4917,6 +5206,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 		for (int Index = 0; Index < OutData.Num(); Index++)
             OutData[Index] = static_cast<float>(Float64Data[Index]);
 
+		FHoudiniCookStats::AddBytesReceived(sizeof(double) * static_cast<int64>(Float64Data.Num()));
         return true;
     }
 	else if (AttributeInfo.storage == HAPI_STORAGETYPE_INT)
@@ -5054,6 +5344,65 @@ FHoudiniEngineUtils::HapiGetFirstAttributeValueAsString(
 }
 
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeFloatDataInto(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	const int32& InTupleSize,
+	float* OutData,
+	const int32& InStartIndex,
+	const int32& InCount)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeFloatDataInto"));
+
+	if (!InAttributeInfo.exists || InAttributeInfo.storage != HAPI_STORAGETYPE_FLOAT)
+		return false;
+
+	if (InTupleSize <= 0 || InTupleSize > InAttributeInfo.tupleSize)
+		return false;
+
+	if (InStartIndex < 0 || InCount < 0 || InStartIndex + InCount > InAttributeInfo.count)
+		return false;
+
+	if (InCount == 0)
+		return true;
+
+	// Only read the components the caller has room for
+	HAPI_AttributeInfo AttributeInfo = InAttributeInfo;
+	AttributeInfo.tupleSize = InTupleSize;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeFloatData(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, InAttribName,
+		&AttributeInfo, -1, OutData,
+		InStartIndex, InCount), false);
+
+	FHoudiniCookStats::AddBytesReceived(sizeof(float) * static_cast<int64>(InCount) * InTupleSize);
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsPositions(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeInfo& InAttributeInfo,
+	TArrayView<FVector3f> OutData,
+	const int32& InStartIndex)
+{
+	static_assert(sizeof(FVector3f) == 3 * sizeof(float), "FVector3f must be tightly packed");
+
+	float* OutFloats = reinterpret_cast<float*>(OutData.GetData());
+	if (!HapiGetAttributeFloatDataInto(InGeoId, InPartId, InAttribName, InAttributeInfo, 3, OutFloats, InStartIndex, OutData.Num()))
+		return false;
+
+	// Swap Y/Z and scale meters to centimeters, in place
+	FHoudiniEngineVectorConversion::ParallelHoudiniToUnrealPositions(OutFloats, OutFloats, OutData.Num());
+	return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	const HAPI_NodeId InGeoId,
@@ -5074,27 +5423,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -5130,6 +5460,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 			InGeoId, InPartId, InAttribName,
 			&AttributeInfo, -1, &OutData[0], Start, Count), false);
 
+		FHoudiniCookStats::AddBytesReceived(sizeof(int32) * static_cast<int64>(OutData.Num()));
 		return true;
 	}
 	else if (AttributeInfo.storage == HAPI_STORAGETYPE_INT16)
@@ -5259,27 +5590,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -5415,35 +5727,156 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
 	return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStringsFromInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	HAPI_AttributeInfo& InAttributeInfo,
+	TArray<FString>& OutUniqueValues,
+	TArray<int32>& OutIndices,
+	const int32& InStartIndex,
+	const int32& InCount)
+{
+	OutUniqueValues.Empty();
+	OutIndices.Empty();
+
+	if (!InAttributeInfo.exists || InAttributeInfo.storage != HAPI_STORAGETYPE_STRING)
+		return false;
+
+	// Handle partial reading of attributes
+	int32 Start = 0;
+	if (InStartIndex > 0 && InStartIndex < InAttributeInfo.count)
+		Start = InStartIndex;
+
+	int32 Count = InAttributeInfo.count;
+	if (InCount > 0)
+	{
+		if ((Start + InCount) <= InAttributeInfo.count)
+			Count = InCount;
+		else
+			Count = InAttributeInfo.count - Start;
+	}
+
+	if (Count * InAttributeInfo.tupleSize <= 0)
+		return true;
+
+	// Extract the StringHandles
+	TArray<HAPI_StringHandle> StringHandles;
+	StringHandles.Init(-1, Count * InAttributeInfo.tupleSize);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeStringData(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, InAttribName,
+		&InAttributeInfo, &StringHandles[0],
+		Start, Count), false);
+
+	// Only the unique strings are converted, the handles are replaced by indices into them
+	if (!FHoudiniEngineString::SHArrayToIndexedStrings(StringHandles, OutUniqueValues, OutIndices))
+	{
+		OutUniqueValues.Empty();
+		OutIndices.Empty();
+		return false;
+	}
+
+	return true;
+}
 
 bool
-FHoudiniEngineUtils::HapiCheckAttributeExists(
-	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
-	const char * AttribName, HAPI_AttributeOwner Owner)
+FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStrings(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<FString>& OutUniqueValues,
+	TArray<int32>& OutIndices,
+	HAPI_AttributeOwner InOwner)
 {
-	if (Owner == HAPI_ATTROWNER_INVALID)
+	OutAttributeInfo.exists = false;
+	OutUniqueValues.Empty();
+	OutIndices.Empty();
+
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
+
+	if (!AttributeInfo.exists)
+		return false;
+
+	// Store the retrieved attribute information.
+	OutAttributeInfo = AttributeInfo;
+
+	if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING)
+	{
+		return FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStringsFromInfo(
+			InGeoId, InPartId, InAttribName, AttributeInfo, OutUniqueValues, OutIndices);
+	}
+
+	// Numeric attributes are converted value by value
+	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+		InGeoId, InPartId, InAttribName, AttributeInfo, OutUniqueValues, 0, AttributeInfo.owner))
+	{
+		return false;
+	}
+
+	OutIndices.SetNumUninitialized(OutUniqueValues.Num());
+	for (int32 Idx = 0; Idx < OutIndices.Num(); Idx++)
+		OutIndices[Idx] = Idx;
+
+	return true;
+}
+
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+
+	// Look the attribute up in its part's catalog first, if the geo has been cataloged
+	if (FHoudiniEngine::Get().GetAttributeCatalog().FindAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, OutAttributeInfo))
+		return true;
+
+	if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
-		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
-			if (HapiCheckAttributeExists(GeoId, PartId, AttribName, (HAPI_AttributeOwner)OwnerIdx))
-			{
-				return true;
-			}
+			FHoudiniCookStats::AddAttributeLookupRoundTrips(1);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				InGeoId, InPartId, InAttribName,
+				(HAPI_AttributeOwner)AttrIdx, &OutAttributeInfo), false);
+
+			if (OutAttributeInfo.exists)
+				break;
 		}
 	}
 	else
 	{
-		HAPI_AttributeInfo AttribInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-
+		FHoudiniCookStats::AddAttributeLookupRoundTrips(1);
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(),
-			GeoId, PartId, AttribName, Owner, &AttribInfo), false);
-
-		return AttribInfo.exists;
+			InGeoId, InPartId, InAttribName,
+			InOwner, &OutAttributeInfo), false);
 	}
 
-	return false;
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCheckAttributeExists(
+	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
+	const char * AttribName, HAPI_AttributeOwner Owner)
+{
+	HAPI_AttributeInfo AttribInfo;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(GeoId, PartId, AttribName, Owner, AttribInfo))
+		return false;
+
+	return AttribInfo.exists;
 }
 
 bool
@@ -8533,6 +8966,7 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 
 	// Wait for the cook to finish
 	HAPI_Result Result = HAPI_RESULT_SUCCESS;
+	FHoudiniEngineCookWait CookWait;
 	while (true)
 	{
 		// Get the current cook status
@@ -8554,7 +8988,7 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 		}
 
 		// We want to yield a bit.
-		FPlatformProcess::Sleep(0.1f);
+		CookWait.Wait();
 	}
 }
 
@@ -159,6 +159,24 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// HAPI : Translate HAPI Euler transform to Unreal one.
 		static void TranslateHapiTransform(const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform);
 
+		// HAPI : Fetches InCount instance transforms of a part and translates them to Unreal ones.
+		// See HapiGetTransformsPipelined for the chunking.
+		static bool HapiGetInstanceTransforms(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const int32& InCount,
+			TArray<FTransform>& OutTransforms,
+			const int32 InChunkSize = -1);
+
+		// Fetches HAPI transforms in chunks of InChunkSize (thrift's limit by default) and translates them to Unreal ones.
+		// InFetcher is called on the calling thread, while the previously fetched chunk is translated in parallel
+		// on worker threads, so only two chunks of HAPI transforms are ever staged in memory.
+		static bool HapiGetTransformsPipelined(
+			TFunctionRef<bool(const int32 InStart, const int32 InCount, HAPI_Transform* OutTransforms)> InFetcher,
+			const int32& InCount,
+			TArray<FTransform>& OutTransforms,
+			const int32 InChunkSize = -1);
+
 		// HAPI : Translate Unreal transform to HAPI one.
 		static void TranslateUnrealTransform(const FTransform & UnrealTransform, HAPI_Transform & HapiTransform);
 
@@ -262,6 +280,18 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			int32& FirstValidPrim,
 			const bool& isPackedPrim);
 
+		// Same as HapiGetVertexListForGroup, but uses an already fetched prim group membership.
+		// This doesn't make any HAPI call and can be used from any thread.
+		static int32 GetVertexListForGroupMembership(
+			const TArray<int32>& InGroupMembership,
+			const TArray<int32>& FullVertexList,
+			TArray<int32>& NewVertexList,
+			TArray<int32>& AllVertexList,
+			TArray<int32>& AllFaceList,
+			TArray<int32>& AllGroupFaceIndices,
+			int32& FirstValidVertex,
+			int32& FirstValidPrim);
+
 		// HAPI : Get attribute data as float.
 		static bool HapiGetAttributeDataAsFloat(
 			const HAPI_NodeId& InGeoId,
@@ -274,6 +304,29 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const int32& InStartIndex = 0,
 			const int32& InCount = -1);
 
+		// HAPI : Get float attribute data straight into caller-owned storage, without any intermediate copy.
+		// OutData must have room for InCount * InTupleSize floats. Only float storage is supported.
+		static bool HapiGetAttributeFloatDataInto(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeInfo& InAttributeInfo,
+			const int32& InTupleSize,
+			float* OutData,
+			const int32& InStartIndex,
+			const int32& InCount);
+
+		// HAPI : Get positions straight into caller-owned storage, such as a mesh description's position
+		// array or a UHoudiniStaticMesh's vertex buffer. OutData.Num() values are read, starting at InStartIndex.
+		// Positions are converted to Unreal's coordinate system in place.
+		static bool HapiGetAttributeDataAsPositions(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeInfo& InAttributeInfo,
+			TArrayView<FVector3f> OutData,
+			const int32& InStartIndex = 0);
+
 		// HAPI : Get attribute data as Integer.
 		static bool HapiGetAttributeDataAsInteger(
 			const HAPI_NodeId InGeoId,
@@ -308,6 +361,38 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const int32& InStartIndex = 0,
 			const int32& InCount = -1);
 
+		// HAPI : Get string attribute data as its unique values, in order of first appearance,
+		// and for each value of the attribute the index of its string in OutUniqueValues.
+		static bool HapiGetAttributeDataAsIndexedStringsFromInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			HAPI_AttributeInfo& InAttributeInfo,
+			TArray<FString>& OutUniqueValues,
+			TArray<int32>& OutIndices,
+			const int32& InStartIndex = 0,
+			const int32& InCount = -1);
+
+		// HAPI : Get attribute data as unique string values and per-element indices, see HapiGetAttributeDataAsIndexedStringsFromInfo.
+		// Attributes that aren't stored as strings are converted by HapiGetAttributeDataAsString, each of their values is then unique.
+		static bool HapiGetAttributeDataAsIndexedStrings(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			HAPI_AttributeInfo& OutAttributeInfo,
+			TArray<FString>& OutUniqueValues,
+			TArray<int32>& OutIndices,
+			HAPI_AttributeOwner InOwner = HAPI_ATTROWNER_INVALID);
+
+		// HAPI : Get the info of an attribute, from its part's attribute catalog if available.
+		// If InOwner is HAPI_ATTROWNER_INVALID, returns the info of the first owner the attribute exists on.
+		static bool HapiGetAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
 		// HAPI : Check if given attribute exists.
 		static bool HapiCheckAttributeExists(
 			const HAPI_NodeId& GeoId,
@@ -402,12 +487,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// Deletes the specified HAPI node by id.
 		static bool DeleteHoudiniNode(const HAPI_NodeId& InNodeId);
 
+		// Returns the absolute path of the HDA file/directory a Houdini Asset is loaded from
+		static FString GetHoudiniAssetFilePath(const UHoudiniAsset* HoudiniAsset);
+
 		// Loads an HDA file and returns its AssetLibraryId
+		// A library is only loaded once per session, following calls for the same content return the cached AssetLibraryId
 		static bool LoadHoudiniAsset(
 			const UHoudiniAsset * HoudiniAsset,
 			HAPI_AssetLibraryId & OutAssetLibraryId);
 		
-		// Returns the name of the available subassets in a loaded HDA
+		// Returns the name of the available subassets in a loaded HDA, cached per session
 		static bool GetSubAssetNames(
 			const HAPI_AssetLibraryId& AssetLibraryId,
 			TArray< HAPI_StringHandle > & OutAssetNames);
@@ -464,6 +553,27 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const FString& InAttributeName,
 			const HAPI_AttributeInfo& InAttributeInfo);
 
+		// Helper function to stream float attribute data
+		// InProducer fills the InCount * tupleSize values of the InCount elements starting at InStart.
+		// The data is sent in chunks of InChunkSize elements (thrift's limit by default): the next chunk is produced 
+		// on a worker thread while the current one is being sent, so only two chunks are ever staged in memory.
+		// InProducer must not call HAPI, and returns false to abort the upload.
+		static HAPI_Result HapiSetAttributeFloatDataStreamed(
+			TFunctionRef<bool(const int32 InStart, const int32 InCount, float* OutValues)> InProducer,
+			const HAPI_NodeId& InNodeId,
+			const HAPI_PartId& InPartId,
+			const FString& InAttributeName,
+			const HAPI_AttributeInfo& InAttributeInfo,
+			const int32 InChunkSize = -1);
+
+		// Pipeline used by HapiSetAttributeFloatDataStreamed: the chunks produced by InProducer are handed to InSender,
+		// in order and on the calling thread, while the next chunk is produced on a worker thread.
+		static HAPI_Result HapiSetAttributeFloatDataPipelined(
+			TFunctionRef<bool(const int32 InStart, const int32 InCount, float* OutValues)> InProducer,
+			TFunctionRef<HAPI_Result(const float* InValues, const int32 InStart, const int32 InCount)> InSender,
+			const HAPI_AttributeInfo& InAttributeInfo,
+			const int32 InChunkSize = -1);
+
 		// Helper function to set Int attribute data
 		// The data will be sent in chunks if too large for thrift
 		static HAPI_Result HapiSetAttributeIntData(
@@ -490,6 +600,15 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const FString& InAttributeName,
 			const HAPI_AttributeInfo& InAttributeInfo);
 
+		// Helper function to stream int attribute data, see HapiSetAttributeFloatDataStreamed
+		static HAPI_Result HapiSetAttributeIntDataStreamed(
+			TFunctionRef<bool(const int32 InStart, const int32 InCount, int32* OutValues)> InProducer,
+			const HAPI_NodeId& InNodeId,
+			const HAPI_PartId& InPartId,
+			const FString& InAttributeName,
+			const HAPI_AttributeInfo& InAttributeInfo,
+			const int32 InChunkSize = -1);
+
 		// Helper function to set unsigned Int attribute data
 		// The data will be sent in chunks if too large for thrift
 		static HAPI_Result HapiSetAttributeUIntData(
@@ -0,0 +1,183 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineVectorConversion.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Async/ParallelFor.h"
+
+const int32 FHoudiniEngineVectorConversion::ParallelChunkSize = 64 * 1024;
+
+// Swaps Y and Z and multiplies by a per-component scale, four XYZ vectors (three registers) at a time.
+// The scale is given in the output's coordinate system.
+// If bInDivide is true, the input is divided by InDivisor before being scaled.
+template<bool bInDivide>
+static void
+HoudiniSwapYZAndScale(const float* InData, float* OutData, const int32& InNumVectors, const FVector3f& InScale, const float& InDivisor)
+{
+	// The scale and divisor, for the four vectors packed in three registers
+	const VectorRegister4Float Scale0 = MakeVectorRegisterFloat(InScale.X, InScale.Y, InScale.Z, InScale.X);
+	const VectorRegister4Float Scale1 = MakeVectorRegisterFloat(InScale.Y, InScale.Z, InScale.X, InScale.Y);
+	const VectorRegister4Float Scale2 = MakeVectorRegisterFloat(InScale.Z, InScale.X, InScale.Y, InScale.Z);
+	const VectorRegister4Float Divisor = VectorSetFloat1(InDivisor);
+
+	int32 VectorIdx = 0;
+	for (; VectorIdx + 4 <= InNumVectors; VectorIdx += 4)
+	{
+		const float* In = InData + VectorIdx * 3;
+		float* Out = OutData + VectorIdx * 3;
+
+		// R0 = x0 y0 z0 x1, R1 = y1 z1 x2 y2, R2 = z2 x3 y3 z3
+		// All loads happen before the stores, so the conversion can be done in place
+		const VectorRegister4Float R0 = VectorLoad(In);
+		const VectorRegister4Float R1 = VectorLoad(In + 4);
+		const VectorRegister4Float R2 = VectorLoad(In + 8);
+
+		// O0 = x0 z0 y0 x1
+		VectorRegister4Float O0 = VectorSwizzle(R0, 0, 2, 1, 3);
+		// O1 = z1 y1 x2 z2
+		const VectorRegister4Float T1 = VectorShuffle(R1, R2, 2, 2, 0, 0);
+		VectorRegister4Float O1 = VectorShuffle(R1, T1, 1, 0, 0, 2);
+		// O2 = y2 x3 z3 y3
+		const VectorRegister4Float T2 = VectorShuffle(R1, R2, 3, 3, 1, 1);
+		VectorRegister4Float O2 = VectorShuffle(T2, R2, 0, 2, 3, 2);
+
+		if (bInDivide)
+		{
+			O0 = VectorDivide(O0, Divisor);
+			O1 = VectorDivide(O1, Divisor);
+			O2 = VectorDivide(O2, Divisor);
+		}
+
+		VectorStore(VectorMultiply(O0, Scale0), Out);
+		VectorStore(VectorMultiply(O1, Scale1), Out + 4);
+		VectorStore(VectorMultiply(O2, Scale2), Out + 8);
+	}
+
+	// Remaining vectors
+	for (; VectorIdx < InNumVectors; ++VectorIdx)
+	{
+		const float* In = InData + VectorIdx * 3;
+		float* Out = OutData + VectorIdx * 3;
+
+		const float X = bInDivide ? In[0] / InDivisor : In[0];
+		const float Y = bInDivide ? In[2] / InDivisor : In[2];
+		const float Z = bInDivide ? In[1] / InDivisor : In[1];
+		Out[0] = X * InScale.X;
+		Out[1] = Y * InScale.Y;
+		Out[2] = Z * InScale.Z;
+	}
+}
+
+// Splits a stream in chunks converted in parallel
+static void
+HoudiniParallelConvert(const int32& InNumVectors, TFunctionRef<void(const int32 InStart, const int32 InCount)> InConvert)
+{
+	const int32 ChunkSize = FHoudiniEngineVectorConversion::ParallelChunkSize;
+	if (InNumVectors <= ChunkSize)
+	{
+		InConvert(0, InNumVectors);
+		return;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(InNumVectors, ChunkSize);
+	ParallelFor(NumChunks, [&](const int32 ChunkIdx)
+	{
+		const int32 Start = ChunkIdx * ChunkSize;
+		InConvert(Start, FMath::Min(ChunkSize, InNumVectors - Start));
+	});
+}
+
+void
+FHoudiniEngineVectorConversion::HoudiniToUnrealPositions(const float* InData, float* OutData, const int32& InNumVectors)
+{
+	const FVector3f Scale(HAPI_UNREAL_SCALE_FACTOR_POSITION);
+	HoudiniSwapYZAndScale<false>(InData, OutData, InNumVectors, Scale, 1.0f);
+}
+
+void
+FHoudiniEngineVectorConversion::UnrealToHoudiniPositions(
+	const float* InData, float* OutData, const int32& InNumVectors, const FVector3f& InUnrealScale)
+{
+	// Swap the scale to Houdini's coordinate system
+	const FVector3f Scale(InUnrealScale.X, InUnrealScale.Z, InUnrealScale.Y);
+	HoudiniSwapYZAndScale<true>(InData, OutData, InNumVectors, Scale, HAPI_UNREAL_SCALE_FACTOR_POSITION);
+}
+
+void
+FHoudiniEngineVectorConversion::SwapYZ(const float* InData, float* OutData, const int32& InNumVectors)
+{
+	HoudiniSwapYZAndScale<false>(InData, OutData, InNumVectors, FVector3f::OneVector, 1.0f);
+}
+
+void
+FHoudiniEngineVectorConversion::ConvertQuaternions(const float* InData, float* OutData, const int32& InNumQuats)
+{
+	const VectorRegister4Float NegateW = MakeVectorRegisterFloat(1.0f, 1.0f, 1.0f, -1.0f);
+	for (int32 QuatIdx = 0; QuatIdx < InNumQuats; ++QuatIdx)
+	{
+		const VectorRegister4Float Quat = VectorLoad(InData + QuatIdx * 4);
+		VectorStore(VectorMultiply(VectorSwizzle(Quat, 0, 2, 1, 3), NegateW), OutData + QuatIdx * 4);
+	}
+}
+
+void
+FHoudiniEngineVectorConversion::ParallelHoudiniToUnrealPositions(const float* InData, float* OutData, const int32& InNumVectors)
+{
+	HoudiniParallelConvert(InNumVectors, [&](const int32 InStart, const int32 InCount)
+	{
+		HoudiniToUnrealPositions(InData + InStart * 3, OutData + InStart * 3, InCount);
+	});
+}
+
+void
+FHoudiniEngineVectorConversion::ParallelUnrealToHoudiniPositions(
+	const float* InData, float* OutData, const int32& InNumVectors, const FVector3f& InUnrealScale)
+{
+	HoudiniParallelConvert(InNumVectors, [&](const int32 InStart, const int32 InCount)
+	{
+		UnrealToHoudiniPositions(InData + InStart * 3, OutData + InStart * 3, InCount, InUnrealScale);
+	});
+}
+
+void
+FHoudiniEngineVectorConversion::ParallelSwapYZ(const float* InData, float* OutData, const int32& InNumVectors)
+{
+	HoudiniParallelConvert(InNumVectors, [&](const int32 InStart, const int32 InCount)
+	{
+		SwapYZ(InData + InStart * 3, OutData + InStart * 3, InCount);
+	});
+}
+
+void
+FHoudiniEngineVectorConversion::ParallelConvertQuaternions(const float* InData, float* OutData, const int32& InNumQuats)
+{
+	HoudiniParallelConvert(InNumQuats, [&](const int32 InStart, const int32 InCount)
+	{
+		ConvertQuaternions(InData + InStart * 4, OutData + InStart * 4, InCount);
+	});
+}
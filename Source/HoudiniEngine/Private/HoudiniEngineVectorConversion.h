@@ -0,0 +1,62 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Conversions of float streams between the Houdini and Unreal coordinate systems.
+// Houdini is Y-up and in meters, Unreal is Z-up and in centimeters: converting swaps Y and Z,
+// and scales positions by HAPI_UNREAL_SCALE_FACTOR_POSITION.
+// Streams are tightly packed XYZ (or XYZW for quaternions) floats, and can be converted in place.
+// The conversions use VectorRegister to process four vectors per iteration.
+struct HOUDINIENGINE_API FHoudiniEngineVectorConversion
+{
+	// Houdini positions to Unreal positions.
+	static void HoudiniToUnrealPositions(const float* InData, float* OutData, const int32& InNumVectors);
+
+	// Unreal positions to Houdini positions.
+	// InUnrealScale is applied to the Unreal positions before they are converted (ie, a static mesh's build scale).
+	static void UnrealToHoudiniPositions(
+		const float* InData, float* OutData, const int32& InNumVectors, const FVector3f& InUnrealScale = FVector3f::OneVector);
+
+	// Swaps Y and Z, converts directions, scales and euler rotations both ways.
+	static void SwapYZ(const float* InData, float* OutData, const int32& InNumVectors);
+
+	// Swaps Y and Z and negates W, converts quaternions both ways.
+	static void ConvertQuaternions(const float* InData, float* OutData, const int32& InNumQuats);
+
+	// Parallel versions of the conversions, for large streams.
+	// Streams smaller than ParallelChunkSize vectors are converted on the calling thread.
+	static void ParallelHoudiniToUnrealPositions(const float* InData, float* OutData, const int32& InNumVectors);
+	static void ParallelUnrealToHoudiniPositions(
+		const float* InData, float* OutData, const int32& InNumVectors, const FVector3f& InUnrealScale = FVector3f::OneVector);
+	static void ParallelSwapYZ(const float* InData, float* OutData, const int32& InNumVectors);
+	static void ParallelConvertQuaternions(const float* InData, float* OutData, const int32& InNumQuats);
+
+	// Number of vectors converted by each parallel task
+	static const int32 ParallelChunkSize;
+};
@@ -28,7 +28,9 @@
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
 
@@ -323,6 +325,9 @@ FHoudiniHandleTranslator::UpdateTransformParameters(UHoudiniHandleComponent* Han
 	if (!IsValid(HandleComponent))
 		return;
 
+	// Handles are edited from the viewport and the details panel, outside of the manager's processing
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HandleComponent));
+
 	if (!HandleComponent->CheckHandleValid())
 		return;
 
@@ -30,6 +30,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniCookStats.h"
 #include "HoudiniDataLayerUtils.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -777,6 +778,8 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 		if (!IsValid(CurrentInput) || !CurrentInput->HasChanged())
 			continue;
 
+		FHoudiniCookStatsPhaseScope InputUploadScope(EHoudiniCookStatsPhase::InputUpload, CurrentInput->GetInputTypeAsString());
+
 		// Delete any previous InputNodeIds of this HoudiniInput that are pending delete
 		for (const HAPI_NodeId InputNodeIdPendingDelete : CurrentInput->GetInputNodesPendingDelete())
 		{
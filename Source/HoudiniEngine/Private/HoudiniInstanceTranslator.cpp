@@ -36,6 +36,12 @@
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniOutput.h"
+#include "HoudiniOutputTranslator.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
+#include "HoudiniScratchAllocator.h"
+#include "HoudiniStaticMeshBuildQueue.h"
 #include "HoudiniStaticMeshComponent.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniFoliageTools.h"
@@ -44,6 +50,7 @@
 
 #include "Engine/StaticMesh.h"
 #include "ComponentReregisterContext.h"
+#include "Async/ParallelFor.h"
 #include "HoudiniMaterialTranslator.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
@@ -73,6 +80,23 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// Instance transforms of an output's instancer parts, fetched on worker threads before its instancers are created.
+// Only set while CreateAllInstancersFromHoudiniOutput runs, and only used on the game thread: each part's transforms
+// are taken by the first fetch of that part's transforms.
+namespace HoudiniPrefetchedInstanceTransforms
+{
+	static TMap<TPair<HAPI_NodeId, HAPI_PartId>, TArray<FTransform>>* Transforms = nullptr;
+
+	static bool
+	Take(const FHoudiniGeoPartObject& InHGPO, TArray<FTransform>& OutTransforms)
+	{
+		if (!Transforms || !IsInGameThread())
+			return false;
+
+		return Transforms->RemoveAndCopyValue(TPair<HAPI_NodeId, HAPI_PartId>(InHGPO.GeoId, InHGPO.PartId), OutTransforms);
+	}
+}
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -86,13 +110,11 @@ bool
 FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	const FHoudiniGeoPartObject& InHGPO,
 	const TArray<UHoudiniOutput*>& InAllOutputs,
-	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData)
+	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData,
+	const bool& bInHasAttributes)
 {
-	// Get if force to use HISM from attribute
-	OutInstancedOutputPartData.bForceHISM = HasHISMAttribute(InHGPO.GeoId, InHGPO.PartId);
-
-	// Should we create an instancer even for single instances?
-	OutInstancedOutputPartData.bForceInstancer = HasForceInstancerAttribute(InHGPO.GeoId, InHGPO.PartId);
+	if (!bInHasAttributes)
+		PopulateInstancedOutputPartAttributes(InHGPO, OutInstancedOutputPartData);
 
 	// Extract the object and transforms for this instancer
 	if (!GetInstancerObjectsAndTransforms(
@@ -105,7 +127,24 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 			OutInstancedOutputPartData.SplitAttributeValues,
 			OutInstancedOutputPartData.PerSplitAttributes))
 		return false;
-	
+
+	// Check for per instance custom data, it is split by instanced object
+	GetPerInstanceCustomData(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData);
+
+	return true;
+}
+
+void
+FHoudiniInstanceTranslator::PopulateInstancedOutputPartAttributes(
+	const FHoudiniGeoPartObject& InHGPO,
+	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData)
+{
+	// Get if force to use HISM from attribute
+	OutInstancedOutputPartData.bForceHISM = HasHISMAttribute(InHGPO.GeoId, InHGPO.PartId);
+
+	// Should we create an instancer even for single instances?
+	OutInstancedOutputPartData.bForceInstancer = HasForceInstancerAttribute(InHGPO.GeoId, InHGPO.PartId);
+
 	// Check if this is a No-Instancers ( unreal_split_instances )
 	OutInstancedOutputPartData.bSplitMeshInstancer = IsSplitInstancer(InHGPO.GeoId, InHGPO.PartId);
 
@@ -114,9 +153,6 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	// Extract the generic attributes
 	GetGenericPropertiesAttributes(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.AllPropertyAttributes);
 
-	// Check for per instance custom data
-	GetPerInstanceCustomData(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData);
-
 	//Get the level path attribute on the instancer
 	if (!FHoudiniEngineUtils::GetLevelPathAttribute(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.AllLevelPaths))
 	{
@@ -176,8 +212,27 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	// See if we have instancer material overrides
 	if (!GetMaterialOverridesFromAttributes(InHGPO.GeoId, InHGPO.PartId, 0, InHGPO.InstancerType, OutInstancedOutputPartData.MaterialAttributes))
 		OutInstancedOutputPartData.MaterialAttributes.Empty();
+}
 
-	return true;
+bool
+FHoudiniInstanceTranslator::FetchInstanceTransforms(
+	const FHoudiniGeoPartObject& InHGPO,
+	TArray<FTransform>& OutInstancerUnrealTransforms)
+{
+	switch (InHGPO.InstancerType)
+	{
+		case EHoudiniInstancerType::GeometryCollection:
+		case EHoudiniInstancerType::PackedPrimitive:
+			return HapiGetInstancerPartTransforms(InHGPO, OutInstancerUnrealTransforms);
+
+		case EHoudiniInstancerType::AttributeInstancer:
+		case EHoudiniInstancerType::OldSchoolAttributeInstancer:
+		case EHoudiniInstancerType::ObjectInstancer:
+			return HapiGetInstanceTransforms(InHGPO, OutInstancerUnrealTransforms);
+
+		default:
+			return false;
+	}
 }
 
 int
@@ -284,19 +339,82 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	// The default SM to be used if the instanced object has not been found (when using attribute instancers)
 	UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
 
+	auto MakeOutputIdentifier = [](const FHoudiniGeoPartObject& InHGPO)
+	{
+		FHoudiniOutputObjectIdentifier OutputIdentifier;
+		OutputIdentifier.ObjectId = InHGPO.ObjectId;
+		OutputIdentifier.GeoId = InHGPO.GeoId;
+		OutputIdentifier.PartId = InHGPO.PartId;
+		OutputIdentifier.PartName = InHGPO.PartName;
+		return OutputIdentifier;
+	};
+
+	// When there are several instancer parts to populate, their attributes and instance transforms are fetched and
+	// converted on worker threads first. Their instanced objects are then resolved on this thread, when creating them.
+	const TArray<FHoudiniGeoPartObject>& AllHGPOs = InOutput->HoudiniGeoPartObjects;
+	TArray<int32> PartsToFetch;
+	for (int32 HGPOIdx = 0; HGPOIdx < AllHGPOs.Num(); HGPOIdx++)
+	{
+		if (AllHGPOs[HGPOIdx].Type != EHoudiniPartType::Instancer)
+			continue;
+
+		if (InPreBuiltInstancedOutputPartData && InPreBuiltInstancedOutputPartData->Contains(MakeOutputIdentifier(AllHGPOs[HGPOIdx])))
+			continue;
+
+		PartsToFetch.Add(HGPOIdx);
+	}
+
+	TArray<FHoudiniInstancedOutputPartData> FetchedPartData;
+	TMap<TPair<HAPI_NodeId, HAPI_PartId>, TArray<FTransform>> FetchedTransforms;
+	const bool bFetchParts = PartsToFetch.Num() > 1 && FHoudiniOutputTranslator::IsParallelTranslationEnabled();
+	if (bFetchParts)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniInstanceTranslator::FetchInstancerParts"));
+
+		FetchedPartData.SetNum(AllHGPOs.Num());
+		TArray<TArray<FTransform>> PartTransforms;
+		PartTransforms.SetNum(PartsToFetch.Num());
+		TArray<bool> HasPartTransforms;
+		HasPartTransforms.SetNumZeroed(PartsToFetch.Num());
+
+		// The worker tasks must make their HAPI calls on this output's session, and record their transfers in its cook's stats
+		const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+		FHoudiniCookStats* CookStats = FHoudiniCookStats::GetCurrent();
+		ParallelFor(PartsToFetch.Num(), [&](int32 FetchIdx)
+		{
+			FHoudiniEngineScopedSession ScopedSession(SessionIndex);
+			FHoudiniCookStatsScope CookStatsScope(CookStats);
+
+			const FHoudiniGeoPartObject& HGPO = AllHGPOs[PartsToFetch[FetchIdx]];
+			PopulateInstancedOutputPartAttributes(HGPO, FetchedPartData[PartsToFetch[FetchIdx]]);
+			HasPartTransforms[FetchIdx] = FetchInstanceTransforms(HGPO, PartTransforms[FetchIdx]);
+		});
+
+		// Parts whose transforms couldn't be fetched fetch them again when resolving their objects
+		for (int32 FetchIdx = 0; FetchIdx < PartsToFetch.Num(); FetchIdx++)
+		{
+			if (!HasPartTransforms[FetchIdx])
+				continue;
+
+			const FHoudiniGeoPartObject& HGPO = AllHGPOs[PartsToFetch[FetchIdx]];
+			FetchedTransforms.Add(TPair<HAPI_NodeId, HAPI_PartId>(HGPO.GeoId, HGPO.PartId), MoveTemp(PartTransforms[FetchIdx]));
+		}
+	}
+
+	TGuardValue<TMap<TPair<HAPI_NodeId, HAPI_PartId>, TArray<FTransform>>*> PrefetchedTransformsGuard(
+		HoudiniPrefetchedInstanceTransforms::Transforms, bFetchParts ? &FetchedTransforms : nullptr);
+
 	// Iterate on all of the output's HGPO, creating meshes as we go
-	for (const FHoudiniGeoPartObject& CurHGPO : InOutput->HoudiniGeoPartObjects)
+	for (int32 HGPOIdx = 0; HGPOIdx < AllHGPOs.Num(); HGPOIdx++)
 	{
+		const FHoudiniGeoPartObject& CurHGPO = AllHGPOs[HGPOIdx];
+
 		// Not an instancer, skip
 		if (CurHGPO.Type != EHoudiniPartType::Instancer)
 			continue;
 
 		// Prepare this output object's output identifier
-		FHoudiniOutputObjectIdentifier OutputIdentifier;
-		OutputIdentifier.ObjectId = CurHGPO.ObjectId;
-		OutputIdentifier.GeoId = CurHGPO.GeoId;
-		OutputIdentifier.PartId = CurHGPO.PartId;
-		OutputIdentifier.PartName = CurHGPO.PartName;
+		FHoudiniOutputObjectIdentifier OutputIdentifier = MakeOutputIdentifier(CurHGPO);
 
 		FHoudiniInstancedOutputPartData InstancedOutputPartDataTmp;
 		const FHoudiniInstancedOutputPartData* InstancedOutputPartDataPtr = nullptr;
@@ -306,7 +424,11 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		}
 		if (!InstancedOutputPartDataPtr)
 		{
-			if (!PopulateInstancedOutputPartData(CurHGPO, InAllOutputs, InstancedOutputPartDataTmp))
+			const bool bHasAttributes = FetchedPartData.IsValidIndex(HGPOIdx);
+			if (bHasAttributes)
+				InstancedOutputPartDataTmp = MoveTemp(FetchedPartData[HGPOIdx]);
+
+			if (!PopulateInstancedOutputPartData(CurHGPO, InAllOutputs, InstancedOutputPartDataTmp, bHasAttributes))
 				continue;
 			InstancedOutputPartDataPtr = &InstancedOutputPartDataTmp;
 		}
@@ -1309,20 +1431,9 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 		return false;
 
 	// Get transforms for each instance
-	TArray<HAPI_Transform> InstancerPartTransforms;
-	InstancerPartTransforms.SetNumZeroed(InHGPO.PartInfo.InstanceCount);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancerPartTransforms(
-		FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartInfo.PartId,
-		HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, InHGPO.PartInfo.InstanceCount), false);
-
-	// Convert the transform to Unreal's coordinate system
 	TArray<FTransform> InstancerUnrealTransforms;
-	InstancerUnrealTransforms.SetNum(InstancerPartTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, InstancerUnrealTransforms[InstanceIdx]);
-	}
+	if (!HapiGetInstancerPartTransforms(InHGPO, InstancerUnrealTransforms))
+		return false;
 
 	// Get the part ids for parts being instanced
 	TArray<HAPI_PartId> InstancedPartIds;
@@ -1412,9 +1523,9 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 	OutSplitAttributeValue.Empty();
 	for (int32 ObjIdx = 0; ObjIdx < UnsplitInstancedHGPOs.Num(); ObjIdx++)
 	{
-		// Map of split values to transform arrays
-		TMap<FString, TArray<FTransform>> SplitTransformMap;
-		TMap<FString, TArray<int32>> SplitIndicesMap;
+		// Map of split values to transform arrays, allocated in the cook's scratch memory
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<FTransform>> SplitTransformMap;
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> SplitIndicesMap;
 
 		TArray<FTransform>& CurrentTransforms = UnsplitInstancedTransforms[ObjIdx];
 		TArray<int32>& CurrentIndices = UnsplitInstancedIndices[ObjIdx];
@@ -1458,8 +1569,8 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 		{
 			OutSplitAttributeValue.Add(Iterator.Key);
 			OutInstancedHGPO.Add(UnsplitInstancedHGPOs[ObjIdx]);
-			OutInstancedTransforms.Add(Iterator.Value);
-			OutInstancedIndices.Add(SplitIndicesMap[Iterator.Key]);
+			OutInstancedTransforms.Emplace(Iterator.Value);
+			OutInstancedIndices.Emplace(SplitIndicesMap[Iterator.Key]);
 		}
 	}
 
@@ -1646,69 +1757,91 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 	}
 	else
 	{
-		// Attribute is on points, so we may have different values for each of them
-		TArray<FString> PointInstanceValues;
-		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
+		// Attribute is on points, so we may have different values for each of them.
+		// Only fetch the unique values, and the index of each point's value in them
+		TArray<FString> UniqueInstanceValues;
+		TArray<int32> PointInstanceIndices;
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStringsFromInfo(
 			InHGPO.GeoId,
 			InHGPO.PartId,
 			is_override_attr ? HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE : HAPI_UNREAL_ATTRIB_INSTANCE,
 			AttribInfo,
-			PointInstanceValues))
+			UniqueInstanceValues,
+			PointInstanceIndices))
 		{
 			// This should not happen - attribute exists, but there was an error retrieving it.
 			return false;
 		}
 
 		// The attribute is on points, so the number of points must match number of transforms.
-		if (!ensure(PointInstanceValues.Num() == InstancerUnrealTransforms.Num()))
+		if (!ensure(PointInstanceIndices.Num() == InstancerUnrealTransforms.Num()))
 		{
 			// This should not happen, we have mismatch between number of instance values and transforms.
 			return false;
 		}
 
-		// If instance attribute exists on points, we need to get all the unique values.
-		// This will give us all the unique object we want to instance
-		TMap<FString, UObject *> ObjectsToInstance;
-		for (const auto& Iter : PointInstanceValues)
+		// The unique values give us all the unique object we want to instance.
+		// Object paths are not case sensitive, so values only differing by case are instanced together.
+		THoudiniCookScratchMap<FString, int32> InstancePathToObjectIndex;
+		TArray<FString> InstancePaths;
+		TArray<UObject*> ObjectsToInstance;
+		FHoudiniScratchScope ScratchScope;
+		THoudiniScratchArray<int32> ValueToObjectIndex;
+		ValueToObjectIndex.SetNum(UniqueInstanceValues.Num());
+		for (int32 ValueIdx = 0; ValueIdx < UniqueInstanceValues.Num(); ++ValueIdx)
 		{
-			if (!ObjectsToInstance.Contains(Iter))
+			const FString& Iter = UniqueInstanceValues[ValueIdx];
+			if (const int32* FoundObjectIndex = InstancePathToObjectIndex.Find(Iter))
 			{
-				// To avoid trying to load an object that fails multiple times,
-				// still add it to the array if null so we can still skip further attempts
-				UObject* AttributeObject = StaticFindObjectSafe(UObject::StaticClass(), nullptr, *Iter);
-				if (!IsValid(AttributeObject))
-					AttributeObject = StaticLoadObject(
-						UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
+				ValueToObjectIndex[ValueIdx] = *FoundObjectIndex;
+				continue;
+			}
 
-				while (UObjectRedirector* Redirector = Cast<UObjectRedirector>(AttributeObject))
-					AttributeObject = Redirector->DestinationObject;
+			// To avoid trying to load an object that fails multiple times,
+			// still add it to the array if null so we can still skip further attempts
+			UObject* AttributeObject = StaticFindObjectSafe(UObject::StaticClass(), nullptr, *Iter);
+			if (!IsValid(AttributeObject))
+				AttributeObject = StaticLoadObject(
+					UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
 
-				if (!AttributeObject)
+			while (UObjectRedirector* Redirector = Cast<UObjectRedirector>(AttributeObject))
+				AttributeObject = Redirector->DestinationObject;
+
+			if (!AttributeObject)
+			{
+				UClass* FoundClass = FHoudiniEngineRuntimeUtils::GetClassByName(Iter);
+				if (FoundClass != nullptr)
 				{
-					UClass* FoundClass = FHoudiniEngineRuntimeUtils::GetClassByName(Iter);
-					if (FoundClass != nullptr)
-					{
-						// TODO: ensure we'll be able to create an actor from this class!
-						AttributeObject = FoundClass;
-					}
+					// TODO: ensure we'll be able to create an actor from this class!
+					AttributeObject = FoundClass;
 				}
-
-				ObjectsToInstance.Add(Iter, AttributeObject);
 			}
+
+			ValueToObjectIndex[ValueIdx] = InstancePaths.Add(Iter);
+			ObjectsToInstance.Add(AttributeObject);
+			InstancePathToObjectIndex.Add(Iter, ValueToObjectIndex[ValueIdx]);
+		}
+
+		// Gather the points of each object in a single pass over the points
+		TArray<TArray<int32>> PointIndicesPerObject;
+		PointIndicesPerObject.SetNum(ObjectsToInstance.Num());
+		for (int32 Idx = 0; Idx < PointInstanceIndices.Num(); ++Idx)
+		{
+			PointIndicesPerObject[ValueToObjectIndex[PointInstanceIndices[Idx]]].Add(Idx);
 		}
 
 		// Iterates through all the unique objects and get their corresponding transforms
 		bool Success = false;
-		for (auto Iter : ObjectsToInstance)
+		for (int32 ObjectIdx = 0; ObjectIdx < ObjectsToInstance.Num(); ++ObjectIdx)
 		{
 			bool bHiddenInGame = false;
 			// Check that we managed to load this object
-			UObject * AttributeObject = Iter.Value;
+			UObject * AttributeObject = ObjectsToInstance[ObjectIdx];
 
 			if (!AttributeObject && bDefaultObjectEnabled) 
 			{
 				HOUDINI_LOG_WARNING(
-					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *(Iter.Key));
+					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *(InstancePaths[ObjectIdx]));
 
 				// If failed to load this object, add default reference mesh
 				UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
@@ -1727,52 +1860,28 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			if (!AttributeObject)
 				continue;
 
-			if (!bHasSplitAttribute)
-			{
-				// No Split attribute:
-				// Extract the transform values that correspond to this object, and add them to the output arrays
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				TArray<int32> ObjectIndices;
+			// Extract the transform values that correspond to this object, and add them to the output arrays
+			const TArray<int32>& ObjectIndices = PointIndicesPerObject[ObjectIdx];
+			TArray<FTransform> ObjectTransforms;
+			ObjectTransforms.Reserve(ObjectIndices.Num());
+			for (const int32& Idx : ObjectIndices)
+				ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
 
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-					{
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-						ObjectIndices.Add(Idx);
-					}
-				}
+			OutInstancedObjects.Add(AttributeObject);
+			OutInstancedTransforms.Add(ObjectTransforms);
+			OutInstancedIndices.Add(ObjectIndices);
+			Success = true;
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				OutInstancedIndices.Add(ObjectIndices);
-				Success = true;
-			}
-			else
+			if (bHasSplitAttribute)
 			{
 				// We have a split attribute:
-				// Extract the transform values and split attribute values for this object,
-				// add them to the output arrays, and we will process the splits after
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				TArray<int32> ObjectIndices;
+				// Also extract the split attribute values for this object, we will process the splits after
 				TArray<FString> ObjectSplitValues;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-					{
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-						ObjectIndices.Add(Idx);
-						ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
-					}
-				}
+				ObjectSplitValues.Reserve(ObjectIndices.Num());
+				for (const int32& Idx : ObjectIndices)
+					ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				OutInstancedIndices.Add(ObjectIndices);
 				SplitAttributeValuesPerObject.Add(ObjectSplitValues);
-				Success = true;
 			}
 		}
 
@@ -1802,9 +1911,9 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 	{
 		UObject* InstancedObject = UnsplitInstancedObjects[ObjIdx];
 
-		// Map of split values to transform arrays
-		TMap<FString, TArray<FTransform>> SplitTransformMap;
-		TMap<FString, TArray<int32>> SplitIndicesMap;
+		// Map of split values to transform arrays, allocated in the cook's scratch memory
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<FTransform>> SplitTransformMap;
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> SplitIndicesMap;
 
 		TArray<FTransform>& CurrentTransforms = UnsplitInstancedTransforms[ObjIdx];
 		TArray<int32>& CurrentIndices = UnsplitInstancedIndices[ObjIdx];
@@ -1849,8 +1958,8 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 		{
 			OutSplitAttributeValue.Add(Iterator.Key);
 			OutInstancedObjects.Add(InstancedObject);
-			OutInstancedTransforms.Add(Iterator.Value);
-			OutInstancedIndices.Add(SplitIndicesMap[Iterator.Key]);
+			OutInstancedTransforms.Emplace(Iterator.Value);
+			OutInstancedIndices.Emplace(SplitIndicesMap[Iterator.Key]);
 		}
 	}
 
@@ -2371,6 +2480,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 
 	InstancedStaticMeshComponent->SetStaticMesh(InstancedStaticMesh);
 
+	// Instance the previous version of the mesh until its rebuilt version has compiled
+	FHoudiniStaticMeshBuildQueue::Get().KeepDisplayingReplacedMesh(InstancedStaticMeshComponent);
+
 	if (InstancedStaticMeshComponent->GetBodyInstance())
 	{
 		InstancedStaticMeshComponent->GetBodyInstance()->bAutoWeld = false;
@@ -2745,6 +2857,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateStaticMeshComponent(
 		return false;
 
 	SMC->SetStaticMesh(InstancedStaticMesh);
+	FHoudiniStaticMeshBuildQueue::Get().KeepDisplayingReplacedMesh(SMC);
 	SMC->GetBodyInstance()->bAutoWeld = false;
 	
 	FHoudiniEngineUtils::KeepOrClearComponentTags(SMC, &InstancerGeoPartObject);
@@ -3031,32 +3144,40 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	const FHoudiniGeoPartObject& InHGPO, 
 	TArray<FTransform>& OutInstancerUnrealTransforms)
 {
+	// Use the transforms fetched ahead of time, if any
+	if (HoudiniPrefetchedInstanceTransforms::Take(InHGPO, OutInstancerUnrealTransforms))
+		return true;
+
 	// Get the instance transforms	
 	int32 PointCount = InHGPO.PartInfo.PointCount;
 	if (PointCount <= 0)
 		return false;
 
-	TArray<HAPI_Transform> InstanceTransforms;
-	InstanceTransforms.SetNum(PointCount);
-	for (int32 Idx = 0; Idx < InstanceTransforms.Num(); Idx++)
-		FHoudiniApi::Transform_Init(&(InstanceTransforms[Idx]));
+	// The transforms are fetched in chunks, and converted to Unreal's coordinate system in parallel
+	return FHoudiniEngineUtils::HapiGetInstanceTransforms(
+		InHGPO.GeoId, InHGPO.PartId, PointCount, OutInstancerUnrealTransforms);
+}
 
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
-		FHoudiniEngine::Get().GetSession(),
-		InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
-		&InstanceTransforms[0], 0, PointCount))
-	{
-		InstanceTransforms.SetNum(0);
+bool
+FHoudiniInstanceTranslator::HapiGetInstancerPartTransforms(
+	const FHoudiniGeoPartObject& InHGPO,
+	TArray<FTransform>& OutInstancerUnrealTransforms)
+{
+	// Use the transforms fetched ahead of time, if any
+	if (HoudiniPrefetchedInstanceTransforms::Take(InHGPO, OutInstancerUnrealTransforms))
+		return true;
 
-		// TODO: Warning? error?
-		return false;
-	}
+	TArray<HAPI_Transform> InstancerPartTransforms;
+	InstancerPartTransforms.SetNumZeroed(InHGPO.PartInfo.InstanceCount);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancerPartTransforms(
+		FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartInfo.PartId,
+		HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, InHGPO.PartInfo.InstanceCount), false);
 
 	// Convert the transform to Unreal's coordinate system
-	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
+	OutInstancerUnrealTransforms.SetNum(InstancerPartTransforms.Num());
+	for (int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); InstanceIdx++)
 	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
+		const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
 		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
 	}
 
@@ -216,11 +216,26 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 {
 	public:
 
+		// Fills the instanced output part data of an instancer part.
+		// If bInHasAttributes is true, the part's attributes have already been fetched by PopulateInstancedOutputPartAttributes.
 		static bool PopulateInstancedOutputPartData(
 			const FHoudiniGeoPartObject& InHGPO,
 			const TArray<UHoudiniOutput*>& InAllOutputs,
+			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData,
+			const bool& bInHasAttributes = false);
+
+		// Fetches the attributes of an instancer part that don't depend on its instanced objects (HISM, bake
+		// attributes, material overrides...). This only calls HAPI, and can be called from worker threads.
+		static void PopulateInstancedOutputPartAttributes(
+			const FHoudiniGeoPartObject& InHGPO,
 			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData);
 
+		// Fetches the instance transforms of an instancer part, whatever its instancer type.
+		// This only calls HAPI, and can be called from worker threads.
+		static bool FetchInstanceTransforms(
+			const FHoudiniGeoPartObject& InHGPO,
+			TArray<FTransform>& OutInstancerUnrealTransforms);
+
 		static int CreateAllInstancersFromHoudiniOutputs(
 			const TArray<UHoudiniOutput*>& InAllOutputs,
 			UObject* InOuterComponent,
@@ -431,6 +446,11 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniGeoPartObject& InHGPO,
 			TArray<FTransform>& OutInstancerUnrealTransforms);
 
+		// Fetches the transforms of a packed primitive instancer and convert them to ue4 coordinates
+		static bool HapiGetInstancerPartTransforms(
+			const FHoudiniGeoPartObject& InHGPO,
+			TArray<FTransform>& OutInstancerUnrealTransforms);
+
 		// Helper function used to spawn a new Actor for UHoudiniInstancedActorComponent
 		// Relies on editor-only functionalities, so this function is not on the IAC itself
 		static AActor* SpawnInstanceActor(
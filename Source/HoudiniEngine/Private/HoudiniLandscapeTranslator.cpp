@@ -54,6 +54,11 @@
 #include "HAL/IConsoleManager.h"
 #include "Engine/AssetManager.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
+#include "HoudiniOutputTranslator.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniEngineSessionPool.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #if WITH_EDITOR
 	#include "EditorLevelUtils.h"
 #endif
@@ -64,6 +69,13 @@ typedef FHoudiniEngineUtils FHUtils;
 
 HOUDINI_LANDSCAPE_DEFINE_LOG_CATEGORY();
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineHeightFieldBatchPoints(
+	TEXT("HoudiniEngine.HeightFieldBatchPoints"),
+	16 * 1024 * 1024,
+	TEXT("Maximum number of points of the height field layers fetched together on worker threads, before their layers are translated.\n")
+	TEXT("Limits the memory used by the fetched layers when a landscape output has many layers.\n")
+);
+
 bool
 FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	UHoudiniOutput* InOutput,
@@ -111,8 +123,56 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 
 	TArray<UHoudiniLandscapeTargetLayerOutput*> AllOutputs;
 
-	for (FHoudiniHeightFieldPartData& Part : Parts)
+	// The height field data of a batch of layers at a time is fetched and converted on worker threads, before the
+	// layers are translated. The batches are bounded so that the data of all of the layers isn't loaded at once.
+	const bool bFetchParts = FHoudiniOutputTranslator::IsParallelTranslationEnabled();
+	const int64 MaxBatchPoints = FMath::Max(CVarHoudiniEngineHeightFieldBatchPoints.GetValueOnAnyThread(), 1);
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FHoudiniCookStats* CookStats = FHoudiniCookStats::GetCurrent();
+	int32 NextPartToFetch = 0;
+
+	for (int32 PartIdx = 0; PartIdx < Parts.Num(); PartIdx++)
 	{
+		FHoudiniHeightFieldPartData& Part = Parts[PartIdx];
+
+		if (bFetchParts && PartIdx == NextPartToFetch)
+		{
+			// A batch always holds at least one layer, the layers whose data is already cached are skipped
+			TArray<FHoudiniHeightFieldPartData*> Batch;
+			int64 BatchPoints = 0;
+			while (Parts.IsValidIndex(NextPartToFetch))
+			{
+				FHoudiniHeightFieldPartData& NextPart = Parts[NextPartToFetch];
+				const FIntPoint Dimensions = FHoudiniLandscapeUtils::GetVolumeDimensionsInUnrealSpace(*NextPart.HeightField);
+				const int64 NumPoints = (int64)Dimensions.X * Dimensions.Y;
+				if (Batch.Num() > 0 && BatchPoints + NumPoints > MaxBatchPoints)
+					break;
+
+				NextPartToFetch++;
+				if (NextPart.CachedData.IsValid() || !LandscapeMapping.HoudiniLayerToUnrealLandscape.Contains(&NextPart))
+					continue;
+
+				BatchPoints += NumPoints;
+				Batch.Add(&NextPart);
+			}
+
+			// A single layer is fetched when it is translated
+			if (Batch.Num() > 1)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniLandscapeTranslator::FetchHeightFieldBatch"));
+
+				ParallelFor(Batch.Num(), [&](int32 BatchIdx)
+				{
+					FHoudiniEngineScopedSession ScopedSession(SessionIndex);
+					FHoudiniCookStatsScope CookStatsScope(CookStats);
+
+					FHoudiniHeightFieldPartData& BatchPart = *Batch[BatchIdx];
+					BatchPart.CachedData = MakeUnique<FHoudiniHeightFieldData>(FHoudiniLandscapeUtils::FetchVolumeInUnrealSpace(
+						*BatchPart.HeightField, BatchPart.SizeInfo.UnrealGridDimensions, BatchPart.TargetLayerName == "height"));
+				});
+			}
+		}
+
 		if (!LandscapeMapping.HoudiniLayerToUnrealLandscape.Contains(&Part))
 		{
 			HOUDINI_LOG_WARNING(TEXT("Part was ignored: %s"), *Part.TargetLayerName);
@@ -34,12 +34,20 @@
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineVectorConversion.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniInstanceTranslator.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStaticMeshComponent.h"
+#include "HoudiniStaticMeshBuildQueue.h"
+#include "HoudiniBoundsUtils.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniScratchAllocator.h"
 #include "HoudiniSkeletalMeshTranslator.h"
+#include "HoudiniOutputTranslator.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
 
 #include "Engine/StaticMeshSocket.h"
 
@@ -67,6 +75,12 @@
 #include "Components/SkeletalMeshComponent.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Misc/App.h"
+#include "HAL/ThreadSafeBool.h"
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
@@ -87,6 +101,108 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCollisionFitThreads(
+	TEXT("HoudiniEngine.CollisionFitThreads"),
+	0,
+	TEXT("Number of tasks used when fitting oriented box collisions (and the convex hulls they are computed from).\n")
+	TEXT("0: Default, uses the number of task graph worker threads\n")
+	TEXT("1: Fits on the calling thread only\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCollisionFitCacheSize(
+	TEXT("HoudiniEngine.CollisionFitCacheSize"),
+	256,
+	TEXT("Maximum number of fitted collision groups kept in cache, so that collision groups that did not change are not fitted again on every cook.\n")
+	TEXT("0: Disables the cache\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineMeshPartBatchVertices(
+	TEXT("HoudiniEngine.MeshPartBatchVertices"),
+	4 * 1024 * 1024,
+	TEXT("Maximum number of vertices of the mesh parts fetched and prepared together, before their meshes are created.\n")
+	TEXT("Limits the memory used by the prepared part data when an output has many mesh parts.\n")
+);
+
+// Cache of the collision primitives fitted to collision groups.
+// Entries are keyed by a hash of the group's points and of the fit parameters, and are evicted in insertion order.
+namespace HoudiniCollisionFitCache
+{
+	static FCriticalSection CacheLock;
+	static TMap<uint64, FKAggregateGeom> CachedCollisions;
+	static TArray<uint64> CachedKeys;
+
+	static uint64
+	HashData(const void* InData, const int64& InSize, const uint64& InSeed)
+	{
+		return CityHash64WithSeed(static_cast<const char*>(InData), static_cast<uint32>(InSize), InSeed);
+	}
+
+	static bool
+	Find(const uint64& InKey, FKAggregateGeom& OutCollisions)
+	{
+		if (CVarHoudiniEngineCollisionFitCacheSize.GetValueOnAnyThread() <= 0)
+			return false;
+
+		FScopeLock ScopeLock(&CacheLock);
+		const FKAggregateGeom* Found = CachedCollisions.Find(InKey);
+		if (!Found)
+			return false;
+
+		OutCollisions = *Found;
+		return true;
+	}
+
+	static void
+	Add(const uint64& InKey, const FKAggregateGeom& InCollisions)
+	{
+		const int32 MaxEntries = CVarHoudiniEngineCollisionFitCacheSize.GetValueOnAnyThread();
+
+		FScopeLock ScopeLock(&CacheLock);
+		if (MaxEntries <= 0)
+		{
+			CachedCollisions.Empty();
+			CachedKeys.Empty();
+			return;
+		}
+
+		if (!CachedCollisions.Contains(InKey))
+			CachedKeys.Add(InKey);
+		CachedCollisions.Add(InKey, InCollisions);
+
+		if (CachedKeys.Num() > MaxEntries)
+		{
+			const int32 NumToEvict = CachedKeys.Num() - MaxEntries;
+			for (int32 Idx = 0; Idx < NumToEvict; Idx++)
+				CachedCollisions.Remove(CachedKeys[Idx]);
+			CachedKeys.RemoveAt(0, NumToEvict);
+		}
+	}
+
+	// Adds the cached/fitted collision primitives to an aggregate
+	static void
+	AppendTo(const FKAggregateGeom& InCollisions, FKAggregateGeom& OutAggregate)
+	{
+		OutAggregate.SphereElems.Append(InCollisions.SphereElems);
+		OutAggregate.BoxElems.Append(InCollisions.BoxElems);
+		OutAggregate.SphylElems.Append(InCollisions.SphylElems);
+		OutAggregate.ConvexElems.Append(InCollisions.ConvexElems);
+	}
+}
+
+// Returns the number of tasks to use for the collision fitting algorithms
+static uint32
+GetCollisionFitNumThreads()
+{
+	if (!FApp::ShouldUseThreadingForPerformance())
+		return 1;
+
+	int32 NumThreads = CVarHoudiniEngineCollisionFitThreads.GetValueOnAnyThread();
+	if (NumThreads <= 0)
+		NumThreads = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	return static_cast<uint32>(FMath::Max(NumThreads, 1));
+}
+
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	UHoudiniOutput* InOutput, 
@@ -121,13 +237,89 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 		InForceRebuild = true;
 	}
 
+	// Find the mesh parts that will have to be rebuilt
+	const TArray<FHoudiniGeoPartObject>& AllHGPOs = InOutput->HoudiniGeoPartObjects;
+	TArray<int32> PartsToBuild;
+	for (int32 HGPOIdx = 0; HGPOIdx < AllHGPOs.Num(); HGPOIdx++)
+	{
+		const FHoudiniGeoPartObject& CurHGPO = AllHGPOs[HGPOIdx];
+		if (CurHGPO.Type != EHoudiniPartType::Mesh)
+			continue;
+
+		if (!ShouldRebuildPart(CurHGPO, InForceRebuild, OldOutputObjects.Num() > 0))
+			continue;
+
+		// Streamed parts are fetched one range at a time when their mesh is created
+		if (InStaticMeshMethod == EHoudiniStaticMeshMethod::UHoudiniStaticMesh && !bSplitMeshSupport && ShouldStreamPart(CurHGPO))
+			continue;
+
+		PartsToBuild.Add(HGPOIdx);
+	}
+
+	// When there are several parts to build, a batch of parts at a time is fetched and prepared on worker threads:
+	// each task fetches its part's vertex list, split groups and attributes, converts them and builds the splits.
+	// HAPI serializes the calls made on a session, but the conversions and split building of a part overlap the
+	// fetches of the others. The UObjects and components are then created on this thread, in the parts' order,
+	// and each part's data is released once its mesh has been created.
+	TArray<FHoudiniMeshPartData> PreparedPartData;
+	const bool bPrepareParts = PartsToBuild.Num() > 1 && FHoudiniOutputTranslator::IsParallelTranslationEnabled();
+	if (bPrepareParts)
+		PreparedPartData.SetNum(AllHGPOs.Num());
+
+	// The legacy RawMesh method doesn't support split meshes
+	const bool bUseSplitMeshGroups = bSplitMeshSupport && InStaticMeshMethod != EHoudiniStaticMeshMethod::RawMesh_DEPRECATED;
+	const int64 MaxBatchVertices = FMath::Max(CVarHoudiniEngineMeshPartBatchVertices.GetValueOnAnyThread(), 1);
+	int32 NextPartToPrepare = 0;
+
+	// The worker tasks must make their HAPI calls on this output's session, and record their transfers in its cook's stats.
+	// The split data they prepare is allocated in the cook's scratch arena.
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FHoudiniCookStats* CookStats = FHoudiniCookStats::GetCurrent();
+	FHoudiniCookScratchArena* ScratchArena = FHoudiniCookScratchArena::GetCurrent();
+
 	// Iterate on all of the output's HGPO, creating meshes as we go
-	for (const FHoudiniGeoPartObject& CurHGPO : InOutput->HoudiniGeoPartObjects)
+	for (int32 HGPOIdx = 0; HGPOIdx < AllHGPOs.Num(); HGPOIdx++)
 	{
+		const FHoudiniGeoPartObject& CurHGPO = AllHGPOs[HGPOIdx];
+
 		// Not a mesh, skip
 		if (CurHGPO.Type != EHoudiniPartType::Mesh)
 			continue;
 
+		// Fetch and prepare the next batch of parts when reaching the first part that hasn't been prepared yet
+		if (bPrepareParts && PartsToBuild.IsValidIndex(NextPartToPrepare) && PartsToBuild[NextPartToPrepare] == HGPOIdx)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::PreparePartBatch"));
+
+			// A batch always holds at least one part
+			const int32 FirstPartInBatch = NextPartToPrepare;
+			int64 BatchVertices = 0;
+			do
+			{
+				BatchVertices += FMath::Max(AllHGPOs[PartsToBuild[NextPartToPrepare]].PartInfo.VertexCount, 0);
+				NextPartToPrepare++;
+			}
+			while (PartsToBuild.IsValidIndex(NextPartToPrepare)
+				&& BatchVertices + AllHGPOs[PartsToBuild[NextPartToPrepare]].PartInfo.VertexCount <= MaxBatchVertices);
+
+			ParallelFor(NextPartToPrepare - FirstPartInBatch, [&](int32 BatchIdx)
+			{
+				FHoudiniEngineScopedSession ScopedSession(SessionIndex);
+				FHoudiniCookStatsScope CookStatsScope(CookStats);
+				FHoudiniCookScratchArenaScope ScratchArenaScope(ScratchArena);
+
+				const int32 PartIdx = PartsToBuild[FirstPartInBatch + BatchIdx];
+				FHoudiniMeshPartData& PartData = PreparedPartData[PartIdx];
+				if (!FetchPartData(AllHGPOs[PartIdx], bUseSplitMeshGroups, PartData))
+					return;
+
+				PreparePartData(AllHGPOs[PartIdx], PartData);
+
+				// Parts whose attributes couldn't be fetched fall back to fetching them when creating their mesh
+				FetchPartAttributes(AllHGPOs[PartIdx], PartData);
+			});
+		}
+
 		// See if we have some uproperty attributes to update on 
 		// the outer component (in most case, the HAC)
 		TArray<FHoudiniGenericAttribute> PropertyAttributes;
@@ -154,7 +346,12 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 			bSplitMeshSupport,
 			InSMGenerationProperties,
 			InMeshBuildSettings,
-			bInTreatExistingMaterialsAsUpToDate);
+			bInTreatExistingMaterialsAsUpToDate,
+			PreparedPartData.IsValidIndex(HGPOIdx) ? &PreparedPartData[HGPOIdx] : nullptr);
+
+		// Release whatever the mesh creation didn't take from the prepared data
+		if (PreparedPartData.IsValidIndex(HGPOIdx))
+			PreparedPartData[HGPOIdx] = FHoudiniMeshPartData();
 	}
 
 	return FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
@@ -365,6 +562,9 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 					HSMC->NotifyMeshUpdated();
 					HSMC->SetHoudiniIconVisible(true);
 				}
+
+				// The proxy is current again, it must not be hidden by a static mesh build that completes later
+				FHoudiniStaticMeshBuildQueue::Get().RemoveFences(HSMC);
 			}
 
 			// Now, ensure that meshes replaced by proxies are still kept but hidden
@@ -509,15 +709,24 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 				}
 			}
 
-			// Now, ensure that proxies replaced by meshes are still kept but hidden
+			// Now, ensure that proxies replaced by meshes are still kept but hidden.
+			// If the static mesh is still being built asynchronously, keep displaying the proxy
+			// until the mesh is ready: the build queue swaps the components once the build completes.
 			UHoudiniStaticMeshComponent* HSMC = Cast<UHoudiniStaticMeshComponent>(OutputObject.ProxyComponent);
-			if (HSMC)
+			UStaticMeshComponent* SMC = Cast<UStaticMeshComponent>(MeshComponent);
+			const bool bKeepProxyVisible = IsValid(HSMC) && IsValid(SMC) && HSMC->IsVisible()
+				&& FHoudiniStaticMeshBuildQueue::Get().AddFence(SMC->GetStaticMesh(), SMC, HSMC);
+			if (HSMC && !bKeepProxyVisible)
 			{
 				HSMC->SetVisibility(false);
 				HSMC->SetHiddenInGame(true);
 				HSMC->SetHoudiniIconVisible(false);
 			}
 
+			// Without a proxy to display, keep displaying the mesh that is being replaced until its replacement is ready
+			if (!bKeepProxyVisible)
+				FHoudiniStaticMeshBuildQueue::Get().KeepDisplayingReplacedMesh(SMC);
+
 			// If the mesh we just created is templated, hide it in game
 			bool bIsTemplated = FoundHGPO ? FoundHGPO->bIsTemplated : false;
 			if (IsValid(MeshComponent) && bIsTemplated)
@@ -698,11 +907,11 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	bool bSplitMeshSupport,
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	const FMeshBuildSettings& InSMBuildSettings,
-	bool bInTreatExistingMaterialsAsUpToDate)
+	bool bInTreatExistingMaterialsAsUpToDate,
+	FHoudiniMeshPartData* InPreparedPartData)
 {
-	// If we're not forcing the rebuild
 	// No need to recreate something that hasn't changed
-	if (!InForceRebuild && !InHGPO.bHasGeoChanged && !InHGPO.bHasPartChanged && InOutputObjects.Num() > 0)
+	if (!ShouldRebuildPart(InHGPO, InForceRebuild, InOutputObjects.Num() > 0))
 	{
 		// Simply reuse the existing meshes
 		OutOutputObjects = InOutputObjects;
@@ -748,6 +957,7 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	CurrentTranslator.SetStaticMeshGenerationProperties(InSMGenerationProperties);
 	CurrentTranslator.SetStaticMeshBuildSettings(InSMBuildSettings);
 	CurrentTranslator.SetOuterComponent(InOuterComponent);
+	CurrentTranslator.PreparedPartData = InPreparedPartData;
 
 	// TODO: Fetch from settings/HAC
 	CurrentTranslator.DefaultMeshSmoothing = 1;
@@ -784,6 +994,18 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	return true;
 }
 
+bool
+FHoudiniMeshTranslator::ShouldRebuildPart(
+	const FHoudiniGeoPartObject& InHGPO,
+	const bool& bInForceRebuild,
+	const bool& bInHasPreviousOutputObjects)
+{
+	if (bInForceRebuild)
+		return true;
+
+	return InHGPO.bHasGeoChanged || InHGPO.bHasPartChanged || !bInHasPreviousOutputObjects;
+}
+
 bool
 FHoudiniMeshTranslator::UpdatePartVertexList()
 {
@@ -813,7 +1035,13 @@ FHoudiniMeshTranslator::UpdatePartVertexList()
 void
 FHoudiniMeshTranslator::SortSplitGroups()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::SortSplitGroups"));
+	AllSplitGroups = GetSortedSplitGroups(HGPO.SplitGroups);
+}
+
+TArray<FString>
+FHoudiniMeshTranslator::GetSortedSplitGroups(const TArray<FString>& InSplitGroups)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::GetSortedSplitGroups"));
 
 	// Sort the splits in the order that we want to process them:
 	// Simple/Convex invisible colliders should be treated first as they will need to be attached to the visible meshes
@@ -826,7 +1054,7 @@ FHoudiniMeshTranslator::SortSplitGroups()
 	// Finally, visible colliders and invisible complex colliders as they need their own static mesh
 	TArray<FString> Last;
 
-	for (auto& curSplit : HGPO.SplitGroups)
+	for (auto& curSplit : InSplitGroups)
 	{
 		EHoudiniSplitType curSplitType = GetSplitTypeFromSplitName(curSplit);
 		switch (curSplitType)
@@ -857,18 +1085,21 @@ FHoudiniMeshTranslator::SortSplitGroups()
 	LODs.Sort();
 
 	// Copy the split names in order
-	AllSplitGroups.Empty();
+	TArray<FString> SortedSplitGroups;
+	SortedSplitGroups.Reserve(InSplitGroups.Num());
 	for (auto& splitName : First)
-		AllSplitGroups.Add(splitName);
+		SortedSplitGroups.Add(splitName);
 
 	for (auto& splitName : Main)
-		AllSplitGroups.Add(splitName);
+		SortedSplitGroups.Add(splitName);
 
 	for (auto& splitName : LODs)
-		AllSplitGroups.Add(splitName);
+		SortedSplitGroups.Add(splitName);
 
 	for (auto& splitName : Last)
-		AllSplitGroups.Add(splitName);
+		SortedSplitGroups.Add(splitName);
+
+	return SortedSplitGroups;
 }
 
 bool
@@ -876,18 +1107,56 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices"));
 
+	// Fetch the prim membership of the split groups, then build the splits from it
+	FHoudiniMeshPartData PartData;
+	PartData.PartVertexList = MoveTemp(PartVertexList);
+	PartData.bHasVertexList = true;
+	PartData.AllSplitGroups = MoveTemp(AllSplitGroups);
+	FetchSplitGroupMemberships(HGPO, PartData);
+
+	BuildSplitsFacesAndIndices(HGPO, PartData);
+	ApplyPartData(PartData);
+
+	return true;
+}
+
+void
+FHoudiniMeshTranslator::FetchSplitGroupMemberships(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::FetchSplitGroupMemberships"));
+
+	InOutPartData.SplitGroupMemberships.Empty(InOutPartData.AllSplitGroups.Num());
+
+	HAPI_PartInfo PartInfo = FHoudiniEngineUtils::ToHAPIPartInfo(InHGPO.PartInfo);
+	for (const FString& GroupName : InOutPartData.AllSplitGroups)
+	{
+		bool bAllEquals = false;
+		TArray<int32> GroupMembership;
+		if (!FHoudiniEngineUtils::HapiGetGroupMembership(
+			InHGPO.GeoId, PartInfo, HAPI_GROUPTYPE_PRIM, GroupName, GroupMembership, bAllEquals))
+			continue;
+
+		InOutPartData.SplitGroupMemberships.Add(GroupName, MoveTemp(GroupMembership));
+	}
+}
+
+void
+FHoudiniMeshTranslator::BuildSplitsFacesAndIndices(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildSplitsFacesAndIndices"));
+
+	const TArray<int32>& PartVertexList = InOutPartData.PartVertexList;
+
 	// Reset the splits faces/indices arrays
-	AllSplitVertexLists.Empty();
-	AllSplitVertexCounts.Empty();
-	AllSplitFaceIndices.Empty();
-	AllSplitFirstValidVertexIndex.Empty();
-	AllSplitFirstValidPrimIndex.Empty();
+	InOutPartData.AllSplitVertexLists.Empty();
+	InOutPartData.AllSplitVertexCounts.Empty();
+	InOutPartData.AllSplitFaceIndices.Empty();
+	InOutPartData.AllSplitFirstValidVertexIndex.Empty();
+	InOutPartData.AllSplitFirstValidPrimIndex.Empty();
 
-	bool bHasSplit = AllSplitGroups.Num() > 0;
+	bool bHasSplit = InOutPartData.AllSplitGroups.Num() > 0;
 	if (bHasSplit)
 	{
-		HAPI_PartInfo PartInfo = FHoudiniEngineUtils::ToHAPIPartInfo(HGPO.PartInfo);
-
 		// Buffer for all vertex indices used for split groups.
 		// We need this to figure out all vertex indices that are not part of them. 
 		TArray<int32> PartUsedVertices;
@@ -896,16 +1165,16 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		// Buffer for all face indices used for split groups.
 		// We need this to figure out all face indices that are not part of them.
 		TArray<int32> AllGroupFaceIndices;
-		AllGroupFaceIndices.SetNumZeroed(HGPO.PartInfo.FaceCount);
+		AllGroupFaceIndices.SetNumZeroed(InHGPO.PartInfo.FaceCount);
 
 		// Some of the groups may contain invalid geometry 
 		// Store them here so we can remove them afterwards
 		TArray<int32> InvalidGroupNameIndices;
 
 		// Extract the vertices/faces for each of the split groups
-		for (int32 SplitIdx = 0; SplitIdx < AllSplitGroups.Num(); SplitIdx++)
+		for (int32 SplitIdx = 0; SplitIdx < InOutPartData.AllSplitGroups.Num(); SplitIdx++)
 		{
-			const FString& GroupName = AllSplitGroups[SplitIdx];
+			const FString& GroupName = InOutPartData.AllSplitGroups[SplitIdx];
 
 			// New vertex list just for this group.
 			TArray< int32 > GroupVertexList;
@@ -914,12 +1183,12 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 			int32 FirstValidPrimIndex = 0;
 			int32 FirstValidVertexIndex = 0;
 			// Extract vertex indices for this split.
-			int32 GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-				HGPO.GeoId, PartInfo, GroupName,
+			const TArray<int32>* GroupMembership = InOutPartData.SplitGroupMemberships.Find(GroupName);
+			int32 GroupVertexListCount = !GroupMembership ? 0 : FHoudiniEngineUtils::GetVertexListForGroupMembership(
+				*GroupMembership,
 				PartVertexList, GroupVertexList,
 				PartUsedVertices, AllFaceList, AllGroupFaceIndices,
-				FirstValidVertexIndex, FirstValidPrimIndex,
-				HGPO.PartInfo.bIsInstanced);
+				FirstValidVertexIndex, FirstValidPrimIndex);
 
 			if (GroupVertexListCount <= 0)
 			{
@@ -929,17 +1198,17 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 				// Error getting the vertex list.
 				HOUDINI_LOG_MESSAGE(
 					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list for group %s - skipping."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, *GroupName);
+					InHGPO.ObjectId, *InHGPO.ObjectName, InHGPO.GeoId, InHGPO.PartId, *InHGPO.PartName, *GroupName);
 
 				continue;
 			}
 
 			// If list is not empty, we store it for this group - this will define new mesh.
-			AllSplitVertexLists.Add(GroupName, GroupVertexList);
-			AllSplitVertexCounts.Add(GroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(GroupName, AllFaceList);
-			AllSplitFirstValidVertexIndex.Add(GroupName, FirstValidVertexIndex);
-			AllSplitFirstValidPrimIndex.Add(GroupName, FirstValidPrimIndex);
+			InOutPartData.AllSplitVertexLists.Add(GroupName, THoudiniCookScratchArray<int32>(GroupVertexList));
+			InOutPartData.AllSplitVertexCounts.Add(GroupName, GroupVertexListCount);
+			InOutPartData.AllSplitFaceIndices.Add(GroupName, THoudiniCookScratchArray<int32>(AllFaceList));
+			InOutPartData.AllSplitFirstValidVertexIndex.Add(GroupName, FirstValidVertexIndex);
+			InOutPartData.AllSplitFirstValidPrimIndex.Add(GroupName, FirstValidPrimIndex);
 		}
 
 		if (InvalidGroupNameIndices.Num() > 0)
@@ -948,19 +1217,19 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 			for (int32 InvalIdx = InvalidGroupNameIndices.Num() - 1; InvalIdx >= 0; InvalIdx--)
 			{
 				int32 Index = InvalidGroupNameIndices[InvalIdx];
-				AllSplitGroups.RemoveAt(Index);
+				InOutPartData.AllSplitGroups.RemoveAt(Index);
 			}
 		}
 
 		// We also need to figure out / construct the vertex list for everything that's not in a split group
-		TArray<int32> GroupSplitFacesRemaining;
+		THoudiniCookScratchArray<int32> GroupSplitFacesRemaining;
 		GroupSplitFacesRemaining.SetNumUninitialized(PartVertexList.Num());
 		for (int32 n = 0; n < GroupSplitFacesRemaining.Num(); n++)
 			GroupSplitFacesRemaining[n] = -1;
 
 		int32 GroupVertexListCount = 0;
 		bool bHasMainSplitGroup = false;
-		TArray< int32 > GroupSplitFaceIndicesRemaining;
+		THoudiniCookScratchArray<int32> GroupSplitFaceIndicesRemaining;
 		int32 FistUnusedVertexIndex = -1;		
 		for (int32 SplitVertexIdx = 0; SplitVertexIdx < PartUsedVertices.Num(); SplitVertexIdx++)
 		{
@@ -990,12 +1259,12 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		if (bHasMainSplitGroup)
 		{
 			static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
-			AllSplitGroups.Add(RemainingGroupName);
-			AllSplitVertexLists.Add(RemainingGroupName, GroupSplitFacesRemaining);
-			AllSplitVertexCounts.Add(RemainingGroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(RemainingGroupName, GroupSplitFaceIndicesRemaining);
-			AllSplitFirstValidPrimIndex.Add(RemainingGroupName, FistUnusedPrimIndex);
-			AllSplitFirstValidVertexIndex.Add(RemainingGroupName, FistUnusedVertexIndex);
+			InOutPartData.AllSplitGroups.Add(RemainingGroupName);
+			InOutPartData.AllSplitVertexLists.Add(RemainingGroupName, MoveTemp(GroupSplitFacesRemaining));
+			InOutPartData.AllSplitVertexCounts.Add(RemainingGroupName, GroupVertexListCount);
+			InOutPartData.AllSplitFaceIndices.Add(RemainingGroupName, MoveTemp(GroupSplitFaceIndicesRemaining));
+			InOutPartData.AllSplitFirstValidPrimIndex.Add(RemainingGroupName, FistUnusedPrimIndex);
+			InOutPartData.AllSplitFirstValidVertexIndex.Add(RemainingGroupName, FistUnusedVertexIndex);
 		}
 	}
 	else
@@ -1003,22 +1272,164 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		// No splitting required
 		// Mark everything as the main geo group
 		static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
-		AllSplitGroups.Add(RemainingGroupName);
-		AllSplitVertexLists.Add(RemainingGroupName, PartVertexList);
-		AllSplitVertexCounts.Add(RemainingGroupName, PartVertexList.Num());
-		AllSplitFirstValidPrimIndex.Add(RemainingGroupName, 0);
-		AllSplitFirstValidVertexIndex.Add(RemainingGroupName, 0);
-
-		TArray<int32> AllFaces;
-		for (int32 FaceIdx = 0; FaceIdx < HGPO.PartInfo.FaceCount; ++FaceIdx)
+		InOutPartData.AllSplitGroups.Add(RemainingGroupName);
+		InOutPartData.AllSplitVertexLists.Add(RemainingGroupName, THoudiniCookScratchArray<int32>(PartVertexList));
+		InOutPartData.AllSplitVertexCounts.Add(RemainingGroupName, PartVertexList.Num());
+		InOutPartData.AllSplitFirstValidPrimIndex.Add(RemainingGroupName, 0);
+		InOutPartData.AllSplitFirstValidVertexIndex.Add(RemainingGroupName, 0);
+
+		THoudiniCookScratchArray<int32> AllFaces;
+		AllFaces.Reserve(FMath::Max(InHGPO.PartInfo.FaceCount, 0));
+		for (int32 FaceIdx = 0; FaceIdx < InHGPO.PartInfo.FaceCount; ++FaceIdx)
 			AllFaces.Add(FaceIdx);
 
-		AllSplitFaceIndices.Add(RemainingGroupName, AllFaces);
+		InOutPartData.AllSplitFaceIndices.Add(RemainingGroupName, MoveTemp(AllFaces));
+	}
+}
+
+bool
+FHoudiniMeshTranslator::FetchPartData(
+	const FHoudiniGeoPartObject& InHGPO,
+	bool bInSplitMeshSupport,
+	FHoudiniMeshPartData& OutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::FetchPartData"));
+
+	OutPartData = FHoudiniMeshPartData();
+
+	if (InHGPO.PartInfo.VertexCount <= 0)
+		return false;
+
+	// Get the vertex List
+	OutPartData.PartVertexList.SetNumUninitialized(InHGPO.PartInfo.VertexCount);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
+		FHoudiniEngine::Get().GetSession(),
+		InHGPO.GeoId, InHGPO.PartId, OutPartData.PartVertexList.GetData(), 0, InHGPO.PartInfo.VertexCount))
+	{
+		// Error getting the vertex list.
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list - skipping."),
+			InHGPO.ObjectId, *InHGPO.ObjectName, InHGPO.GeoId, InHGPO.PartId, *InHGPO.PartName);
+
+		OutPartData.PartVertexList.Empty();
+		return false;
+	}
+	OutPartData.bHasVertexList = true;
+
+	// Split mesh support uses its own group names, and processes them in the order they were found.
+	// Otherwise, the HGPO's split groups are sorted so colliders are treated first.
+	if (bInSplitMeshSupport)
+	{
+		OutPartData.AllSplitGroups = InHGPO.SplitGroups;
+		GetSplitGroupNames(InHGPO.GeoId, InHGPO.PartId, OutPartData.AllSplitGroups);
 	}
+	else
+	{
+		OutPartData.AllSplitGroups = GetSortedSplitGroups(InHGPO.SplitGroups);
+	}
+
+	FetchSplitGroupMemberships(InHGPO, OutPartData);
+
+	return true;
+}
+
+void
+FHoudiniMeshTranslator::PreparePartData(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::PreparePartData"));
+
+	if (InOutPartData.bIsPrepared || !InOutPartData.bHasVertexList)
+		return;
+
+	BuildSplitsFacesAndIndices(InHGPO, InOutPartData);
+
+	// The memberships aren't needed anymore, release them before the mesh is created
+	InOutPartData.SplitGroupMemberships.Empty();
+	InOutPartData.bIsPrepared = true;
+}
+
+bool
+FHoudiniMeshTranslator::FetchPartAttributes(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& OutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::FetchPartAttributes"));
+
+	// Use the translator's own update functions, so the caches are exactly what the mesh creation would have fetched
+	FHoudiniMeshTranslator AttributeTranslator;
+	AttributeTranslator.SetHoudiniGeoPartObject(InHGPO);
+	AttributeTranslator.ResetPartCache();
+
+	if (!AttributeTranslator.UpdatePartPositionIfNeeded())
+		return false;
+
+	AttributeTranslator.UpdatePartNormalsIfNeeded();
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always)
+		AttributeTranslator.UpdatePartTangentsIfNeeded();
+
+	AttributeTranslator.UpdatePartColorsIfNeeded();
+	AttributeTranslator.UpdatePartAlphasIfNeeded();
+	AttributeTranslator.UpdatePartFaceSmoothingIfNeeded();
+	AttributeTranslator.UpdatePartLightmapResolutionsIfNeeded();
+	AttributeTranslator.UpdatePartFaceMaterialIDsIfNeeded();
+
+	OutPartData.PartPositions = MoveTemp(AttributeTranslator.PartPositions);
+	OutPartData.AttribInfoPositions = AttributeTranslator.AttribInfoPositions;
+	OutPartData.PartNormals = MoveTemp(AttributeTranslator.PartNormals);
+	OutPartData.AttribInfoNormals = AttributeTranslator.AttribInfoNormals;
+	OutPartData.PartTangentU = MoveTemp(AttributeTranslator.PartTangentU);
+	OutPartData.AttribInfoTangentU = AttributeTranslator.AttribInfoTangentU;
+	OutPartData.PartTangentV = MoveTemp(AttributeTranslator.PartTangentV);
+	OutPartData.AttribInfoTangentV = AttributeTranslator.AttribInfoTangentV;
+	OutPartData.PartColors = MoveTemp(AttributeTranslator.PartColors);
+	OutPartData.AttribInfoColors = AttributeTranslator.AttribInfoColors;
+	OutPartData.PartAlphas = MoveTemp(AttributeTranslator.PartAlphas);
+	OutPartData.AttribInfoAlpha = AttributeTranslator.AttribInfoAlpha;
+	OutPartData.PartFaceSmoothingMasks = MoveTemp(AttributeTranslator.PartFaceSmoothingMasks);
+	OutPartData.AttribInfoFaceSmoothingMasks = AttributeTranslator.AttribInfoFaceSmoothingMasks;
+	OutPartData.PartLightMapResolutions = MoveTemp(AttributeTranslator.PartLightMapResolutions);
+	OutPartData.AttribInfoLightmapResolution = AttributeTranslator.AttribInfoLightmapResolution;
+	OutPartData.PartFaceMaterialIds = MoveTemp(AttributeTranslator.PartFaceMaterialIds);
+	OutPartData.bOnlyOneFaceMaterial = AttributeTranslator.bOnlyOneFaceMaterial;
+	OutPartData.bHasAttributes = true;
 
 	return true;
 }
 
+void
+FHoudiniMeshTranslator::ApplyPartData(FHoudiniMeshPartData& InPartData)
+{
+	PartVertexList = MoveTemp(InPartData.PartVertexList);
+	AllSplitGroups = MoveTemp(InPartData.AllSplitGroups);
+	AllSplitVertexLists = MoveTemp(InPartData.AllSplitVertexLists);
+	AllSplitVertexCounts = MoveTemp(InPartData.AllSplitVertexCounts);
+	AllSplitFaceIndices = MoveTemp(InPartData.AllSplitFaceIndices);
+	AllSplitFirstValidVertexIndex = MoveTemp(InPartData.AllSplitFirstValidVertexIndex);
+	AllSplitFirstValidPrimIndex = MoveTemp(InPartData.AllSplitFirstValidPrimIndex);
+
+	if (!InPartData.bHasAttributes)
+		return;
+
+	PartPositions = MoveTemp(InPartData.PartPositions);
+	AttribInfoPositions = InPartData.AttribInfoPositions;
+	PartNormals = MoveTemp(InPartData.PartNormals);
+	AttribInfoNormals = InPartData.AttribInfoNormals;
+	PartTangentU = MoveTemp(InPartData.PartTangentU);
+	AttribInfoTangentU = InPartData.AttribInfoTangentU;
+	PartTangentV = MoveTemp(InPartData.PartTangentV);
+	AttribInfoTangentV = InPartData.AttribInfoTangentV;
+	PartColors = MoveTemp(InPartData.PartColors);
+	AttribInfoColors = InPartData.AttribInfoColors;
+	PartAlphas = MoveTemp(InPartData.PartAlphas);
+	AttribInfoAlpha = InPartData.AttribInfoAlpha;
+	PartFaceSmoothingMasks = MoveTemp(InPartData.PartFaceSmoothingMasks);
+	AttribInfoFaceSmoothingMasks = InPartData.AttribInfoFaceSmoothingMasks;
+	PartLightMapResolutions = MoveTemp(InPartData.PartLightMapResolutions);
+	AttribInfoLightmapResolution = InPartData.AttribInfoLightmapResolution;
+	PartFaceMaterialIds = MoveTemp(InPartData.PartFaceMaterialIds);
+	bOnlyOneFaceMaterial = InPartData.bOnlyOneFaceMaterial;
+}
+
 void
 FHoudiniMeshTranslator::ResetPartCache()
 {
@@ -1104,9 +1515,44 @@ FHoudiniMeshTranslator::UpdatePartPositionIfNeeded()
 			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
 		return false;
 	}
+
+	// Convert all the positions to Unreal at once: swap Y/Z and scale meters to centimeters
+	FHoudiniEngineVectorConversion::ParallelHoudiniToUnrealPositions(
+		PartPositions.GetData(), PartPositions.GetData(), PartPositions.Num() / 3);
+
 	return true;
 }
 
+bool
+FHoudiniMeshTranslator::ReadSplitPositionsDirectly(TConstArrayView<int32> InNeededVertices, TArrayView<FVector3f> OutPositions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::ReadSplitPositionsDirectly"));
+
+	// The positions have already been fetched, the split should use them
+	if (PartPositions.Num() > 0)
+		return false;
+
+	if (InNeededVertices.Num() != HGPO.PartInfo.PointCount || OutPositions.Num() != InNeededVertices.Num())
+		return false;
+
+	for (int32 Idx = 0; Idx < InNeededVertices.Num(); Idx++)
+	{
+		if (InNeededVertices[Idx] != Idx)
+			return false;
+	}
+
+	HAPI_AttributeInfo AttribInfo;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(
+		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId, HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, AttribInfo))
+		return false;
+
+	if (AttribInfo.count != OutPositions.Num())
+		return false;
+
+	return FHoudiniEngineUtils::HapiGetAttributeDataAsPositions(
+		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId, HAPI_UNREAL_ATTRIB_POSITION, AttribInfo, OutPositions);
+}
+
 bool
 FHoudiniMeshTranslator::UpdatePartNormalsIfNeeded()
 {
@@ -1351,15 +1797,18 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 	bHavePrimMaterialOverrides = false;
 	bMaterialOverrideNeedsCreateInstance = false;
 
+	// The overrides are fetched as their unique values, and for each face the index of its value
 	TArray<FString> MaterialOverrides;
+	TArray<int32> MaterialOverrideIndices;
 	TArray<FString> MaterialInstanceOverrides;
+	TArray<int32> MaterialInstanceOverrideIndices;
 	HAPI_AttributeInfo AttribInfoFaceMaterialOverrides;
 	FHoudiniApi::AttributeInfo_Init(&AttribInfoFaceMaterialOverrides);
 	
-	FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+	FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStrings(
 		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
 		HAPI_UNREAL_ATTRIB_MATERIAL,
-		AttribInfoFaceMaterialOverrides, MaterialOverrides);
+		AttribInfoFaceMaterialOverrides, MaterialOverrides, MaterialOverrideIndices);
 	bool bMaterialAttributeExists = AttribInfoFaceMaterialOverrides.exists;
 	HAPI_AttributeOwner MaterialAttrOwner = bMaterialAttributeExists ? AttribInfoFaceMaterialOverrides.owner : HAPI_ATTROWNER_INVALID;
 	if (bMaterialAttributeExists && MaterialAttrOwner != HAPI_ATTROWNER_DETAIL && MaterialAttrOwner != HAPI_ATTROWNER_PRIM)
@@ -1367,14 +1816,15 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 		HOUDINI_LOG_WARNING(TEXT("Static Mesh [%d %s], Geo [%d], Part [%d %s]: " HAPI_UNREAL_ATTRIB_MATERIAL " must be a primitive or detail attribute, ignoring attribute."),
 			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
 		MaterialOverrides.Empty();
+		MaterialOverrideIndices.Empty();
 		bMaterialAttributeExists = false;
 	}
 
 	// If material attribute and fallbacks were not found, check the material instance attribute.
-	FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+	FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStrings(
 		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
 		HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE,
-		AttribInfoFaceMaterialOverrides, MaterialInstanceOverrides);
+		AttribInfoFaceMaterialOverrides, MaterialInstanceOverrides, MaterialInstanceOverrideIndices);
 	bool bMaterialInstanceAttributeExists = AttribInfoFaceMaterialOverrides.exists;
 	const HAPI_AttributeOwner MaterialInstanceAttrOwner = bMaterialInstanceAttributeExists ? AttribInfoFaceMaterialOverrides.owner : HAPI_ATTROWNER_INVALID;
 	if (bMaterialInstanceAttributeExists && MaterialInstanceAttrOwner != HAPI_ATTROWNER_DETAIL && MaterialInstanceAttrOwner != HAPI_ATTROWNER_PRIM)
@@ -1382,17 +1832,18 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 		HOUDINI_LOG_WARNING(TEXT("Static Mesh [%d %s], Geo [%d], Part [%d %s]: " HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE " must be a primitive or detail attribute, ignoring attribute."),
 			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
 		MaterialInstanceOverrides.Empty();
+		MaterialInstanceOverrideIndices.Empty();
 		bMaterialInstanceAttributeExists = false;
 	}
 
 	// If material attribute was not found, check fallback compatibility attribute.
-	if ((!bMaterialAttributeExists && !bMaterialInstanceAttributeExists) || (MaterialOverrides.Num() == 0 && MaterialInstanceOverrides.Num() == 0))
+	if ((!bMaterialAttributeExists && !bMaterialInstanceAttributeExists) || (MaterialOverrideIndices.Num() == 0 && MaterialInstanceOverrideIndices.Num() == 0))
 	{
 		PartFaceMaterialOverrides.Empty();
-		FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+		FHoudiniEngineUtils::HapiGetAttributeDataAsIndexedStrings(
 			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
 			HAPI_UNREAL_ATTRIB_MATERIAL_FALLBACK,
-			AttribInfoFaceMaterialOverrides, MaterialOverrides);
+			AttribInfoFaceMaterialOverrides, MaterialOverrides, MaterialOverrideIndices);
 		bMaterialAttributeExists = AttribInfoFaceMaterialOverrides.exists;
 		MaterialAttrOwner = bMaterialAttributeExists ? AttribInfoFaceMaterialOverrides.owner : HAPI_ATTROWNER_INVALID;
 		if (bMaterialAttributeExists && MaterialAttrOwner != HAPI_ATTROWNER_DETAIL && MaterialAttrOwner != HAPI_ATTROWNER_PRIM)
@@ -1400,6 +1851,7 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 			HOUDINI_LOG_WARNING(TEXT("Static Mesh [%d %s], Geo [%d], Part [%d %s]: " HAPI_UNREAL_ATTRIB_MATERIAL_FALLBACK " must be a primitive or detail attribute, ignoring attribute."),
 				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
 			MaterialOverrides.Empty();
+			MaterialOverrideIndices.Empty();
 			bMaterialAttributeExists = false;
 		}
 	}
@@ -1408,22 +1860,51 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 	if (!bMaterialAttributeExists && !bMaterialInstanceAttributeExists)
 		return false;
 
+	// Build the material info of each unique value once, faces then copy the info of their value
+	auto MakeUniqueMaterialInfos = [](const TArray<FString>& InUniqueValues, const bool& bInMakeMaterialInstance)
+	{
+		TArray<FHoudiniMaterialInfo> MaterialInfos;
+		MaterialInfos.SetNum(InUniqueValues.Num());
+		for (int32 ValueIdx = 0; ValueIdx < InUniqueValues.Num(); ValueIdx++)
+		{
+			if (InUniqueValues[ValueIdx].IsEmpty())
+				continue;
+
+			FHoudiniMaterialInfo& MatInfo = MaterialInfos[ValueIdx];
+			MatInfo.bMakeMaterialInstance = bInMakeMaterialInstance;
+			MatInfo.MaterialObjectPath = InUniqueValues[ValueIdx];
+			ExtractMaterialIndex(MatInfo.MaterialObjectPath, MatInfo.MaterialIndex);
+		}
+		return MaterialInfos;
+	};
+	const TArray<FHoudiniMaterialInfo> MaterialOverrideInfos = MakeUniqueMaterialInfos(MaterialOverrides, false);
+	const TArray<FHoudiniMaterialInfo> MaterialInstanceOverrideInfos = MakeUniqueMaterialInfos(MaterialInstanceOverrides, true);
+
+	// Returns the index of the unique value of an element, or INDEX_NONE if the element doesn't exist or its value is empty
+	auto GetUniqueValueIndex = [](const TArray<FString>& InUniqueValues, const TArray<int32>& InIndices, const int32& InElementIdx)
+	{
+		if (!InIndices.IsValidIndex(InElementIdx))
+			return (int32)INDEX_NONE;
+
+		const int32 ValueIdx = InIndices[InElementIdx];
+		return InUniqueValues[ValueIdx].IsEmpty() ? (int32)INDEX_NONE : ValueIdx;
+	};
+
 	if ((!bMaterialAttributeExists || MaterialAttrOwner == HAPI_ATTROWNER_DETAIL) && (!bMaterialInstanceAttributeExists || MaterialInstanceAttrOwner == HAPI_ATTROWNER_DETAIL))
 	{
 		// either only one attribute exists and is a detail attribute, or both exist and are detail attributes
 		bHavePrimMaterialOverrides = false;
 		FHoudiniMaterialInfo MatInfo;
-		if (MaterialOverrides.IsValidIndex(0) && !MaterialOverrides[0].IsEmpty())
+		const int32 MaterialValueIdx = GetUniqueValueIndex(MaterialOverrides, MaterialOverrideIndices, 0);
+		const int32 MaterialInstanceValueIdx = GetUniqueValueIndex(MaterialInstanceOverrides, MaterialInstanceOverrideIndices, 0);
+		if (MaterialValueIdx != INDEX_NONE)
 		{
-			MatInfo.MaterialObjectPath = MaterialOverrides[0];
-			ExtractMaterialIndex(MatInfo.MaterialObjectPath, MatInfo.MaterialIndex);
+			MatInfo = MaterialOverrideInfos[MaterialValueIdx];
 		}
-		else if (MaterialInstanceOverrides.IsValidIndex(0) && !MaterialInstanceOverrides[0].IsEmpty())
+		else if (MaterialInstanceValueIdx != INDEX_NONE)
 		{
-			MatInfo.bMakeMaterialInstance = true;
 			bMaterialOverrideNeedsCreateInstance = true;
-			MatInfo.MaterialObjectPath = MaterialInstanceOverrides[0];
-			ExtractMaterialIndex(MatInfo.MaterialObjectPath, MatInfo.MaterialIndex);
+			MatInfo = MaterialInstanceOverrideInfos[MaterialInstanceValueIdx];
 		}
 		else
 		{
@@ -1468,17 +1949,16 @@ FHoudiniMeshTranslator::UpdatePartFaceMaterialOverridesIfNeeded()
 			}
 
 			// MaterialOverrides (unreal_material) takes precedence, if non-empty, over MaterialInstanceOverrides (unreal_material_instance)
-			if (MaterialOverrides.IsValidIndex(MaterialOverridesIndex) && !MaterialOverrides[MaterialOverridesIndex].IsEmpty())
+			const int32 MaterialValueIdx = GetUniqueValueIndex(MaterialOverrides, MaterialOverrideIndices, MaterialOverridesIndex);
+			const int32 MaterialInstanceValueIdx = GetUniqueValueIndex(MaterialInstanceOverrides, MaterialInstanceOverrideIndices, MaterialInstanceOverridesIndex);
+			if (MaterialValueIdx != INDEX_NONE)
 			{
-				MatInfo.MaterialObjectPath = MaterialOverrides[MaterialOverridesIndex];
-				ExtractMaterialIndex(MatInfo.MaterialObjectPath, MatInfo.MaterialIndex);
+				MatInfo = MaterialOverrideInfos[MaterialValueIdx];
 			}
-			else if (MaterialInstanceOverrides.IsValidIndex(MaterialInstanceOverridesIndex) && !MaterialInstanceOverrides[MaterialInstanceOverridesIndex].IsEmpty())
+			else if (MaterialInstanceValueIdx != INDEX_NONE)
 			{
-				MatInfo.bMakeMaterialInstance = true;
 				bMaterialOverrideNeedsCreateInstance = true;
-				MatInfo.MaterialObjectPath = MaterialInstanceOverrides[MaterialInstanceOverridesIndex];
-				ExtractMaterialIndex(MatInfo.MaterialObjectPath, MatInfo.MaterialIndex);
+				MatInfo = MaterialInstanceOverrideInfos[MaterialInstanceValueIdx];
 			}
 			else
 			{
@@ -1912,20 +2392,29 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 	// Keep a copy of the initial package params, since PackageParams is modified in place when resolving attributes
 	FHoudiniPackageParams InitialPackageParams = PackageParams;
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	if (PreparedPartData && PreparedPartData->bIsPrepared)
+	{
+		// The vertex list and splits were fetched and prepared ahead of time
+		ResetPartCache();
+		ApplyPartData(*PreparedPartData);
+	}
+	else
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Sort the split groups
-	SortSplitGroups();
+		// Sort the split groups
+		SortSplitGroups();
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
@@ -2009,7 +2498,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		THoudiniCookScratchArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
 
 		// Get valid count of vertex indices for this split.
 		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
@@ -2162,6 +2651,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		{
 			// Try to reuse the existing SM's LOD group instead of the default one
 			LODGroup = CurrentPlatform->GetStaticMeshLODSettings().GetLODGroup(FoundStaticMesh->LODGroup);
+
+			// A displayed mesh keeps its render data until the replacement holding its new version has compiled
+			if (UStaticMesh* ReplacementStaticMesh = FHoudiniStaticMeshBuildQueue::Get().CreateReplacement(FoundStaticMesh))
+				FoundStaticMesh = ReplacementStaticMesh;
 		}
 
 		if (SplitType == EHoudiniSplitType::Normal && !MainStaticMesh)
@@ -2724,10 +3217,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 					continue;
 				}
 
-				// We need to swap Z and Y coordinate here, and convert from m to cm. 
-				RawMesh.VertexPositions[VertexPositionIdx].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				// The part positions have already been converted to Unreal's coordinate system
+				RawMesh.VertexPositions[VertexPositionIdx].X = PartPositions[NeededVertexIndex * 3 + 0];
+				RawMesh.VertexPositions[VertexPositionIdx].Y = PartPositions[NeededVertexIndex * 3 + 1];
+				RawMesh.VertexPositions[VertexPositionIdx].Z = PartPositions[NeededVertexIndex * 3 + 2];
 			}
 
 			if (bHasInvalidPositionIndexData)
@@ -2779,7 +3272,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		// Handle Materials!!!!
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		THoudiniCookScratchArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
 
 		// Fetch the FoundMesh's Static Materials array
 		TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
@@ -3386,43 +3879,15 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
+		// If the mesh is compiled asynchronously, the build queue completes the build
+		// (OnMeshChanged, components swap) once the mesh is ready.
 		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
+		bool bAsyncBuild = FHoudiniStaticMeshBuildQueue::Get().Build(SM);
 		if (bDoTiming)
 		{
 			tick = FPlatformTime::Seconds();
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_RawMesh() - StaticMesh->Build() executed in %f seconds."), tick - build_start);
-		}
-
-		// This replaces the call to RefreshCollision below, but without CreateNavCollision
-		// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// RefreshCollisionChange(*SM);
-		{
-			for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
-
-		UPackage* MeshPackage = SM->GetOutermost();
-		if (IsValid(MeshPackage))
-		{
-			MeshPackage->MarkPackageDirty();
+			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_RawMesh() - StaticMesh->Build() %s in %f seconds."),
+				bAsyncBuild ? TEXT("started") : TEXT("executed"), tick - build_start);
 		}
 
 		if (bDoTiming)
@@ -3455,21 +3920,30 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	// Keep a copy of the initial package params, since PackageParams is modified in place when resolving attributes
 	FHoudiniPackageParams InitialPackageParams = PackageParams;
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	if (PreparedPartData && PreparedPartData->bIsPrepared)
+	{
+		// The vertex list and splits were fetched and prepared ahead of time
+		ResetPartCache();
+		ApplyPartData(*PreparedPartData);
+	}
+	else
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Sort the split groups
-	// Simple colliders first, lods and finally, invisible colliders (that are separate Static Mesh)
-	SortSplitGroups();
+		// Sort the split groups
+		// Simple colliders first, lods and finally, invisible colliders (that are separate Static Mesh)
+		SortSplitGroups();
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
@@ -3551,7 +4025,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		THoudiniCookScratchArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
 
 		// Get valid count of vertex indices for this split.
 		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
@@ -3705,6 +4179,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		{
 			// Try to reuse the existing SM's LOD group instead of the default one
 			LODGroup = CurrentPlatform->GetStaticMeshLODSettings().GetLODGroup(FoundStaticMesh->LODGroup);
+
+			// A displayed mesh keeps its render data until the replacement holding its new version has compiled
+			if (UStaticMesh* ReplacementStaticMesh = FHoudiniStaticMeshBuildQueue::Get().CreateReplacement(FoundStaticMesh))
+				FoundStaticMesh = ReplacementStaticMesh;
 		}
 
 		if (SplitType == EHoudiniSplitType::Normal)
@@ -3815,6 +4293,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			MeshDescription = FoundStaticMesh->CreateMeshDescription(LODIndex);
 			FStaticMeshAttributes(*MeshDescription).Register();
 
+			// The split's temporaries are released as soon as the split is done
+			FHoudiniScratchScope SplitScratchScope;
+
 			// Mesh description uses material to create its PolygonGroups,
 			// so we first need to know how many different materials we have for this split
 			// and what vertices/indices belong to each material for remapping
@@ -3832,20 +4313,22 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 
 			// SplitNeededVertices
 			// Array containing the (unique) part indices for the vertices that are needed for this split
-			TArray<int32> SplitNeededVertices;
+			// Reserved for the worst case so it never grows in the scratch memory
+			THoudiniScratchArray<int32> SplitNeededVertices;
+			SplitNeededVertices.Reserve(SplitVertexList.Num());
 
 			// IndicesMapper:
 			// Maps index values for all vertices in the Part:
 			// - Vertices unused by the split will be set to -1
 			// - Used vertices will have their value set to the "NewIndex" so that IndicesMapper[ partIndex ] => splitIndex
-			TArray<int32> PartToSplitIndicesMapper;
+			THoudiniScratchArray<int32> PartToSplitIndicesMapper;
 			PartToSplitIndicesMapper.SetNumUninitialized(SplitVertexList.Num());
 			for (int32 n = 0; n < PartToSplitIndicesMapper.Num(); n++)
 				PartToSplitIndicesMapper[n] = -1;
 
 			// SplitIndices
 			// Array of SplitIndices used to describe this split's polygons
-			TArray<uint32> SplitIndices;
+			THoudiniScratchArray<uint32> SplitIndices;
 			SplitIndices.SetNumZeroed(SplitVertexCount);
 
 			int32 CurrentSplitIndex = 0;
@@ -3916,9 +4399,6 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			// POSITIONS
 			//---------------------------------------------------------------------------------------------------------------------				
 
-			// Extract position for this part
-			UpdatePartPositionIfNeeded();
-
 			// Transfer vertex positions:
 			//
 			// Because of the split, we're only interested in the needed vertices.
@@ -3930,16 +4410,37 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 
 			bool bHasInvalidPositionIndexData = false;
 			MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
-			for (const int32& NeededVertexIndex : SplitNeededVertices)
+
+			// The vertex IDs of a new mesh description match the needed vertices indices, so if the split
+			// needs all of the part's points, their positions can be read straight into the mesh description
+			const bool bCreateVerticesFirst = MeshDescription->Vertices().GetArraySize() == 0;
+			bool bPositionsRead = false;
+			if (bCreateVerticesFirst)
+			{
+				for (int32 Idx = 0; Idx < SplitNeededVertices.Num(); Idx++)
+					MeshDescription->CreateVertex();
+
+				TArrayView<FVector3f> RawVertexPositions = VertexPositions.GetRawArray();
+				bPositionsRead = RawVertexPositions.Num() >= SplitNeededVertices.Num()
+					&& ReadSplitPositionsDirectly(SplitNeededVertices, RawVertexPositions.Slice(0, SplitNeededVertices.Num()));
+			}
+
+			// Extract position for this part
+			if (!bPositionsRead)
+				UpdatePartPositionIfNeeded();
+
+			for (int32 Idx = 0; !bPositionsRead && Idx < SplitNeededVertices.Num(); Idx++)
 			{
+				const int32& NeededVertexIndex = SplitNeededVertices[Idx];
+
 				// Create a new Vertex
-				FVertexID VertexID = MeshDescription->CreateVertex();
+				FVertexID VertexID = bCreateVerticesFirst ? FVertexID(Idx) : MeshDescription->CreateVertex();
 				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
 				{
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+					// The part positions have already been converted to Unreal's coordinate system
+					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0];
+					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 1];
+					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 2];
 				}
 				else
 				{
@@ -3992,7 +4493,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			TMap<UMaterialInterface*, int32>& MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh = MapUnrealMaterialInterfaceToUnrealIndexPerMesh.FindOrAdd(FoundStaticMesh);
 
 			// Get this split's faces
-			TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
+			THoudiniCookScratchArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
 			// Array holding the materials needed for this split
 			//TArray<UMaterialInterface*> SplitMaterials;
 			// Split Material indices per face, by default all faces are set to use the first Material
@@ -4424,7 +4925,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 					// Normals
 					if (bHasNormal)
 					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm. 
+						// Swap Z and Y to convert the normal to Unreal's coordinate system
 						VertexInstanceNormals[VertexInstanceID].X = SplitNormals[SplitVertexIndex_X];
 						VertexInstanceNormals[VertexInstanceID].Y = SplitNormals[SplitVertexIndex_Y];
 						VertexInstanceNormals[VertexInstanceID].Z = SplitNormals[SplitVertexIndex_Z];
@@ -4821,44 +5322,16 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 
 		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
+		// If the mesh is compiled asynchronously, the build queue completes the build
+		// (OnMeshChanged, components swap) once the mesh is ready.
 		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);		
+		bool bAsyncBuild = FHoudiniStaticMeshBuildQueue::Get().Build(SM);
 
 		if (bDoTiming)
 		{			
 			tick = FPlatformTime::Seconds();
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - StaticMesh->Build() executed in %f seconds."), tick - build_start);
-		}
-
-		// This replaces the call to RefreshCollision below, but without CreateNavCollision
-		// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// RefreshCollisionChange(*SM);
-		{
-			for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
-
-		UPackage* MeshPackage = SM->GetOutermost();
-		if (IsValid(MeshPackage))
-		{
-			MeshPackage->MarkPackageDirty();
+			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - StaticMesh->Build() %s in %f seconds."),
+				bAsyncBuild ? TEXT("started") : TEXT("executed"), tick - build_start);
 		}
 
 		if (bDoTiming)
@@ -4894,20 +5367,44 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	// Keep a copy of the initial package params, since PackageParams is modified in place when resolving attributes
 	FHoudiniPackageParams InitialPackageParams = PackageParams;
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	// Parts that are too large to be fetched at once are streamed, and only have the main geo split
+	const bool bStreamPart = ShouldStreamPart(HGPO);
+	if (PreparedPartData && PreparedPartData->bIsPrepared)
+	{
+		// The vertex list and splits were fetched and prepared ahead of time
+		ResetPartCache();
+		ApplyPartData(*PreparedPartData);
+	}
+	else if (bStreamPart)
+	{
+		ResetPartCache();
 
-	// Sort the split groups
-	SortSplitGroups();
+		// The split's vertex list and face indices are left empty, the whole part is used in order
+		static const FString MainGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
+		AllSplitGroups = { MainGroupName };
+		AllSplitVertexLists.Add(MainGroupName);
+		AllSplitVertexCounts.Add(MainGroupName, HGPO.PartInfo.VertexCount);
+		AllSplitFaceIndices.Add(MainGroupName);
+		AllSplitFirstValidVertexIndex.Add(MainGroupName, 0);
+		AllSplitFirstValidPrimIndex.Add(MainGroupName, 0);
+	}
+	else
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Sort the split groups
+		SortSplitGroups();
+
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Determine if there is "main" geo, if not we'll use the first LOD
 	// as main geo
@@ -5011,7 +5508,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		}
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		THoudiniCookScratchArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
 
 		// Get valid count of vertex indices for this split.
 		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
@@ -5112,8 +5609,22 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			tick = FPlatformTime::Seconds();
 		}
 
-		if (bRebuildStaticMesh)
+		if (bRebuildStaticMesh && bStreamPart)
+		{
+			UpdatePartFaceMaterialOverridesIfNeeded();
+			const bool bHasPerFaceMaterials = PartFaceMaterialOverrides.Num() > 0 || (PartUniqueMaterialIds.Num() > 0 && !bOnlyOneFaceMaterial);
+			if (!StreamPartToHoudiniStaticMesh(FoundStaticMesh, bHasPerFaceMaterials))
+			{
+				HOUDINI_LOG_WARNING(
+					TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] unable to stream the part's geometry."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+			}
+		}
+		else if (bRebuildStaticMesh)
 		{
+			// The split's temporaries are released as soon as the split is done
+			FHoudiniScratchScope SplitScratchScope;
+
 			//--------------------------------------------------------------------------------------------------------------------- 
 			//  INDICES
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -5130,7 +5641,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// - Vertices unused by the split will be set to -1
 			// - Used vertices will have their value set to the "NewIndex"
 			// So that IndicesMapper[ oldIndex ] => newIndex
-			TArray<int32> IndicesMapper;
+			THoudiniScratchArray<int32> IndicesMapper;
 			IndicesMapper.SetNumUninitialized(SplitVertexList.Num());
 			for (int32 n = 0; n < IndicesMapper.Num(); n++)
 				IndicesMapper[n] = -1;
@@ -5140,9 +5651,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// NeededVertices:
 			// Array containing the old index of the needed vertices for the current split
 			// NeededVertices[ newIndex ] => oldIndex
-			TArray< int32 > NeededVertices;
-			NeededVertices.Reserve(SplitVertexList.Num() / 3);
-			TArray< int32 > TriangleIndices;
+			// Both arrays are reserved for the worst case so they never grow in the scratch memory
+			THoudiniScratchArray<int32> NeededVertices;
+			NeededVertices.Reserve(SplitVertexList.Num());
+			THoudiniScratchArray<int32> TriangleIndices;
 			TriangleIndices.Reserve(SplitVertexList.Num());
 
 			{
@@ -5355,7 +5867,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			//--------------------------------------------------------------------------------------------------------------------- 
 			// POSITIONS
 			//--------------------------------------------------------------------------------------------------------------------- 
-			UpdatePartPositionIfNeeded();
+			// If the split needs all of the part's points, read their positions straight into the mesh
+			const bool bPositionsRead = ReadSplitPositionsDirectly(NeededVertices, FoundStaticMesh->GetVertexPositions());
+			if (!bPositionsRead)
+				UpdatePartPositionIfNeeded();
 
 			//
 			// Transfer vertex positions:
@@ -5364,28 +5879,28 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// Instead of declaring all the Positions, we'll only declare the vertices
 			// needed by the current split.
 			//
+			if (!bPositionsRead)
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-				bool bHasInvalidPositionIndexData = false;
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
+				FThreadSafeBool bHasInvalidPositionIndexData(false);
+				ParallelFor(NumVertexPositions, [&](int32 VertexPositionIdx)
 				{
 					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
 					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
 					{
 						// Error retrieving positions.
 						bHasInvalidPositionIndexData = true;
-						continue;
+						return;
 					}
 
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
+					// The part positions have already been converted to Unreal's coordinate system
 					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
+						PartPositions[NeededVertexIndex * 3 + 0],
+						PartPositions[NeededVertexIndex * 3 + 1],
+						PartPositions[NeededVertexIndex * 3 + 2]
 					));
-				}//);
+				});
 
 				if (bHasInvalidPositionIndexData)
 				{
@@ -5405,8 +5920,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
 				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+				ParallelFor(NumTriangles, [&](int32 TriangleIdx)
 				{
 					// TODO: add some additional intermediate consts for index calculations to make the indexing
 					// TODO: code a bit more readable
@@ -5522,7 +6036,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 							}
 						}
 					}
-				}
+				});
 			}
 
 			FMeshBuildSettings BuildSettings;
@@ -5549,7 +6063,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//---------------------------------------------------------------------------------------------------------------------
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		// They are not stored for a streamed part, which uses all of its faces in order.
+		THoudiniCookScratchArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		const int32 NumSplitFaces = bStreamPart ? HGPO.PartInfo.FaceCount : SplitFaceIndices.Num();
 
 		// Fetch the FoundMesh's Static Materials array
 		TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
@@ -5569,9 +6085,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// Array used to avoid constantly attempting to load invalid materials
 			TArray<FHoudiniMaterialIdentifier> InvalidMaterials;
 
-			for (int32 FaceIdx = 0; FaceIdx < SplitFaceIndices.Num(); ++FaceIdx)
+			for (int32 FaceIdx = 0; FaceIdx < NumSplitFaces; ++FaceIdx)
 			{
-				int32 SplitFaceIndex = SplitFaceIndices[FaceIdx];
+				int32 SplitFaceIndex = bStreamPart ? FaceIdx : SplitFaceIndices[FaceIdx];
 				if (!PartFaceMaterialOverrides.IsValidIndex(SplitFaceIndex))
 					continue;
 
@@ -5698,9 +6214,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				// Get default Houdini material.
 				UMaterial * DefaultMaterial = FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get();
 
-				for (int32 FaceIdx = 0; FaceIdx < SplitFaceIndices.Num(); ++FaceIdx)
+				for (int32 FaceIdx = 0; FaceIdx < NumSplitFaces; ++FaceIdx)
 				{
-					int32 SplitFaceIndex = SplitFaceIndices[FaceIdx];
+					int32 SplitFaceIndex = bStreamPart ? FaceIdx : SplitFaceIndices[FaceIdx];
 					if (!PartFaceMaterialIds.IsValidIndex(SplitFaceIndex))
 						continue;
 
@@ -5786,6 +6302,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//		FoundStaticMesh, PropertyAttributes);
 		//}
 
+		// Welding and the vertex cache optimization need several times the mesh's memory: skip them for streamed
+		// parts, which are streamed to bound that memory in the first place.
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		FoundStaticMesh->SetWeldVertices(!bStreamPart && (HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bWeldProxyStaticMeshVertices : true));
 		FoundStaticMesh->Optimize();
 
 		// Check if the mesh is valid (check all the counts (vertex, triangles, vertex instances, UVs etc) but skip
@@ -5835,6 +6355,477 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	return true;
 }
 
+bool
+FHoudiniMeshTranslator::ShouldStreamPart(const FHoudiniGeoPartObject& InHGPO)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const int32 TriangleThreshold = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->MeshStreamingTriangleThreshold : 0;
+	if (TriangleThreshold <= 0 || InHGPO.PartInfo.FaceCount < TriangleThreshold)
+		return false;
+
+	if (InHGPO.SplitGroups.Num() > 0)
+		return false;
+
+	// Triangles only, so that a range of primitives maps to a range of vertices
+	return static_cast<int64>(InHGPO.PartInfo.VertexCount) == static_cast<int64>(InHGPO.PartInfo.FaceCount) * 3;
+}
+
+bool
+FHoudiniMeshTranslator::TransferStreamedAttributeToVertices(
+	const TArray<int32>& InVertexList,
+	const int32& InTriangleStart,
+	const int32& InNumPoints,
+	const HAPI_AttributeOwner& InOwner,
+	const int32& InTupleSize,
+	TFunctionRef<bool(const int32 InStart, const int32 InCount, TArray<float>& OutValues)> InFetcher,
+	TArray<float>& OutWedgeValues)
+{
+	const int32 NumVertices = InVertexList.Num();
+	if (InTupleSize <= 0)
+	{
+		OutWedgeValues.Empty();
+		return false;
+	}
+
+	// Vertex values are already in the triangles' vertex order
+	if (InOwner == HAPI_ATTROWNER_VERTEX)
+	{
+		if (!InFetcher(InTriangleStart * 3, NumVertices, OutWedgeValues) || OutWedgeValues.Num() != NumVertices * InTupleSize)
+		{
+			OutWedgeValues.SetNumZeroed(NumVertices * InTupleSize);
+			return false;
+		}
+
+		return true;
+	}
+
+	// Spans of values to fetch: their first element, and the index of their first value in FetchedValues
+	TArray<int32> SpanStarts;
+	TArray<int32> SpanCounts;
+	TArray<int32> SpanOffsets;
+	if (InOwner == HAPI_ATTROWNER_POINT)
+	{
+		// Range of points used by the triangles, which is compact for most meshes
+		int32 MinPoint = InNumPoints;
+		int32 MaxPoint = -1;
+		for (const int32& PointIdx : InVertexList)
+		{
+			if (PointIdx < 0 || PointIdx >= InNumPoints)
+				continue;
+
+			MinPoint = FMath::Min(MinPoint, PointIdx);
+			MaxPoint = FMath::Max(MaxPoint, PointIdx);
+		}
+
+		if (MaxPoint - MinPoint + 1 <= NumVertices)
+		{
+			SpanStarts.Add(MinPoint);
+			SpanCounts.Add(MaxPoint - MinPoint + 1);
+		}
+		else
+		{
+			// The points are scattered across the part: skip the largest gaps between the used points
+			// until the spans hold no more points than the range has vertices (all of the unique points at worst).
+			TArray<int32> UsedPoints;
+			UsedPoints.Reserve(NumVertices);
+			for (const int32& PointIdx : InVertexList)
+			{
+				if (PointIdx >= 0 && PointIdx < InNumPoints)
+					UsedPoints.Add(PointIdx);
+			}
+			UsedPoints.Sort();
+			UsedPoints.SetNum(Algo::Unique(UsedPoints));
+
+			// Index of the used point after each gap, largest gaps first
+			TArray<int32> Gaps;
+			for (int32 UsedIdx = 1; UsedIdx < UsedPoints.Num(); UsedIdx++)
+			{
+				if (UsedPoints[UsedIdx] - UsedPoints[UsedIdx - 1] > 1)
+					Gaps.Add(UsedIdx);
+			}
+			Gaps.Sort([&UsedPoints](const int32& A, const int32& B)
+			{
+				const int32 GapA = UsedPoints[A] - UsedPoints[A - 1];
+				const int32 GapB = UsedPoints[B] - UsedPoints[B - 1];
+				return GapA != GapB ? GapA > GapB : A < B;
+			});
+
+			int64 SpannedPoints = static_cast<int64>(MaxPoint) - MinPoint + 1;
+			TArray<int32> Cuts;
+			for (const int32& GapIdx : Gaps)
+			{
+				if (SpannedPoints <= NumVertices)
+					break;
+
+				SpannedPoints -= UsedPoints[GapIdx] - UsedPoints[GapIdx - 1] - 1;
+				Cuts.Add(GapIdx);
+			}
+			Cuts.Sort();
+
+			int32 FirstUsedIdx = 0;
+			for (int32 CutIdx = 0; CutIdx <= Cuts.Num(); CutIdx++)
+			{
+				const int32 LastUsedIdx = CutIdx < Cuts.Num() ? Cuts[CutIdx] - 1 : UsedPoints.Num() - 1;
+				SpanStarts.Add(UsedPoints[FirstUsedIdx]);
+				SpanCounts.Add(UsedPoints[LastUsedIdx] - UsedPoints[FirstUsedIdx] + 1);
+				FirstUsedIdx = LastUsedIdx + 1;
+			}
+		}
+	}
+	else if (InOwner == HAPI_ATTROWNER_PRIM)
+	{
+		SpanStarts.Add(InTriangleStart);
+		SpanCounts.Add(NumVertices / 3);
+	}
+	else
+	{
+		SpanStarts.Add(0);
+		SpanCounts.Add(1);
+	}
+
+	TArray<float> FetchedValues;
+	TArray<float> SpanValues;
+	int32 NumFetched = 0;
+	for (int32 SpanIdx = 0; SpanIdx < SpanStarts.Num(); SpanIdx++)
+	{
+		const int32 Count = SpanCounts[SpanIdx];
+		if (Count <= 0 || !InFetcher(SpanStarts[SpanIdx], Count, SpanValues) || SpanValues.Num() != Count * InTupleSize)
+		{
+			OutWedgeValues.SetNumZeroed(NumVertices * InTupleSize);
+			return false;
+		}
+
+		SpanOffsets.Add(NumFetched);
+		NumFetched += Count;
+		if (SpanStarts.Num() == 1)
+			FetchedValues = MoveTemp(SpanValues);
+		else
+			FetchedValues.Append(SpanValues);
+	}
+
+	OutWedgeValues.SetNumUninitialized(NumVertices * InTupleSize);
+	for (int32 VertexIdx = 0; VertexIdx < NumVertices; VertexIdx++)
+	{
+		int32 ValueIdx = 0;
+		if (InOwner == HAPI_ATTROWNER_POINT)
+		{
+			const int32 PointIdx = InVertexList[VertexIdx];
+			const int32 SpanIdx = Algo::UpperBound(SpanStarts, PointIdx) - 1;
+			if (SpanStarts.IsValidIndex(SpanIdx) && PointIdx - SpanStarts[SpanIdx] < SpanCounts[SpanIdx])
+				ValueIdx = SpanOffsets[SpanIdx] + PointIdx - SpanStarts[SpanIdx];
+		}
+		else if (InOwner == HAPI_ATTROWNER_PRIM)
+		{
+			ValueIdx = VertexIdx / 3;
+		}
+
+		FMemory::Memcpy(&OutWedgeValues[VertexIdx * InTupleSize], &FetchedValues[ValueIdx * InTupleSize], InTupleSize * sizeof(float));
+	}
+
+	return true;
+}
+
+bool
+FHoudiniMeshTranslator::StreamPartToHoudiniStaticMesh(UHoudiniStaticMesh* InStaticMesh, const bool& bInHasPerFaceMaterials)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::StreamPartToHoudiniStaticMesh"));
+
+	if (!IsValid(InStaticMesh))
+		return false;
+
+	const HAPI_NodeId NodeId = HGPO.GeoInfo.NodeId;
+	const HAPI_PartId PartId = HGPO.PartInfo.PartId;
+	const int32 NumPoints = HGPO.PartInfo.PointCount;
+	const int32 NumTriangles = HGPO.PartInfo.FaceCount;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bReadNormals = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+	const bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+	const int32 MemoryCeilingMB = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->MeshStreamingMemoryCeilingMB : 256;
+
+	// An attribute transferred to the triangles' vertices, one range at a time
+	struct FStreamedAttribute
+	{
+		FString Name;
+		HAPI_AttributeInfo Info;
+		int32 TupleSize = 0;
+
+		// Values of the current range's triangle vertices, in Houdini's vertex order
+		TArray<float> WedgeValues;
+
+		bool IsValid() const { return TupleSize > 0; }
+	};
+
+	auto FindAttribute = [&](const FString& InName, const int32& InTupleSize, const int32& InMinTupleSize, FStreamedAttribute& OutAttribute)
+	{
+		OutAttribute.Name = InName;
+		if (!FHoudiniEngineUtils::HapiGetAttributeInfo(NodeId, PartId, TCHAR_TO_ANSI(*InName), HAPI_ATTROWNER_INVALID, OutAttribute.Info))
+			return false;
+
+		if (!OutAttribute.Info.exists || OutAttribute.Info.tupleSize < InMinTupleSize)
+			return false;
+
+		OutAttribute.TupleSize = InTupleSize > 0 ? InTupleSize : OutAttribute.Info.tupleSize;
+		return true;
+	};
+
+	HAPI_AttributeInfo AttribInfoP;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(NodeId, PartId, HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, AttribInfoP) || !AttribInfoP.exists)
+		return false;
+
+	FStreamedAttribute Normals;
+	if (bReadNormals)
+		FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_NORMAL), 3, 3, Normals);
+
+	FStreamedAttribute TangentsU;
+	FStreamedAttribute TangentsV;
+	if (bReadTangents)
+	{
+		FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_TANGENTU), 3, 3, TangentsU);
+		FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_TANGENTV), 3, 3, TangentsV);
+	}
+
+	// Tangents are only read along with normals, and generated from the normals if they are missing
+	const bool bHasTangentAttributes = Normals.IsValid() && TangentsU.IsValid() && TangentsV.IsValid();
+	if (!bHasTangentAttributes)
+	{
+		TangentsU = FStreamedAttribute();
+		TangentsV = FStreamedAttribute();
+	}
+	const bool bGenerateTangents = Normals.IsValid() && !bHasTangentAttributes;
+
+	FStreamedAttribute Colors;
+	FStreamedAttribute Alphas;
+	if (FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_COLOR), 0, 3, Colors))
+		FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_ALPHA), 1, 1, Alphas);
+
+	// Same UV set names as FHoudiniEngineUtils::UpdateMeshPartUVSets: uv, uv2, uv3... or uv, uv1, uv2... if uv1 exists
+	TArray<FStreamedAttribute> UVSets;
+	const bool bUV1Exists = FHoudiniEngineUtils::HapiCheckAttributeExists(NodeId, PartId, "uv1");
+	for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
+	{
+		FString UVAttributeName = TEXT(HAPI_UNREAL_ATTRIB_UV);
+		if (TexCoordIdx > 0)
+			UVAttributeName += FString::Printf(TEXT("%d"), bUV1Exists ? TexCoordIdx : TexCoordIdx + 1);
+
+		FStreamedAttribute UVSet;
+		if (FindAttribute(UVAttributeName, 2, 2, UVSet))
+			UVSets.Add(MoveTemp(UVSet));
+	}
+
+	TArray<FStreamedAttribute*> StreamedAttributes;
+	for (FStreamedAttribute* Attribute : { &Normals, &TangentsU, &TangentsV, &Colors, &Alphas })
+	{
+		if (Attribute->IsValid())
+			StreamedAttributes.Add(Attribute);
+	}
+	for (FStreamedAttribute& UVSet : UVSets)
+		StreamedAttributes.Add(&UVSet);
+
+	// Size the ranges so that their vertex list and attribute values stay under the memory ceiling.
+	// Each value may be held twice: once as fetched (point, prim or detail values) and once per triangle vertex.
+	int32 FloatsPerVertex = 0;
+	for (const FStreamedAttribute* Attribute : StreamedAttributes)
+		FloatsPerVertex += Attribute->TupleSize;
+
+	const int64 BytesPerTriangle = 3 * (sizeof(int32) + 2 * sizeof(float) * FloatsPerVertex);
+	const int64 MemoryCeiling = static_cast<int64>(FMath::Max(MemoryCeilingMB, 16)) * 1024 * 1024;
+	const int32 TrianglesPerRange = static_cast<int32>(FMath::Min<int64>(FMath::Max<int64>(MemoryCeiling / BytesPerTriangle, 1024), NumTriangles));
+
+	InStaticMesh->Initialize(
+		NumPoints,
+		NumTriangles,
+		UVSets.Num(),											// NumUVLayers
+		0,														// InitialNumStaticMaterials
+		Normals.IsValid(),										// HasNormals
+		bHasTangentAttributes || bGenerateTangents,				// HasTangents
+		Colors.IsValid(),										// HasColors
+		bInHasPerFaceMaterials									// HasPerFaceMaterials
+	);
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITIONS
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	// All of the part's points are used, their positions are read straight into the mesh
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::StreamPartToHoudiniStaticMesh -- Positions"));
+
+		TArrayView<FVector3f> VertexPositions(InStaticMesh->GetVertexPositions());
+		const int32 PointsPerRange = static_cast<int32>(FMath::Min<int64>(MemoryCeiling / sizeof(FVector3f), MAX_int32));
+		TArray<float> PositionValues;
+		for (int32 PointStart = 0; PointStart < NumPoints; PointStart += PointsPerRange)
+		{
+			const int32 PointCount = FMath::Min(PointsPerRange, NumPoints - PointStart);
+			if (FHoudiniEngineUtils::HapiGetAttributeDataAsPositions(
+				NodeId, PartId, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoP, VertexPositions.Slice(PointStart, PointCount), PointStart))
+				continue;
+
+			// Positions not stored as floats need to be converted
+			HAPI_AttributeInfo AttribInfo;
+			if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				NodeId, PartId, HAPI_UNREAL_ATTRIB_POSITION, AttribInfo, PositionValues, 3, HAPI_ATTROWNER_POINT, PointStart, PointCount)
+				|| PositionValues.Num() != PointCount * 3)
+				return false;
+
+			FHoudiniEngineVectorConversion::HoudiniToUnrealPositions(
+				PositionValues.GetData(), reinterpret_cast<float*>(&VertexPositions[PointStart]), PointCount);
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// TRIANGLES
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	TArray<int32> VertexList;
+	bool bHasInvalidIndices = false;
+	for (int32 TriangleStart = 0; TriangleStart < NumTriangles; TriangleStart += TrianglesPerRange)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::StreamPartToHoudiniStaticMesh -- Range"));
+
+		const int32 TriangleCount = FMath::Min(TrianglesPerRange, NumTriangles - TriangleStart);
+		VertexList.SetNumUninitialized(TriangleCount * 3);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO.GeoId, HGPO.PartId, VertexList.GetData(), TriangleStart * 3, VertexList.Num()))
+		{
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list - skipping."),
+				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
+			return false;
+		}
+		FHoudiniCookStats::AddBytesReceived(sizeof(int32) * static_cast<int64>(VertexList.Num()));
+
+		for (FStreamedAttribute* Attribute : StreamedAttributes)
+		{
+			const bool bTransferred = TransferStreamedAttributeToVertices(
+				VertexList, TriangleStart, NumPoints, Attribute->Info.owner, Attribute->TupleSize,
+				[&](const int32 InStart, const int32 InCount, TArray<float>& OutValues)
+				{
+					HAPI_AttributeInfo AttribInfo;
+					return FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+						NodeId, PartId, TCHAR_TO_ANSI(*Attribute->Name), AttribInfo, OutValues, Attribute->TupleSize, Attribute->Info.owner, InStart, InCount);
+				},
+				Attribute->WedgeValues);
+
+			if (!bTransferred)
+			{
+				HOUDINI_LOG_MESSAGE(
+					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve attribute %s for triangles %d to %d - skipping."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, *Attribute->Name, TriangleStart, TriangleStart + TriangleCount - 1);
+				return false;
+			}
+		}
+
+		const int32 ColorTupleSize = Colors.TupleSize;
+		FThreadSafeBool bRangeHasInvalidIndices(false);
+		ParallelFor(TriangleCount, [&](int32 RangeTriangleIdx)
+		{
+			const int32 TriangleIdx = TriangleStart + RangeTriangleIdx;
+			const int32 TriVertIdx0 = RangeTriangleIdx * 3;
+
+			const int32 WedgeIndices[3] = { VertexList[TriVertIdx0 + 0], VertexList[TriVertIdx0 + 1], VertexList[TriVertIdx0 + 2] };
+			for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+			{
+				if (WedgeIndices[ElementIdx] < 0 || WedgeIndices[ElementIdx] >= NumPoints)
+				{
+					// Keep the invalid face as a degenerate triangle
+					bRangeHasInvalidIndices = true;
+					InStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector::ZeroValue);
+					return;
+				}
+			}
+
+			// Flip wedge indices to fix the winding order.
+			InStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(WedgeIndices[0], WedgeIndices[2], WedgeIndices[1]));
+
+			const int32 TriWindingIndex[3] = { 0, 2, 1 };
+			for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+			{
+				const int32 VertexIdx = TriVertIdx0 + ElementIdx;
+				const uint8 TriangleVertexIdx = TriWindingIndex[ElementIdx];
+
+				if (Normals.IsValid())
+				{
+					// Flip Z and Y coordinate for normal, but don't scale
+					const FVector3f Normal(
+						Normals.WedgeValues[VertexIdx * 3 + 0],
+						Normals.WedgeValues[VertexIdx * 3 + 2],
+						Normals.WedgeValues[VertexIdx * 3 + 1]);
+					InStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriangleVertexIdx, Normal);
+
+					FVector3f TangentU, TangentV;
+					if (bHasTangentAttributes)
+					{
+						TangentU.Set(TangentsU.WedgeValues[VertexIdx * 3 + 0], TangentsU.WedgeValues[VertexIdx * 3 + 2], TangentsU.WedgeValues[VertexIdx * 3 + 1]);
+						TangentV.Set(TangentsV.WedgeValues[VertexIdx * 3 + 0], TangentsV.WedgeValues[VertexIdx * 3 + 2], TangentsV.WedgeValues[VertexIdx * 3 + 1]);
+					}
+					else
+					{
+						Normal.FindBestAxisVectors(TangentU, TangentV);
+					}
+
+					InStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriangleVertexIdx, TangentU);
+					InStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriangleVertexIdx, TangentV);
+				}
+
+				if (Colors.IsValid())
+				{
+					const float* Color = &Colors.WedgeValues[VertexIdx * ColorTupleSize];
+					FLinearColor VertexLinearColor(
+						FMath::Clamp(Color[0], 0.0f, 1.0f),
+						FMath::Clamp(Color[1], 0.0f, 1.0f),
+						FMath::Clamp(Color[2], 0.0f, 1.0f),
+						1.0f);
+
+					if (Alphas.IsValid())
+						VertexLinearColor.A = FMath::Clamp(Alphas.WedgeValues[VertexIdx], 0.0f, 1.0f);
+					else if (ColorTupleSize >= 4)
+						VertexLinearColor.A = FMath::Clamp(Color[3], 0.0f, 1.0f);
+
+					InStaticMesh->SetTriangleVertexColor(TriangleIdx, TriangleVertexIdx, VertexLinearColor.ToFColor(false));
+				}
+
+				for (int32 TexCoordIdx = 0; TexCoordIdx < UVSets.Num(); ++TexCoordIdx)
+				{
+					// We need to flip V coordinate when it's coming from HAPI.
+					const TArray<float>& UVs = UVSets[TexCoordIdx].WedgeValues;
+					InStaticMesh->SetTriangleVertexUV(TriangleIdx, TriangleVertexIdx, TexCoordIdx, FVector2f(UVs[VertexIdx * 2 + 0], 1.0f - UVs[VertexIdx * 2 + 1]));
+				}
+			}
+		});
+
+		bHasInvalidIndices |= bRangeHasInvalidIndices;
+	}
+
+	if (bHasInvalidIndices)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Dynamic Meshes: Object [%d %s], Geo [%d], Part [%d %s] has some invalid face indices"),
+			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
+	}
+
+	FMeshBuildSettings BuildSettings;
+	UpdateMeshBuildSettings(
+		BuildSettings,
+		InStaticMesh->HasNormals(),
+		InStaticMesh->HasTangents(),
+		false);
+	// Compute normals if requested or needed/missing
+	if (BuildSettings.bRecomputeNormals)
+		InStaticMesh->CalculateNormals(BuildSettings.bComputeWeightedNormals);
+
+	// Compute tangents if requested or needed/missing
+	if (BuildSettings.bRecomputeTangents)
+		InStaticMesh->CalculateTangents(BuildSettings.bComputeWeightedNormals);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Streamed part [%d %s] (%d triangles) in ranges of %d triangles."),
+		HGPO.PartId, *HGPO.PartName, NumTriangles, TrianglesPerRange);
+
+	return true;
+}
+
 void
 FHoudiniMeshTranslator::ApplyComplexColliderHelper(
 	UStaticMesh* TargetStaticMesh,
@@ -6195,7 +7186,7 @@ bool
 FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
 {
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
@@ -6217,9 +7208,9 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
 			continue;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0];
+		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 1];
+		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 2];
 	}
 
 #if WITH_EDITOR
@@ -6258,25 +7249,36 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 
 		for (int32 Idx = 0; Idx < Vertices.Num(); Idx++)
 		{
-			Vertices[Idx].X = PartPositions[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Y = PartPositions[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Z = PartPositions[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			Vertices[Idx].X = PartPositions[Idx * 3 + 0];
+			Vertices[Idx].Y = PartPositions[Idx * 3 + 1];
+			Vertices[Idx].Z = PartPositions[Idx * 3 + 2];
 		}
 
-		// We are using Unreal's DecomposeMeshToHulls() 
-		// We need a BodySetup so create a fake/transient one
-		UBodySetup* BodySetup = NewObject<UBodySetup>();
+		// The decomposition is expensive: look for the hulls of an identical group in the cache first
+		uint64 CacheKey = HoudiniCollisionFitCache::HashData(&HullCount, sizeof(HullCount), MaxHullVerts);
+		CacheKey = HoudiniCollisionFitCache::HashData(Indices.GetData(), Indices.Num() * Indices.GetTypeSize(), CacheKey);
+		CacheKey = HoudiniCollisionFitCache::HashData(Vertices.GetData(), Vertices.Num() * Vertices.GetTypeSize(), CacheKey);
 
-		// Run actual util to do the work (if we have some valid input)
-		DecomposeMeshToHulls(BodySetup, Vertices, Indices, HullCount, MaxHullVerts);
+		FKAggregateGeom DecomposedCollisions;
+		if (!HoudiniCollisionFitCache::Find(CacheKey, DecomposedCollisions))
+		{
+			// We are using Unreal's DecomposeMeshToHulls() 
+			// We need a BodySetup so create a fake/transient one
+			UBodySetup* BodySetup = NewObject<UBodySetup>();
+
+			// Run actual util to do the work (if we have some valid input)
+			DecomposeMeshToHulls(BodySetup, Vertices, Indices, HullCount, MaxHullVerts);
+
+			DecomposedCollisions.ConvexElems = BodySetup->AggGeom.ConvexElems;
+			HoudiniCollisionFitCache::Add(CacheKey, DecomposedCollisions);
+		}
 
 		// If we succeed, return here
 		// If not, keep going and we'll try to do a single hull decomposition
-		if (BodySetup->AggGeom.ConvexElems.Num() > 0)
+		if (DecomposedCollisions.ConvexElems.Num() > 0)
 		{
 			// Copy the convex elem to our aggregate
-			for (int32 n = 0; n < BodySetup->AggGeom.ConvexElems.Num(); n++)
-				AggCollisions.ConvexElems.Add(BodySetup->AggGeom.ConvexElems[n]);
+			HoudiniCollisionFitCache::AppendTo(DecomposedCollisions, AggCollisions);
 
 			return true;
 		}
@@ -6297,7 +7299,7 @@ bool
 FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
 {
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
@@ -6320,25 +7322,24 @@ FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupN
 		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
 			continue;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0];
+		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 1];
+		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 2];
 	}
 
-	int32 NewColliders = 0;
+	// Fitted primitives are cached by a hash of the group's points and of the fit type,
+	// so that collision groups that did not change are not fitted again on every cook.
+	enum class ECollisionFitType : uint64 { OrientedBox = 1, Sphere, OrientedSphyl, KDop };
+	ECollisionFitType FitType = ECollisionFitType::KDop;
 	if (SplitGroupName.Contains("Box"))
-	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, AggCollisions);
-	}
+		FitType = ECollisionFitType::OrientedBox;
 	else if (SplitGroupName.Contains("Sphere"))
-	{
-		NewColliders = FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(VertexArray, AggCollisions);
-	}
+		FitType = ECollisionFitType::Sphere;
 	else if (SplitGroupName.Contains("Capsule"))
-	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(VertexArray, AggCollisions);
-	}
-	else
+		FitType = ECollisionFitType::OrientedSphyl;
+
+	TArray<FVector> DirArray;
+	if (FitType == ECollisionFitType::KDop)
 	{
 		// We need to see what type of collision the user wants
 		// by default, a kdop26 will be created
@@ -6366,22 +7367,47 @@ FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupN
 		}
 
 		// Converting the directions to a TArray
-		TArray<FVector> DirArray;
 		DirArray.SetNum(NumDirections);
 		for (uint32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
 		{
 			DirArray[DirectionIndex] = Directions[DirectionIndex];
 		}
+	}
+
+	uint64 CacheKey = HoudiniCollisionFitCache::HashData(DirArray.GetData(), DirArray.Num() * DirArray.GetTypeSize(), static_cast<uint64>(FitType));
+	CacheKey = HoudiniCollisionFitCache::HashData(VertexArray.GetData(), VertexArray.Num() * VertexArray.GetTypeSize(), CacheKey);
+
+	FKAggregateGeom FittedCollisions;
+	if (!HoudiniCollisionFitCache::Find(CacheKey, FittedCollisions))
+	{
+		switch (FitType)
+		{
+			case ECollisionFitType::OrientedBox:
+				FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, FittedCollisions);
+				break;
+			case ECollisionFitType::Sphere:
+				FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(VertexArray, FittedCollisions);
+				break;
+			case ECollisionFitType::OrientedSphyl:
+				FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(VertexArray, FittedCollisions);
+				break;
+			case ECollisionFitType::KDop:
+				FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(VertexArray, DirArray, FittedCollisions);
+				break;
+		}
 
-		NewColliders = FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(VertexArray, DirArray, AggCollisions);
+		HoudiniCollisionFitCache::Add(CacheKey, FittedCollisions);
 	}
 
+	HoudiniCollisionFitCache::AppendTo(FittedCollisions, AggCollisions);
+
+	int32 NewColliders = FittedCollisions.GetElementCount();
 	return (NewColliders > 0);
 }
 
 int32
 FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-	const TArray<int32>& InVertexList,
+	TArrayView<const int32> InVertexList,
 	const HAPI_AttributeInfo& InAttribInfo,
 	const TArray<float>& InData,
 	TArray<float>& OutVertexData)
@@ -6518,7 +7544,7 @@ FHoudiniMeshTranslator::TransferPartAttributesToSplit(
 
 template <typename TYPE>
 int32 FHoudiniMeshTranslator::TransferPartAttributesToSplit(
-	const TArray<int32>& InVertexList,
+	TArrayView<const int32> InVertexList,
 	const HAPI_AttributeInfo& InAttribInfo,
 	const TArray<TYPE>& InData,
 	TArray<TYPE>& OutVertexData)
@@ -6815,7 +7841,9 @@ FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(const TArray<FVecto
 	}
 	// Calculate bounding Box.
 	houdini::gte::OrientedBox3<double> MinimalBox = houdini::gte::OrientedBox3<double>();
-	houdini::gte::MinimumVolumeBox3<double, double> BoxCompute;
+	// The convex hull and the face processing are split in tasks on the task graph
+	const uint32 NumThreads = GetCollisionFitNumThreads();
+	houdini::gte::MinimumVolumeBox3<double, double> BoxCompute(NumThreads, NumThreads > 1);
 	MinimalBox = BoxCompute(NumPoints, Points.GetData(), nullptr);
 	
 	// FVector unitVec = FVector::OneVector;// bs->BuildScale3D;
@@ -6844,14 +7872,24 @@ FHoudiniMeshTranslator::CalcBoundingBox(const TArray<FVector>& PositionArray, FV
 	// Code simplified and adapted to work with a simple vector array from GeomFitUtils.cpp
 	//
 
-	FBox Box(ForceInit);
-	for (const FVector& CurPos : PositionArray)
-	{
-		Box += CurPos;
-	}
+	FBox Box = FHoudiniBoundsUtils::CalcBox(PositionArray.GetData(), PositionArray.Num());
 	Box.GetCenterAndExtents(Center, Extents);
 }
 
+// Returns the positions scaled by LimitVec, or the positions themselves if the scale is one
+static const TArray<FVector>&
+HoudiniScalePositions(const TArray<FVector>& InPositionArray, const FVector& InLimitVec, TArray<FVector>& OutScaledPositions)
+{
+	if (InLimitVec.Equals(FVector::OneVector, 0.0))
+		return InPositionArray;
+
+	OutScaledPositions.SetNumUninitialized(InPositionArray.Num());
+	for (int32 Idx = 0; Idx < InPositionArray.Num(); Idx++)
+		OutScaledPositions[Idx] = InPositionArray[Idx] * InLimitVec;
+
+	return OutScaledPositions;
+}
+
 int32
 FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions)
 {
@@ -6896,111 +7934,10 @@ FHoudiniMeshTranslator::CalcBoundingSphere(const TArray<FVector>& PositionArray,
 	if (PositionArray.Num() == 0)
 		return;
 
-	FBox Box;
-	FVector MinIx[3];
-	FVector MaxIx[3];
-
-	bool bFirstVertex = true;
-	for (const FVector& CurPosition : PositionArray)
-	{
-		FVector p = CurPosition * LimitVec;
-		if (bFirstVertex)
-		{
-			// First, find AABB, remembering furthest points in each dir.
-			Box.Min = p;
-			Box.Max = Box.Min;
-
-			MinIx[0] = CurPosition;
-			MinIx[1] = CurPosition;
-			MinIx[2] = CurPosition;
-
-			MaxIx[0] = CurPosition;
-			MaxIx[1] = CurPosition;
-			MaxIx[2] = CurPosition;
-			bFirstVertex = false;
-			continue;
-		}
-
-		// X //
-		if (p.X < Box.Min.X)
-		{
-			Box.Min.X = p.X;
-			MinIx[0] = CurPosition;
-		}
-		else if (p.X > Box.Max.X)
-		{
-			Box.Max.X = p.X;
-			MaxIx[0] = CurPosition;
-		}
-
-		// Y //
-		if (p.Y < Box.Min.Y)
-		{
-			Box.Min.Y = p.Y;
-			MinIx[1] = CurPosition;
-		}
-		else if (p.Y > Box.Max.Y)
-		{
-			Box.Max.Y = p.Y;
-			MaxIx[1] = CurPosition;
-		}
-
-		// Z //
-		if (p.Z < Box.Min.Z)
-		{
-			Box.Min.Z = p.Z;
-			MinIx[2] = CurPosition;
-		}
-		else if (p.Z > Box.Max.Z)
-		{
-			Box.Max.Z = p.Z;
-			MaxIx[2] = CurPosition;
-		}
-	}
-
-	const FVector Extremes[3] = { (MaxIx[0] - MinIx[0]) * LimitVec,
-		(MaxIx[1] - MinIx[1]) * LimitVec,
-		(MaxIx[2] - MinIx[2]) * LimitVec };
-
-	// Now find extreme points furthest apart, and initial center and radius of sphere.
-	float d2 = 0.f;
-	for (int32 i = 0; i < 3; i++)
-	{
-		const float tmpd2 = Extremes[i].SizeSquared();
-		if (tmpd2 > d2)
-		{
-			d2 = tmpd2;
-			sphere.Center = (MinIx[i] + (0.5f * Extremes[i])) * LimitVec;
-			sphere.W = 0.f;
-		}
-	}
-
-	const FVector Extents = FVector(Extremes[0].X, Extremes[1].Y, Extremes[2].Z);
-
-	// radius and radius squared
-	float r = 0.5f * Extents.GetMax();
-	float r2 = FMath::Square(r);
-
-	// Now check each point lies within this sphere. If not - expand it a bit.
-	for (const FVector& curPos : PositionArray)
-	{
-		const FVector cToP = (curPos * LimitVec) - sphere.Center;
-
-		const float pr2 = cToP.SizeSquared();
-
-		// If this point is outside our current bounding sphere's radius
-		if (pr2 > r2)
-		{
-			// ..expand radius just enough to include this point.
-			const float pr = FMath::Sqrt(pr2);
-			r = 0.5f * (r + pr);
-			r2 = FMath::Square(r);
-
-			sphere.Center += ((pr - r) / pr * cToP);
-		}
-	}
-
-	sphere.W = r;
+	// Ritter's bounding sphere: initial sphere spanning the extreme points furthest apart, grown to include every point
+	TArray<FVector> ScaledPositions;
+	const TArray<FVector>& Positions = HoudiniScalePositions(PositionArray, LimitVec, ScaledPositions);
+	sphere = FHoudiniBoundsUtils::CalcRitterSphere(Positions.GetData(), Positions.Num());
 }
 
 void
@@ -7010,19 +7947,17 @@ FHoudiniMeshTranslator::CalcBoundingSphere2(const TArray<FVector>& PositionArray
 	// Code simplified and adapted to work with a simple vector array from GeomFitUtils.cpp
 	//
 
+	TArray<FVector> ScaledPositions;
+	const TArray<FVector>& Positions = HoudiniScalePositions(PositionArray, LimitVec, ScaledPositions);
+
 	FVector Center, Extents;
-	CalcBoundingBox(PositionArray, Center, Extents, LimitVec);
+	CalcBoundingBox(Positions, Center, Extents, LimitVec);
 
 	sphere.Center = Center;
-	sphere.W = 0.0f;
 
-	for (const FVector& curPos : PositionArray)
-	{
-		float Dist = FVector::DistSquared(curPos * LimitVec, sphere.Center);
-		if (Dist > sphere.W)
-			sphere.W = Dist;
-	}
-	sphere.W = FMath::Sqrt(sphere.W);
+	// The radius is the distance to the furthest point
+	const float MaxDistSquared = FHoudiniBoundsUtils::CalcMaxDistSquared(Positions.GetData(), Positions.Num(), sphere.Center);
+	sphere.W = FMath::Sqrt(MaxDistSquared);
 }
 
 int32 
@@ -7229,13 +8164,13 @@ FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(const TArray<FVector>& InP
 	TempModel->Initialize(nullptr, 1);
 
 	// For each vertex, project along each kdop direction, to find the max in that direction.
-	for (int32 i = 0; i < InPositionArray.Num(); i++)
+	if (InPositionArray.Num() > 0)
 	{
+		TArray<double> SlabExtents;
+		SlabExtents.SetNumUninitialized(kCount);
+		FHoudiniBoundsUtils::CalcSlabExtents(InPositionArray.GetData(), InPositionArray.Num(), Dirs.GetData(), kCount, SlabExtents.GetData());
 		for (int32 j = 0; j < kCount; j++)
-		{
-			float dist = InPositionArray[i] | Dirs[j];
-			maxDist[j] = FMath::Max(dist, maxDist[j]);
-		}
+			maxDist[j] = (float)SlabExtents[j];
 	}
 
 	// Inflate kdop to ensure it is no degenerate
@@ -7828,7 +8763,7 @@ FHoudiniMeshTranslator::UpdateMeshBuildSettings(
 }
 
 
-void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription, FHoudiniGroupedMeshPrimitives& SplitMeshData)
+void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription, FHoudiniGroupedMeshPrimitives& SplitMeshData, int32 InNumMaterialSlots)
 {
 	bool bHasNormal = SplitMeshData.Normals.Num() > 0;
 	bool bHasTangents = SplitMeshData.TangentU.Num() > 0 && SplitMeshData.TangentV.Num() > 0;
@@ -7846,6 +8781,9 @@ void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescript
 	// Don't use the SM's StaticMaterials here as we may not reserve enough polygon groups when adding more materials
 	// Create a polygon group for each material slot.
 	int32 NumberOfMaterials = OutputAssignmentMaterials.Num();
+	if (InNumMaterialSlots != INDEX_NONE)
+		NumberOfMaterials = FMath::Min(NumberOfMaterials, InNumMaterialSlots);
+
 	if (NumberOfMaterials <= 0)
 	{
 		// No materials, create a polygon group for the default one
@@ -7856,8 +8794,12 @@ void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescript
 	{
 		MeshDescription->ReserveNewPolygonGroups(NumberOfMaterials);
 		//for (int32 MatIndex = 0; MatIndex < NumberOfMaterials; ++MatIndex)
+		int32 NumPolygonGroups = 0;
 		for (auto& CurrentMatAssignement : OutputAssignmentMaterials)
 		{
+			if (NumPolygonGroups++ >= NumberOfMaterials)
+				break;
+
 			const FPolygonGroupID& PolygonGroupID = MeshDescription->CreatePolygonGroup();
 			PolygonGroupImportedMaterialSlotNames[PolygonGroupID] =
 				FName(CurrentMatAssignement.Value ? *(CurrentMatAssignement.Value->GetName()) : *(CurrentMatAssignement.Key.MaterialObjectPath));
@@ -7868,16 +8810,36 @@ void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescript
 
 	bool bHasInvalidPositionIndexData = false;
 	MeshDescription->ReserveNewVertices(SplitMeshData.NeededVertices.Num());
-	for (const int32& NeededVertexIndex : SplitMeshData.NeededVertices)
+
+	// The vertex IDs of a new mesh description match the needed vertices indices, so if the split
+	// needs all of the part's points, their positions can be read straight into the mesh description
+	const bool bCreateVerticesFirst = MeshDescription->Vertices().GetArraySize() == 0;
+	bool bPositionsRead = false;
+	if (bCreateVerticesFirst)
 	{
+		for (int32 Idx = 0; Idx < SplitMeshData.NeededVertices.Num(); Idx++)
+			MeshDescription->CreateVertex();
+
+		TArrayView<FVector3f> RawVertexPositions = VertexPositions.GetRawArray();
+		bPositionsRead = RawVertexPositions.Num() >= SplitMeshData.NeededVertices.Num()
+			&& ReadSplitPositionsDirectly(SplitMeshData.NeededVertices, RawVertexPositions.Slice(0, SplitMeshData.NeededVertices.Num()));
+	}
+
+	if (!bPositionsRead)
+		UpdatePartPositionIfNeeded();
+
+	for (int32 Idx = 0; !bPositionsRead && Idx < SplitMeshData.NeededVertices.Num(); Idx++)
+	{
+		const int32& NeededVertexIndex = SplitMeshData.NeededVertices[Idx];
+
 		// Create a new Vertex
-		FVertexID VertexID = MeshDescription->CreateVertex();
+		FVertexID VertexID = bCreateVerticesFirst ? FVertexID(Idx) : MeshDescription->CreateVertex();
 		if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
 		{
-			// We need to swap Z and Y coordinate here, and convert from m to cm. 
-			VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			// The part positions have already been converted to Unreal's coordinate system
+			VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0];
+			VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 1];
+			VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 2];
 		}
 		else
 		{
@@ -7949,7 +8911,7 @@ void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescript
 			// Normals
 			if (bHasNormal)
 			{
-				// We need to swap Z and Y coordinate here, and convert from m to cm. 
+				// Swap Z and Y to convert the normal to Unreal's coordinate system
 				VertexInstanceNormals[VertexInstanceID].X = SplitMeshData.Normals[SplitVertexIndex_X];
 				VertexInstanceNormals[VertexInstanceID].Y = SplitMeshData.Normals[SplitVertexIndex_Y];
 				VertexInstanceNormals[VertexInstanceID].Z = SplitMeshData.Normals[SplitVertexIndex_Z];
@@ -8051,6 +9013,28 @@ void FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescript
 	FStaticMeshOperations::ConvertSmoothGroupToHardEdges(FaceSmoothingMasks, *MeshDescription);
 }
 
+void FHoudiniMeshTranslator::BuildLODMeshDescriptions(
+	FHoudiniSplitGroupMesh& Mesh,
+	const TArray<int32>& InLODNumMaterialSlots,
+	TArray<FMeshDescription>& OutMeshDescriptions,
+	EParallelForFlags InFlags)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildLODMeshDescriptions"));
+
+	const int32 NumLODs = Mesh.LODRenders.Num();
+	OutMeshDescriptions.Empty(NumLODs);
+	OutMeshDescriptions.SetNum(NumLODs);
+	ParallelFor(NumLODs, [&](int32 LODIndex)
+	{
+		FMeshDescription& MeshDescription = OutMeshDescriptions[LODIndex];
+		FStaticMeshAttributes(MeshDescription).Register();
+		BuildMeshDescription(
+			&MeshDescription,
+			Mesh.SplitMeshData[Mesh.LODRenders[LODIndex]],
+			InLODNumMaterialSlots.IsValidIndex(LODIndex) ? InLODNumMaterialSlots[LODIndex] : INDEX_NONE);
+	}, InFlags);
+}
+
 void FHoudiniMeshTranslator::ProcessMaterials(UStaticMesh* FoundStaticMesh, FHoudiniGroupedMeshPrimitives& SplitMeshData)
 {
 	// Map of Houdini Material IDs to Unreal Material Interface
@@ -8085,7 +9069,7 @@ void FHoudiniMeshTranslator::ProcessMaterials(UStaticMesh* FoundStaticMesh, FHou
 	TMap<UMaterialInterface*, int32>& MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh = MapUnrealMaterialInterfaceToUnrealIndexPerMesh.FindOrAdd(FoundStaticMesh);
 
 	// Get this split's faces
-	TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitMeshData.SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitMeshData.SplitGroupName];
 	// Array holding the materials needed for this split
 	//TArray<UMaterialInterface*> SplitMaterials;
 	// Split Material indices per face, by default all faces are set to use the first Material
@@ -8417,7 +9401,7 @@ void FHoudiniMeshTranslator::PullMeshData(FHoudiniGroupedMeshPrimitives& SplitMe
 	// POSITIONS
 	//---------------------------------------------------------------------------------------------------------------------				
 
-	UpdatePartPositionIfNeeded();
+	// The positions are only fetched by BuildMeshDescription(), which can read them straight into the mesh description
 
 	//--------------------------------------------------------------------------------------------------------------------- 
 	// MATERIALS
@@ -8862,7 +9846,14 @@ FHoudiniMeshTranslator::RemovePreviousOutputs()
 UStaticMesh* 
 FHoudiniMeshTranslator::CreateStaticMesh(const FString & MeshName, int NumLODs)
 {
-	UStaticMesh* StaticMesh = CreateNewUnrealStaticMesh(MeshName);
+	// Recreating the previous mesh would reuse it in place and release its render data. If it is displayed,
+	// build into a replacement instead: it is swapped onto the components once it has compiled.
+	const FHoudiniOutputObject* PreviousOutputObject = InputObjects.Find(FHoudiniOutputObjectIdentifier(HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, MeshName));
+	UStaticMesh* PreviousStaticMesh = PreviousOutputObject ? Cast<UStaticMesh>(PreviousOutputObject->OutputObject) : nullptr;
+	UStaticMesh* StaticMesh = FHoudiniStaticMeshBuildQueue::Get().CreateReplacement(PreviousStaticMesh);
+	const bool bIsReplacement = StaticMesh != nullptr;
+	if (!bIsReplacement)
+		StaticMesh = CreateNewUnrealStaticMesh(MeshName);
 
 	if (!IsValid(StaticMesh))
 		return nullptr;
@@ -8889,7 +9880,9 @@ FHoudiniMeshTranslator::CreateStaticMesh(const FString & MeshName, int NumLODs)
 		StaticMesh->SetLightMapResolution(LODGroup.GetDefaultLightMapResolution());
 	}
 
-	FAssetRegistryModule::AssetCreated(StaticMesh);
+	// Replacements become the previous asset once they are swapped in
+	if (!bIsReplacement)
+		FAssetRegistryModule::AssetCreated(StaticMesh);
 
 	return StaticMesh;
 }
@@ -8905,6 +9898,11 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 
 	bDoTiming = CVarHoudiniEngineMeshBuildTimer.GetValueOnAnyThread() != 0.0;
 
+	// The prepared part data can hold the face material IDs, apply it before creating the materials
+	const bool bHasPreparedPartData = PreparedPartData && PreparedPartData->bIsPrepared;
+	if (bHasPreparedPartData)
+		ApplyPartData(*PreparedPartData);
+
 	// Update the part's material's IDS and info now
 	CreateNeededMaterials();
 
@@ -8913,18 +9911,20 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 	// Fetch all part data that is need to generated meshes.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
-	UpdatePartVertexList();
+	if (!bHasPreparedPartData)
+		UpdatePartVertexList();
 
 	//  Get a list of all Static Meshes  to build.
 	FHoudiniMeshToBuild MeshesToBuild = FHoudiniMeshTranslator::ScanOutputForMeshesToBuild();
-	AllSplitGroups = HGPO.SplitGroups;
-
 
 	// Builds the corresponding faces and indices arrays. This will also add a new split group if it finds any un-assinged primitives. These
-	// are added to the main_geo group,.
-	
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+	// are added to the main_geo group,. The prepared part data already contains them.
+	if (!bHasPreparedPartData)
+	{
+		AllSplitGroups = HGPO.SplitGroups;
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
+	}
 
 	// was the main_geo group added?
 	if (AllSplitGroups.Num() > HGPO.SplitGroups.Num())
@@ -8936,9 +9936,61 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 	// Loop through and build each mesh.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
-	for (auto & It : MeshesToBuild.Meshes)
+	int32 NumMeshDescriptions = 0;
+	for (const auto& It : MeshesToBuild.Meshes)
+		NumMeshDescriptions += It.Value.LODRenders.Num();
+
+	if (NumMeshDescriptions > 1 && FHoudiniOutputTranslator::IsParallelTranslationEnabled())
+	{
+		// Pull the data of every mesh first, then build the mesh descriptions of all of the meshes' LODs concurrently,
+		// and finally finish the meshes in order.
+		TArray<FHoudiniSplitGroupMesh*> PulledMeshes;
+		TArray<TArray<int32>> MeshesLODNumMaterialSlots;
+		TArray<TPair<int32, int32>> MeshLODs;
+		for (auto& It : MeshesToBuild.Meshes)
+		{
+			TArray<int32> LODNumMaterialSlots;
+			if (!PullSplitGroupMeshData(It.Key, It.Value, LODNumMaterialSlots))
+				continue;
+
+			for (int32 LODIndex = 0; LODIndex < It.Value.LODRenders.Num(); LODIndex++)
+				MeshLODs.Add(TPair<int32, int32>(PulledMeshes.Num(), LODIndex));
+
+			PulledMeshes.Add(&It.Value);
+			MeshesLODNumMaterialSlots.Add(MoveTemp(LODNumMaterialSlots));
+		}
+
+		// If the positions can't be fetched, the meshes build their descriptions in place
+		TArray<TArray<FMeshDescription>> MeshesLODDescriptions;
+		MeshesLODDescriptions.SetNum(PulledMeshes.Num());
+		if (UpdatePartPositionIfNeeded())
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildSplitGroupMeshDescriptions"));
+
+			for (int32 MeshIdx = 0; MeshIdx < PulledMeshes.Num(); MeshIdx++)
+				MeshesLODDescriptions[MeshIdx].SetNum(PulledMeshes[MeshIdx]->LODRenders.Num());
+
+			ParallelFor(MeshLODs.Num(), [&](int32 MeshLODIdx)
+			{
+				const int32 MeshIdx = MeshLODs[MeshLODIdx].Key;
+				const int32 LODIndex = MeshLODs[MeshLODIdx].Value;
+				FHoudiniSplitGroupMesh& Mesh = *PulledMeshes[MeshIdx];
+
+				FMeshDescription& MeshDescription = MeshesLODDescriptions[MeshIdx][LODIndex];
+				FStaticMeshAttributes(MeshDescription).Register();
+				BuildMeshDescription(&MeshDescription, Mesh.SplitMeshData[Mesh.LODRenders[LODIndex]], MeshesLODNumMaterialSlots[MeshIdx][LODIndex]);
+			});
+		}
+
+		for (int32 MeshIdx = 0; MeshIdx < PulledMeshes.Num(); MeshIdx++)
+			FinishStaticMeshFromSplitGroups(*PulledMeshes[MeshIdx], MeshesLODNumMaterialSlots[MeshIdx], MeshesLODDescriptions[MeshIdx]);
+	}
+	else
 	{
-		CreateStaticMeshFromSplitGroups(It.Key, It.Value);
+		for (auto & It : MeshesToBuild.Meshes)
+		{
+			CreateStaticMeshFromSplitGroups(It.Key, It.Value);
+		}
 	}
 
 	// Once all meshes have been built, patch up custom collision refences
@@ -8965,10 +10017,36 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 {
 	double TimeStart = FPlatformTime::Seconds();
 
+	TArray<int32> LODNumMaterialSlots;
+	if (!PullSplitGroupMeshData(MeshName, SplitMeshData, LODNumMaterialSlots))
+		return false;
+
+	// With several LODs, build their mesh descriptions concurrently once the positions have been fetched.
+	// A single LOD is built in place, so it can read its positions straight into the mesh description.
+	TArray<FMeshDescription> LODMeshDescriptions;
+	if (SplitMeshData.LODRenders.Num() > 1 && UpdatePartPositionIfNeeded())
+		BuildLODMeshDescriptions(SplitMeshData, LODNumMaterialSlots, LODMeshDescriptions);
+
+	const bool bSuccess = FinishStaticMeshFromSplitGroups(SplitMeshData, LODNumMaterialSlots, LODMeshDescriptions);
+
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+	// Print results.
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+
+	double TimeEnd = FPlatformTime::Seconds();
+	if (bDoTiming)
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMeshFromSplitGroups() executed in %f seconds."), TimeEnd - TimeStart);
+
+	return bSuccess;
+}
+
+bool
+FHoudiniMeshTranslator::PullSplitGroupMeshData(const FString& MeshName, FHoudiniSplitGroupMesh& SplitMeshData, TArray<int32>& OutLODNumMaterialSlots)
+{
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 	// Set up data
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
-;
+
 	int NumLODs = SplitMeshData.LODRenders.Num();
 	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
 	bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
@@ -9017,17 +10095,47 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 	// Build Description based off the Houdini data.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
-	for(int LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	// Pull the data of every LOD first: this fills the part caches, which are then only read from.
+	// Keep track of the materials each LOD knew about, so its polygon groups don't depend on the following LODs.
+	OutLODNumMaterialSlots.SetNum(NumLODs);
+	for (int LODIndex = 0; LODIndex < NumLODs; LODIndex++)
 	{
-
 		auto & RenderGroup = SplitMeshData.SplitMeshData[SplitMeshData.LODRenders[LODIndex]];
 
 		RenderGroup.VertexList = AllSplitVertexLists[RenderGroup.SplitGroupName];
 		PullMeshData(RenderGroup, SplitMeshData.UnrealStaticMesh, LODIndex, bReadTangents);
+		OutLODNumMaterialSlots[LODIndex] = OutputAssignmentMaterials.Num();
+	}
+
+	return true;
+}
 
-		FMeshDescription* MeshDescription = SplitMeshData.UnrealStaticMesh->CreateMeshDescription(LODIndex);
-		FStaticMeshAttributes(*MeshDescription).Register();
-		BuildMeshDescription(MeshDescription, RenderGroup);
+bool
+FHoudiniMeshTranslator::FinishStaticMeshFromSplitGroups(
+	FHoudiniSplitGroupMesh& SplitMeshData,
+	const TArray<int32>& InLODNumMaterialSlots,
+	TArray<FMeshDescription>& InLODMeshDescriptions)
+{
+	const int NumLODs = SplitMeshData.LODRenders.Num();
+	FHoudiniOutputObject* OutputObject = OutputObjects.Find(SplitMeshData.OutputObjectIdentifier);
+	if (!OutputObject)
+		return false;
+
+	for(int LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+
+		auto & RenderGroup = SplitMeshData.SplitMeshData[SplitMeshData.LODRenders[LODIndex]];
+
+		if (InLODMeshDescriptions.IsValidIndex(LODIndex))
+		{
+			SplitMeshData.UnrealStaticMesh->CreateMeshDescription(LODIndex, MoveTemp(InLODMeshDescriptions[LODIndex]));
+		}
+		else
+		{
+			FMeshDescription* MeshDescription = SplitMeshData.UnrealStaticMesh->CreateMeshDescription(LODIndex);
+			FStaticMeshAttributes(*MeshDescription).Register();
+			BuildMeshDescription(MeshDescription, RenderGroup, InLODNumMaterialSlots[LODIndex]);
+		}
 
 		bool bHasNormal = RenderGroup.Normals.Num() > 0;
 		bool bHasTangents = RenderGroup.TangentU.Num() > 0 || RenderGroup.TangentV.Num() > 0;
@@ -9148,44 +10256,15 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 
 	double BuildTimeStart = FPlatformTime::Seconds();
 
-	TArray<FText> SMBuildErrors;
 	SplitMeshData.UnrealStaticMesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
-	SplitMeshData.UnrealStaticMesh->Build(true, &SMBuildErrors);
 
-	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-	{
-		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-		if (StaticMeshComponent->GetStaticMesh() == SplitMeshData.UnrealStaticMesh)
-		{
-			// it needs to recreate IF it already has been created
-			if (StaticMeshComponent->IsPhysicsStateCreated())
-			{
-				StaticMeshComponent->RecreatePhysicsState();
-			}
-		}
-	}
-
-	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-
-	SplitMeshData.UnrealStaticMesh->GetOnMeshChanged().Broadcast();
-
-	UPackage* MeshPackage = SplitMeshData.UnrealStaticMesh->GetOutermost();
-	if (IsValid(MeshPackage))
-	{
-		MeshPackage->MarkPackageDirty();
-	}
+	// If the mesh is compiled asynchronously, the build queue completes the build
+	// (OnMeshChanged, components swap) once the mesh is ready.
+	bool bAsyncBuild = FHoudiniStaticMeshBuildQueue::Get().Build(SplitMeshData.UnrealStaticMesh);
 
 	double BuildTimeEnd = FPlatformTime::Seconds();
 	if (bDoTiming)
-		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), BuildTimeEnd - BuildTimeStart);
-
-	//-----------------------------------------------------------------------------------------------------------------------------------------------
-	// Print results.
-	//-----------------------------------------------------------------------------------------------------------------------------------------------
-
-	double TimeEnd = FPlatformTime::Seconds();
-	if (bDoTiming)
-		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMeshFromSplitGroups() executed in %f seconds."), TimeEnd - TimeStart);
+		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() %s in %f seconds."), bAsyncBuild ? TEXT("started") : TEXT("executed"), BuildTimeEnd - BuildTimeStart);
 
 	return true;
 }
@@ -9194,16 +10273,20 @@ void FHoudiniMeshTranslator::UpdateSplitGroups()
 {
 	// The old code (per-split groups) uses slightly different conditions to fill in the HGPO.SplitGroups. This function
 	// fetches the groups using the new method.
+	GetSplitGroupNames(HGPO.GeoId, HGPO.PartId, HGPO.SplitGroups);
+}
 
+bool FHoudiniMeshTranslator::GetSplitGroupNames(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, TArray<FString>& OutGroupNames)
+{
 	HAPI_PartInfo PartInfo;
 	FHoudiniApi::PartInfo_Init(&PartInfo);
 	HAPI_Result Error = HAPI_RESULT_FAILURE;
-	Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), HGPO.GeoId, HGPO.PartId, &PartInfo);
+	Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo);
 
 	TArray<FString> GroupNames;
-	if (!FHoudiniEngineUtils::HapiGetGroupNames(HGPO.GeoId, HGPO.PartId, HAPI_GROUPTYPE_PRIM, PartInfo.isInstanced, GroupNames))
+	if (!FHoudiniEngineUtils::HapiGetGroupNames(InGeoId, InPartId, HAPI_GROUPTYPE_PRIM, PartInfo.isInstanced, GroupNames))
 	{
-		return;
+		return false;
 	}
 
 	TArray<FString> Results;
@@ -9220,7 +10303,8 @@ void FHoudiniMeshTranslator::UpdateSplitGroups()
 		}
 	}
 
-	HGPO.SplitGroups = Results;
+	OutGroupNames = Results;
+	return true;
 }
 
 bool
@@ -9234,6 +10318,11 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshesFromSplitGroups()
 
 	bDoTiming = CVarHoudiniEngineMeshBuildTimer.GetValueOnAnyThread() != 0.0;
 
+	// The prepared part data can hold the face material IDs, apply it before creating the materials
+	const bool bHasPreparedPartData = PreparedPartData && PreparedPartData->bIsPrepared;
+	if (bHasPreparedPartData)
+		ApplyPartData(*PreparedPartData);
+
 	// Update the part's material's IDS and info now
 	CreateNeededMaterials();
 
@@ -9242,18 +10331,20 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshesFromSplitGroups()
 	// Fetch all part data that is need to generated meshes.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
-	UpdatePartVertexList();
+	if (!bHasPreparedPartData)
+		UpdatePartVertexList();
 
 	//  Get a list of all Static Meshes  to build.
 	FHoudiniMeshToBuild MeshesToBuild = FHoudiniMeshTranslator::ScanOutputForMeshesToBuild();
-	AllSplitGroups = HGPO.SplitGroups;
-
 
 	// Builds the corresponding faces and indices arrays. This will also add a new split group if it finds any un-assinged primitives. These
-	// are added to the main_geo group,.
-
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+	// are added to the main_geo group,. The prepared part data already contains them.
+	if (!bHasPreparedPartData)
+	{
+		AllSplitGroups = HGPO.SplitGroups;
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
+	}
 
 	// was the main_geo group added?
 	if (AllSplitGroups.Num() > HGPO.SplitGroups.Num())
@@ -9313,7 +10404,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshFromSplitGroups(const FString& Me
 	FString & SplitGroupName = Group.SplitGroupName;
 
 	// Get the vertex indices for this group
-	TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
 
 	// Get valid count of vertex indices for this split.
 	const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
@@ -9404,6 +10495,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshFromSplitGroups(const FString& Me
 	//		FoundStaticMesh, PropertyAttributes);
 	//}
 
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	FoundStaticMesh->SetWeldVertices(HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bWeldProxyStaticMeshVertices : true);
 	FoundStaticMesh->Optimize();
 
 	// Check if the mesh is valid (check all the counts (vertex, triangles, vertex instances, UVs etc) but skip
@@ -9451,7 +10544,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshFromSplitGroups(const FString& Me
 void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHoudiniStaticMesh* FoundStaticMesh)
 {
 	// Get the vertex indices for this group
-	TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
 
 	// Get valid count of vertex indices for this split.
 	const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
@@ -9713,7 +10806,10 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 	//--------------------------------------------------------------------------------------------------------------------- 
 	// POSITIONS
 	//--------------------------------------------------------------------------------------------------------------------- 
-	UpdatePartPositionIfNeeded();
+	// If the split needs all of the part's points, read their positions straight into the mesh
+	const bool bPositionsRead = ReadSplitPositionsDirectly(NeededVertices, FoundStaticMesh->GetVertexPositions());
+	if (!bPositionsRead)
+		UpdatePartPositionIfNeeded();
 
 	//
 	// Transfer vertex positions:
@@ -9722,28 +10818,28 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 	// Instead of declaring all the Positions, we'll only declare the vertices
 	// needed by the current split.
 	//
+	if (!bPositionsRead)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-		bool bHasInvalidPositionIndexData = false;
-		for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-			//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
+		FThreadSafeBool bHasInvalidPositionIndexData(false);
+		ParallelFor(NumVertexPositions, [&](int32 VertexPositionIdx)
 		{
 			int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
 			if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
 			{
 				// Error retrieving positions.
 				bHasInvalidPositionIndexData = true;
-				continue;
+				return;
 			}
 
-			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			// The part positions have already been converted to Unreal's coordinate system
 			FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-				PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
+				PartPositions[NeededVertexIndex * 3 + 0],
+				PartPositions[NeededVertexIndex * 3 + 1],
+				PartPositions[NeededVertexIndex * 3 + 2]
 			));
-		}//);
+		});
 
 		if (bHasInvalidPositionIndexData)
 		{
@@ -9763,8 +10859,7 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
 		// Now add the triangles to the mesh
-		for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-			// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+		ParallelFor(NumTriangles, [&](int32 TriangleIdx)
 		{
 			// TODO: add some additional intermediate consts for index calculations to make the indexing
 			// TODO: code a bit more readable
@@ -9880,7 +10975,7 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 					}
 				}
 			}
-		}
+		});
 	}
 
 	FMeshBuildSettings BuildSettings;
@@ -9911,7 +11006,7 @@ FHoudiniMeshTranslator::ProcessMaterialsForHSM(
 	TMap<UHoudiniStaticMesh*, TMap<UMaterialInterface*, int32>> & MapUnrealMaterialInterfaceToUnrealIndexPerMesh)
 {
 	// Get face indices for this split.
-	TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+	THoudiniCookScratchArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
 
 	// Fetch the FoundMesh's Static Materials array
 	TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
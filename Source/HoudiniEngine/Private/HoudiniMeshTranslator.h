@@ -32,8 +32,10 @@
 #include "HoudiniPackageParams.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniMaterialTranslator.h"
+#include "HoudiniScratchAllocator.h"
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #include "UObject/ObjectMacros.h"
 #include "PhysicsEngine/AggregateGeom.h"
 
@@ -93,7 +95,7 @@ struct FHoudiniGroupedMeshPrimitives
 {
 	// Groups of primitives to be used for FHoudiniSplitGroupMesh.
 
-	TArray<int32> VertexList;
+	THoudiniCookScratchArray<int32> VertexList;
 	TArray<float> Normals;
 	TArray<float> TangentU;
 	TArray<float> TangentV;
@@ -148,6 +150,53 @@ struct FHoudiniMeshToBuild
 	TMap<FString, FHoudiniSplitGroupMesh> Meshes;
 };
 
+// Plain data of a mesh part, fetched from HAPI ahead of the mesh creation.
+// It doesn't reference any UObject: once fetched, it can be prepared on any thread.
+struct HOUDINIENGINE_API FHoudiniMeshPartData
+{
+	// Vertex Indices for the part
+	TArray<int32> PartVertexList;
+	bool bHasVertexList = false;
+
+	// Names of the groups used for splitting the geometry, in processing order
+	TArray<FString> AllSplitGroups;
+
+	// Prim membership of each split group, groups that couldn't be fetched are missing
+	TMap<FString, TArray<int32>> SplitGroupMemberships;
+
+	// Per-split data, built when preparing. Allocated in the cook's scratch arena when prepared during a cook.
+	THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> AllSplitVertexLists;
+	THoudiniCookScratchMap<FString, int32> AllSplitVertexCounts;
+	THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> AllSplitFaceIndices;
+	THoudiniCookScratchMap<FString, int32> AllSplitFirstValidVertexIndex;
+	THoudiniCookScratchMap<FString, int32> AllSplitFirstValidPrimIndex;
+
+	// Indicates the split data has been built
+	bool bIsPrepared = false;
+
+	// Attribute caches of the part, fetched and converted along with the vertex list.
+	// The UV sets are left to the mesh creation, as the different mesh methods don't read them the same way.
+	TArray<float> PartPositions;
+	HAPI_AttributeInfo AttribInfoPositions;
+	TArray<float> PartNormals;
+	HAPI_AttributeInfo AttribInfoNormals;
+	TArray<float> PartTangentU;
+	HAPI_AttributeInfo AttribInfoTangentU;
+	TArray<float> PartTangentV;
+	HAPI_AttributeInfo AttribInfoTangentV;
+	TArray<float> PartColors;
+	HAPI_AttributeInfo AttribInfoColors;
+	TArray<float> PartAlphas;
+	HAPI_AttributeInfo AttribInfoAlpha;
+	TArray<int32> PartFaceSmoothingMasks;
+	HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
+	TArray<int32> PartLightMapResolutions;
+	HAPI_AttributeInfo AttribInfoLightmapResolution;
+	TArray<int32> PartFaceMaterialIds;
+	bool bOnlyOneFaceMaterial = false;
+	bool bHasAttributes = false;
+};
+
 struct HOUDINIENGINE_API FHoudiniMeshTranslator
 {
 	public:
@@ -183,7 +232,47 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			bool bSplitMeshSupport,
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			const FMeshBuildSettings& InMeshBuildSettings,
-			bool bInTreatExistingMaterialsAsUpToDate = false);
+			bool bInTreatExistingMaterialsAsUpToDate = false,
+			FHoudiniMeshPartData* InPreparedPartData = nullptr);
+
+		// Returns true if the mesh of a part has to be (re)built, false if its previous output objects can be reused.
+		static bool ShouldRebuildPart(
+			const FHoudiniGeoPartObject& InHGPO,
+			const bool& bInForceRebuild,
+			const bool& bInHasPreviousOutputObjects);
+
+		// Fetches the vertex list and the split groups' membership of a mesh part.
+		// The positions are left to the mesh creation, so they can be read directly into the mesh when possible.
+		// This calls HAPI and must be called from the thread that owns the session.
+		static bool FetchPartData(
+			const FHoudiniGeoPartObject& InHGPO,
+			bool bInSplitMeshSupport,
+			FHoudiniMeshPartData& OutPartData);
+
+		// Builds the split faces and indices of fetched part data.
+		// This doesn't call HAPI or touch any UObject and can be called from any thread.
+		static void PreparePartData(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData);
+
+		// Fetches and converts the part's attribute caches (positions, normals, colors...) into the part data.
+		// This calls HAPI on the session set for the calling thread, and can be called from worker threads.
+		static bool FetchPartAttributes(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& OutPartData);
+
+		// Returns true if the part is large enough to be streamed when creating its UHoudiniStaticMesh.
+		// Only parts made of triangles and without split groups (colliders, LODs) can be streamed.
+		static bool ShouldStreamPart(const FHoudiniGeoPartObject& InHGPO);
+
+		// Transfers an attribute's values to the triangle vertices of one range of a streamed part.
+		// InFetcher fetches InCount values of the attribute's owner, starting at InStart.
+		// Point values are fetched in spans of the points used by the range: when they are scattered across the part,
+		// the largest gaps are skipped so that no more point values than the range's vertices are fetched.
+		static bool TransferStreamedAttributeToVertices(
+			const TArray<int32>& InVertexList,
+			const int32& InTriangleStart,
+			const int32& InNumPoints,
+			const HAPI_AttributeOwner& InOwner,
+			const int32& InTupleSize,
+			TFunctionRef<bool(const int32 InStart, const int32 InCount, TArray<float>& OutValues)> InFetcher,
+			TArray<float>& OutWedgeValues);
 
 		static bool CreateOrUpdateAllComponents(
 			UHoudiniOutput* InOutput,
@@ -202,14 +291,14 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// TODO: Rename me! and template me! float/int/string ?
 		// TransferPartAttributesToSplitVertices
 		static int32 TransferRegularPointAttributesToVertices(
-			const TArray<int32>& InVertexList,
+			TArrayView<const int32> InVertexList,
 			const HAPI_AttributeInfo& InAttribInfo,
 			const TArray<float>& InData,
 			TArray<float>& OutVertexData);
 
 		template <typename TYPE>
 		static int32 TransferPartAttributesToSplit(
-			const TArray<int32>& InVertexList,
+			TArrayView<const int32> InVertexList,
 			const HAPI_AttributeInfo& InAttribInfo,
 			const TArray<TYPE>& InData,
 			TArray<TYPE>& OutSplitData);
@@ -306,6 +395,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Create a UHoudiniStaticMesh
 		bool CreateHoudiniStaticMesh();
 
+		// Fills InStaticMesh with the whole part, fetching its vertex list and attributes one range of primitives at a time.
+		// Each range is converted and written to the mesh before the next one is fetched.
+		bool StreamPartToHoudiniStaticMesh(UHoudiniStaticMesh* InStaticMesh, const bool& bInHasPerFaceMaterials);
+
 		bool CreateHoudiniStaticMeshesFromSplitGroups();
 
 		// Helper to make and populate a FHoudiniOutputObjectIdentifier from the current HGPO and the given
@@ -324,12 +417,32 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		bool UpdatePartVertexList();
 
 		void SortSplitGroups();
+
+		// Returns InSplitGroups in the order they should be processed in
+		static TArray<FString> GetSortedSplitGroups(const TArray<FString>& InSplitGroups);
+
+		// Fetches the names of the prim groups used to split meshes when split mesh support is on
+		static bool GetSplitGroupNames(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, TArray<FString>& OutGroupNames);
 				
 		bool UpdateSplitsFacesAndIndices();
 
+		// Fetches the prim membership of each of the split groups
+		static void FetchSplitGroupMemberships(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData);
+
+		// Builds the per-split vertex lists and faces from the part's vertex list and the split groups' membership
+		static void BuildSplitsFacesAndIndices(const FHoudiniGeoPartObject& InHGPO, FHoudiniMeshPartData& InOutPartData);
+
+		// Moves the vertex list, splits and positions of InPartData into this translator's caches
+		void ApplyPartData(FHoudiniMeshPartData& InPartData);
+
 		// Update this part's position cache if we haven't already
 		bool UpdatePartPositionIfNeeded();
 
+		// Reads the part's positions straight into OutPositions if the split needs all of the part's points in order,
+		// and the part's position cache hasn't been filled. This avoids allocating and copying the whole part positions.
+		// Returns false if the split's positions have to be transferred from the position cache instead.
+		bool ReadSplitPositionsDirectly(TConstArrayView<int32> InNeededVertices, TArrayView<FVector3f> OutPositions);
+
 		// Update this part's normal cache if we haven't already
 		bool UpdatePartNormalsIfNeeded();
 
@@ -446,6 +559,9 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// The HoudiniGeoPartObject we're working on
 		FHoudiniGeoPartObject HGPO;
 
+		// Part data fetched and prepared ahead of the mesh creation, if any
+		FHoudiniMeshPartData* PreparedPartData = nullptr;
+
 		// Outer object for attaching components to
 		UObject* OuterComponent = nullptr;
 
@@ -482,24 +598,24 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		TArray<FString> AllSplitGroups;
 
 		// Per-split lists of faces
-		TMap<FString, TArray<int32>> AllSplitVertexLists;
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> AllSplitVertexLists;
 
 		// Per-split number of faces
-		TMap<FString, int32> AllSplitVertexCounts;
+		THoudiniCookScratchMap<FString, int32> AllSplitVertexCounts;
 
 		// Per-split indices arrays
-		TMap<FString, TArray<int32>> AllSplitFaceIndices;
+		THoudiniCookScratchMap<FString, THoudiniCookScratchArray<int32>> AllSplitFaceIndices;
 
 		// Per-split first valid vertex index
-		TMap<FString, int32> AllSplitFirstValidVertexIndex;
+		THoudiniCookScratchMap<FString, int32> AllSplitFirstValidVertexIndex;
 
 		// Per-split first valid prim index
-		TMap<FString, int32> AllSplitFirstValidPrimIndex;
+		THoudiniCookScratchMap<FString, int32> AllSplitFirstValidPrimIndex;
 
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
 
-		// Positions
+		// Positions, already converted to Unreal's coordinate system
 		TArray<float> PartPositions;
 		HAPI_AttributeInfo AttribInfoPositions;
 
@@ -577,7 +693,17 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// mesh descriptions. They are used by the split mesh generation code.
 		////////////////////////////////////////////////////////////////////////////////////////
 		
-		void BuildMeshDescription(FMeshDescription *MeshDesc, FHoudiniGroupedMeshPrimitives & SplitMeshData);
+		// Only the first InNumMaterialSlots assignment materials get a polygon group, or all of them if INDEX_NONE.
+		// This doesn't call HAPI if the part positions have already been fetched.
+		void BuildMeshDescription(FMeshDescription *MeshDesc, FHoudiniGroupedMeshPrimitives & SplitMeshData, int32 InNumMaterialSlots = INDEX_NONE);
+
+		// Builds the mesh description of each of the mesh's LODs on its own worker, unless InFlags forces a single thread.
+		// The part positions must have been fetched, and the LODs' data pulled.
+		void BuildLODMeshDescriptions(
+			FHoudiniSplitGroupMesh& Mesh,
+			const TArray<int32>& InLODNumMaterialSlots,
+			TArray<FMeshDescription>& OutMeshDescriptions,
+			EParallelForFlags InFlags = EParallelForFlags::None);
 
 		void ProcessMaterials(UStaticMesh* FoundStaticMesh, FHoudiniGroupedMeshPrimitives& SplitMeshData);
 
@@ -599,6 +725,17 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		bool CreateStaticMeshFromSplitGroups(const FString & Name, FHoudiniSplitGroupMesh & Mesh);
 
+		// Creates the static mesh and output object of a split group mesh, and pulls the data of its LODs.
+		// OutLODNumMaterialSlots receives the number of materials known to each LOD, see BuildMeshDescription.
+		bool PullSplitGroupMeshData(const FString & Name, FHoudiniSplitGroupMesh & Mesh, TArray<int32>& OutLODNumMaterialSlots);
+
+		// Commits the LODs' mesh descriptions and builds the collisions and the static mesh of a pulled split group mesh.
+		// LODs missing from InLODMeshDescriptions have their description built in place.
+		bool FinishStaticMeshFromSplitGroups(
+			FHoudiniSplitGroupMesh & Mesh,
+			const TArray<int32>& InLODNumMaterialSlots,
+			TArray<FMeshDescription>& InLODMeshDescriptions);
+
 		bool CreateHoudiniStaticMeshFromSplitGroups(const FString& Name, FHoudiniSplitGroupMesh& Mesh,
 			TMap<HAPI_NodeId, UMaterialInterface*> & MapHoudiniMatIdToUnrealInterface,
 			TMap<FHoudiniMaterialIdentifier, UMaterialInterface*> & MapHoudiniMatAttributesToUnrealInterface,
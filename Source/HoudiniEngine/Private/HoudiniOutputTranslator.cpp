@@ -39,8 +39,10 @@
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniCookStats.h"
 #include "HoudiniSplineComponent.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniInput.h"
 #include "HoudiniStaticMesh.h"
 
@@ -82,6 +84,20 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelOutputTranslation(
+	TEXT("HoudiniEngine.ParallelOutputTranslation"),
+	1,
+	TEXT("Fetch and convert the data of the mesh, instancer and heightfield parts on worker threads before creating their outputs.\n")
+	TEXT("0: Fetches and converts each part's data on the game thread, when creating its output\n")
+	TEXT("1: Default, uses worker threads\n")
+);
+
+bool
+FHoudiniOutputTranslator::IsParallelTranslationEnabled()
+{
+	return CVarHoudiniEngineParallelOutputTranslation.GetValueOnAnyThread() != 0;
+}
+
 //
 bool
 FHoudiniOutputTranslator::UpdateOutputs(
@@ -92,6 +108,13 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	if (!IsValid(HAC))
 		return false;
 
+	// Intern the HAPI strings resolved while building and processing the outputs of this cook,
+	// so the handles shared by parts and attributes are only resolved once
+	FHoudiniEngineStringTableScope StringTableScope;
+
+	// Catalog the attributes of the geo nodes translated by this cook, until its outputs have been processed
+	FHoudiniEngineAttributeCatalogScope AttributeCatalogScope(FHoudiniEngine::Get().GetAttributeCatalog());
+
 	RemovePreviousOutputs(HAC);
 
 	// Outputs that should be cleared, but only AFTER new output processing have taken place.
@@ -105,9 +128,15 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		TArray<UHoudiniOutput*> NewOutputs;
 		TArray<HAPI_NodeId> OutputNodes = HAC->GetOutputNodeIds();
 		TMap<HAPI_NodeId, int32> OutputNodeCookCounts = HAC->GetOutputNodeCookCounts();
-		if (FHoudiniOutputTranslator::BuildAllOutputs(
-			HAC->GetAssetId(), HAC, OutputNodes, OutputNodeCookCounts,
-			HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos, HAC->bUseOutputNodes))
+		bool bOutputsBuilt = false;
+		{
+			FHoudiniCookStatsPhaseScope OutputFetchScope(EHoudiniCookStatsPhase::OutputFetch);
+			bOutputsBuilt = FHoudiniOutputTranslator::BuildAllOutputs(
+				HAC->GetAssetId(), HAC, OutputNodes, OutputNodeCookCounts,
+				HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos, HAC->bUseOutputNodes);
+		}
+
+		if (bOutputsBuilt)
 		{
 			// NOTE: For now we are currently forcing all outputs to be cleared here. There is still an issue where, in some
 			// circumstances, landscape tiles disappear when clearing outputs after processing.
@@ -338,6 +367,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				if (bIsProxyStaticMeshEnabled)
 					MeshMethod = EHoudiniStaticMeshMethod::UHoudiniStaticMesh;
 				
+				FHoudiniCookStatsPhaseScope MeshBuildScope(EHoudiniCookStatsPhase::MeshBuild);
 				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 					CurOutput, 
 					PackageParams, 
@@ -489,6 +519,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 
 		case EHoudiniOutputType::Skeletal:
 		{
+			FHoudiniCookStatsPhaseScope MeshBuildScope(EHoudiniCookStatsPhase::MeshBuild);
 			FHoudiniSkeletalMeshTranslator::CreateAllSkeletalMeshesAndComponentsFromHoudiniOutput(
 				CurOutput, PackageParams, AllOutputMaterials, OuterComponent);
 
@@ -719,6 +750,9 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	if (!IsValid(HAC))
 		return false;
 
+	// Refining proxies is triggered from the editor, outside of the HAC's processing
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HAC));
+
 	UObject* OuterComponent = HAC;
 
 	FHoudiniPackageParams PackageParams;
@@ -1344,6 +1378,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			if (!CurrentCookCounts.Contains(CurrentHapiGeoInfo.nodeId))
 			{
 				CurrentCookCounts.Add(CurrentHapiGeoInfo.nodeId, FHoudiniEngineUtils::HapiGetCookCount(CurrentHapiGeoInfo.nodeId));
+
+				// The attribute catalogs of the geo's parts are valid as long as its cook count doesn't change
+				FHoudiniEngine::Get().GetAttributeCatalog().SetCookCount(CurrentHapiGeoInfo.nodeId, CurrentCookCounts[CurrentHapiGeoInfo.nodeId]);
 			}
 			
 			if (OutputNodeCookCounts.Contains(CurrentHapiGeoInfo.nodeId))
@@ -2712,6 +2749,9 @@ FHoudiniOutputTranslator::ClearAndRemoveOutputs(UHoudiniAssetComponent *InHAC, T
 {
 	if (!IsValid(InHAC))
 		return;
+
+	// Clearing outputs may delete nodes (ie editable curves), also called when baking
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InHAC));
 	
 	// DO NOT MANUALLY DESTROY THE OLD/DANGLING OUTPUTS!
 	// This messes up unreal's Garbage collection and would cause crashes on duplication
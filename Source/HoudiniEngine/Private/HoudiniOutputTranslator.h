@@ -106,4 +106,7 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 
 	static void RemovePreviousOutputs(UHoudiniAssetComponent* HAC);
 
+	// Returns true if the parts' data can be fetched and converted on worker threads (HoudiniEngine.ParallelOutputTranslation)
+	static bool IsParallelTranslationEnabled();
+
 };
\ No newline at end of file
@@ -36,6 +36,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniPDGAssetLink.h"
 #include "HoudiniPackageParams.h"
@@ -63,6 +64,9 @@ FHoudiniPDGManager::~FHoudiniPDGManager()
 bool
 FHoudiniPDGManager::InitializePDGAssetLink(UHoudiniAssetComponent* InHAC)
 {
+	// PDG nodes only exist in the session of the HAC that instantiated them
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InHAC));
+
 	if (!IsValid(InHAC))
 		return false;
 
@@ -156,6 +160,8 @@ FHoudiniPDGManager::InitializePDGAssetLink(UHoudiniAssetComponent* InHAC)
 bool
 FHoudiniPDGManager::UpdatePDGAssetLink(UHoudiniPDGAssetLink* PDGAssetLink)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(PDGAssetLink));
+
 	if (!IsValid(PDGAssetLink))
 		return false;
 
@@ -213,6 +219,8 @@ FHoudiniPDGManager::UpdatePDGAssetLink(UHoudiniPDGAssetLink* PDGAssetLink)
 bool
 FHoudiniPDGManager::PopulateTOPNetworks(UHoudiniPDGAssetLink* PDGAssetLink, bool bInZeroWorkItemTallys)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(PDGAssetLink));
+
 	// Find all TOP networks from linked HDA, as well as the TOP nodes within, and populate internal state.
 	if (!IsValid(PDGAssetLink))
 		return false;
@@ -553,6 +561,8 @@ FHoudiniPDGManager::PopulateTOPNodes(
 void 
 FHoudiniPDGManager::DirtyTOPNode(UTOPNode* InTOPNode)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNode));
+
 	if (!IsValid(InTOPNode))
 		return;
 	
@@ -581,6 +591,8 @@ FHoudiniPDGManager::DirtyTOPNode(UTOPNode* InTOPNode)
 bool
 FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNode));
+
 	if (!IsValid(InTOPNode))
 		return false;
 		
@@ -607,6 +619,8 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 void
 FHoudiniPDGManager::DirtyAll(UTOPNetwork* InTOPNet)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNet));
+
 	if (!IsValid(InTOPNet))
 		return;
 	
@@ -626,6 +640,8 @@ FHoudiniPDGManager::DirtyAll(UTOPNetwork* InTOPNet)
 bool
 FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNet));
+
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::CookOutput);
 
 	// Cook the output TOP node of the currently selected TOP network.
@@ -682,6 +698,8 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 void 
 FHoudiniPDGManager::PauseCook(UTOPNetwork* InTOPNet)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNet));
+
 	// Pause the PDG cook of the currently selected TOP network
 	//WorkItemTally.ZeroAll();
 	//UHoudiniPDGAssetLink::ResetTOPNetworkWorkItemTally(InTOPNet);
@@ -712,6 +730,8 @@ FHoudiniPDGManager::PauseCook(UTOPNetwork* InTOPNet)
 void
 FHoudiniPDGManager::CancelCook(UTOPNetwork* InTOPNet)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InTOPNet));
+
 	// Cancel the PDG cook of the currently selected TOP network
 	//WorkItemTally.ZeroAll();
 	//UHoudiniPDGAssetLink::ResetTOPNetworkWorkItemTally(InTOPNet);
@@ -770,65 +790,75 @@ FHoudiniPDGManager::Update()
 	ProcessWorkItemResults();
 }
 
-// Query all the PDG graph context in the current Houdini Engine session.
+// Query all the PDG graph context in the Houdini Engine sessions used by the PDG asset links.
 // Handle PDG events, work item status updates.
 // Forward relevant events to PDGAssetLink objects.
 void
 FHoudiniPDGManager::UpdatePDGContexts()
 {
-	// Get current PDG graph contexts
-	ReinitializePDGContext();
+	// The asset links' HACs can be spread across the session pool: process the graph contexts of each of their sessions
+	TArray<int32> SessionIndices;
+	for (const TWeakObjectPtr<UHoudiniPDGAssetLink>& CurAssetLink : PDGAssetLinks)
+		SessionIndices.AddUnique(FHoudiniEngineRuntime::GetSessionIndexForObject(CurAssetLink.Get()));
 
-	// Process next set of events for each graph context
-	if (PDGContextIDs.Num() > 0)
+	for (const int32 SessionIndex : SessionIndices)
 	{
-		// Only initialize event array if not valid, or user resized max size
-		if(PDGEventInfos.Num() != MaxNumberOfPDGEvents)
-			PDGEventInfos.SetNum(MaxNumberOfPDGEvents);
-
-		// TODO: member?
-		//HAPI_PDG_State PDGState;
-		for(const HAPI_PDG_GraphContextId& CurrentContextID : PDGContextIDs)
-		{
-			/*
-			// TODO: No need to reset events at each tick
-			int32 PDGStateInt;
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGState(
-			FHoudiniEngine::Get().GetSession(), CurrentContextID, &PDGStateInt))
+		FHoudiniEngineScopedSession ScopedSession(SessionIndex);
+
+		// Get current PDG graph contexts
+		ReinitializePDGContext();
+
+		// Process next set of events for each graph context
+		if (PDGContextIDs.Num() > 0)
+		{
+			// Only initialize event array if not valid, or user resized max size
+			if(PDGEventInfos.Num() != MaxNumberOfPDGEvents)
+				PDGEventInfos.SetNum(MaxNumberOfPDGEvents);
+
+			// TODO: member?
+			//HAPI_PDG_State PDGState;
+			for(const HAPI_PDG_GraphContextId& CurrentContextID : PDGContextIDs)
 			{
-			HOUDINI_LOG_ERROR(TEXT("Failed to get PDG state"));
-			continue;
-			}
+				/*
+				// TODO: No need to reset events at each tick
+				int32 PDGStateInt;
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGState(
+				FHoudiniEngine::Get().GetSession(), CurrentContextID, &PDGStateInt))
+				{
+				HOUDINI_LOG_ERROR(TEXT("Failed to get PDG state"));
+				continue;
+				}
 
-			PDGState = (HAPI_PDG_State)PDGStateInt;
+				PDGState = (HAPI_PDG_State)PDGStateInt;
 			
-			for (int32 Idx = 0; Idx < PDGEventInfos.Num(); Idx++)
-			{
-			ResetPDGEventInfo(PDGEventInfos[Idx]);
-			}
-			*/
+				for (int32 Idx = 0; Idx < PDGEventInfos.Num(); Idx++)
+				{
+				ResetPDGEventInfo(PDGEventInfos[Idx]);
+				}
+				*/
 
-			int32 PDGEventCount = 0;
-			int32 RemainingPDGEventCount = 0;
+				int32 PDGEventCount = 0;
+				int32 RemainingPDGEventCount = 0;
 
-			HAPI_Result Result = FHoudiniApi::GetPDGEvents(FHoudiniEngine::Get().GetSession(), 
-				CurrentContextID, PDGEventInfos.GetData(),  MaxNumberOfPDGEvents, &PDGEventCount, &RemainingPDGEventCount);
+				HAPI_Result Result = FHoudiniApi::GetPDGEvents(FHoudiniEngine::Get().GetSession(), 
+					CurrentContextID, PDGEventInfos.GetData(),  MaxNumberOfPDGEvents, &PDGEventCount, &RemainingPDGEventCount);
 
-			if (Result != HAPI_RESULT_SUCCESS)
-			{
-				HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events, error code: %d"), Result);
-				continue;
-			}
+				if (Result != HAPI_RESULT_SUCCESS)
+				{
+					HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events, error code: %d"), Result);
+					continue;
+				}
 
-			if (PDGEventCount < 1)
-				continue;
+				if (PDGEventCount < 1)
+					continue;
 			
-			for (int32 EventIdx = 0; EventIdx < PDGEventCount; EventIdx++)
-			{
-				ProcessPDGEvent(CurrentContextID, PDGEventInfos[EventIdx]);
-			}
+				for (int32 EventIdx = 0; EventIdx < PDGEventCount; EventIdx++)
+				{
+					ProcessPDGEvent(CurrentContextID, PDGEventInfos[EventIdx]);
+				}
 
-			HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d events, %d remaining."), PDGEventCount, RemainingPDGEventCount);
+				HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d events, %d remaining."), PDGEventCount, RemainingPDGEventCount);
+			}
 		}
 	}
 
@@ -1153,6 +1183,10 @@ FHoudiniPDGManager::GetTOPAssetLinkNetworkAndNode(
 		if (!IsValid(CurAssetLink))
 			continue;
 
+		// Node ids are only unique within a session
+		if (FHoudiniEngineRuntime::GetSessionIndexForObject(CurAssetLink) != FHoudiniEngineRuntime::GetCurrentSessionIndex())
+			continue;
+
 		if (CurAssetLink->GetTOPNodeAndNetworkByNodeId((int32)InNodeID, OutTOPNetwork, OutTOPNode))
 		{
 			if (OutTOPNetwork != nullptr && OutTOPNode != nullptr)
@@ -1683,6 +1717,8 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 		if (!AssetLink)
 			continue;
 
+		FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(AssetLink));
+
 		// Set up package parameters to:
 		// Cook to temp houdini engine directory
 		// and if the PDG asset link is associated with a Houdini Asset Component (HAC):
@@ -0,0 +1,158 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniScratchAllocator.h"
+
+#include "HoudiniCookStats.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+// Number of nested scopes on the thread, size of the memory stack when the outermost one was started,
+// and the peak memory used since then
+static thread_local int32 HoudiniScratchScopeDepth = 0;
+static thread_local int64 HoudiniScratchScopeStartBytes = 0;
+static thread_local int64 HoudiniScratchScopePeakBytes = 0;
+
+static std::atomic<int64> HoudiniScratchHighWaterMark(0);
+
+static thread_local FHoudiniCookScratchArena* HoudiniCurrentCookScratchArena = nullptr;
+
+// Size of the blocks the cook arena packs allocations in. Larger allocations get a block of their own.
+static constexpr SIZE_T HoudiniCookScratchBlockSize = 1024 * 1024;
+
+static void
+RecordScratchHighWaterMark(const int64& InBytesUsed)
+{
+	int64 HighWaterMark = HoudiniScratchHighWaterMark.load();
+	while (InBytesUsed > HighWaterMark && !HoudiniScratchHighWaterMark.compare_exchange_weak(HighWaterMark, InBytesUsed));
+}
+
+FHoudiniScratchScope::FHoudiniScratchScope()
+	: Mark(FMemStack::Get())
+{
+	if (HoudiniScratchScopeDepth++ > 0)
+		return;
+
+	HoudiniScratchScopeStartBytes = FMemStack::Get().GetByteCount();
+	HoudiniScratchScopePeakBytes = 0;
+}
+
+FHoudiniScratchScope::~FHoudiniScratchScope()
+{
+	// Memory is only released when a scope ends, so the peak is reached at the end of one of the scopes
+	HoudiniScratchScopePeakBytes = FMath::Max(HoudiniScratchScopePeakBytes, GetBytesUsed());
+
+	if (--HoudiniScratchScopeDepth > 0)
+		return;
+
+	const int64 BytesUsed = HoudiniScratchScopePeakBytes;
+	RecordScratchHighWaterMark(BytesUsed);
+	FHoudiniCookStats::RecordScratchMemoryUsed(BytesUsed);
+}
+
+bool
+FHoudiniScratchScope::IsActive()
+{
+	return HoudiniScratchScopeDepth > 0;
+}
+
+int64
+FHoudiniScratchScope::GetBytesUsed()
+{
+	if (HoudiniScratchScopeDepth <= 0)
+		return 0;
+
+	return FMath::Max<int64>(FMemStack::Get().GetByteCount() - HoudiniScratchScopeStartBytes, 0);
+}
+
+int64
+FHoudiniScratchScope::GetHighWaterMark()
+{
+	return HoudiniScratchHighWaterMark.load();
+}
+
+FHoudiniCookScratchArena::~FHoudiniCookScratchArena()
+{
+	RecordScratchHighWaterMark(BytesUsed);
+	FHoudiniCookStats::RecordScratchMemoryUsed(BytesUsed);
+
+	for (uint8* Block : Blocks)
+		FMemory::Free(Block);
+}
+
+void*
+FHoudiniCookScratchArena::Allocate(SIZE_T InSize, uint32 InAlignment)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	uint8* Result = Align(Cursor, InAlignment);
+	if (Cursor && Result + InSize <= End)
+	{
+		Cursor = Result + InSize;
+		return Result;
+	}
+
+	// Large allocations get a block of their own, so the free space left in the current block isn't wasted
+	const bool bOwnBlock = InSize + InAlignment > HoudiniCookScratchBlockSize;
+	const SIZE_T BlockSize = bOwnBlock ? InSize + InAlignment : HoudiniCookScratchBlockSize;
+	uint8* Block = (uint8*)FMemory::Malloc(BlockSize);
+	Blocks.Add(Block);
+	BytesUsed += BlockSize;
+
+	Result = Align(Block, InAlignment);
+	if (!bOwnBlock)
+	{
+		Cursor = Result + InSize;
+		End = Block + BlockSize;
+	}
+
+	return Result;
+}
+
+int64
+FHoudiniCookScratchArena::GetBytesUsed() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return BytesUsed;
+}
+
+FHoudiniCookScratchArena*
+FHoudiniCookScratchArena::GetCurrent()
+{
+	return HoudiniCurrentCookScratchArena;
+}
+
+FHoudiniCookScratchArenaScope::FHoudiniCookScratchArenaScope(FHoudiniCookScratchArena* InArena)
+	: PreviousArena(HoudiniCurrentCookScratchArena)
+{
+	HoudiniCurrentCookScratchArena = InArena;
+}
+
+FHoudiniCookScratchArenaScope::~FHoudiniCookScratchArenaScope()
+{
+	HoudiniCurrentCookScratchArena = PreviousArena;
+}
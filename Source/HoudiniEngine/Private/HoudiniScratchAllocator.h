@@ -0,0 +1,242 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/MemStack.h"
+
+// Array allocated on the calling thread's memory stack.
+// Must only be used for temporaries that don't outlive the enclosing FHoudiniScratchScope, and that are not
+// allocated from worker threads (the memory stack is per thread).
+template<typename ElementType>
+using THoudiniScratchArray = TArray<ElementType, TMemStackAllocator<>>;
+
+// Linear arena used for the output translators' temporaries.
+// Each scope marks the thread's memory stack, and releases everything allocated on it since then in one shot when it
+// ends. Nested scopes are used to release short lived temporaries (eg, per split) while the outer ones are active.
+// Arrays that can grow past their reserved size leave their previous block behind until the scope ends,
+// so only arrays with a known upper bound should be allocated on it.
+// When it ends, the outermost scope records the peak amount of memory used in the cook stats being recorded on the
+// thread, if any.
+class HOUDINIENGINE_API FHoudiniScratchScope
+{
+public:
+
+	FHoudiniScratchScope();
+	~FHoudiniScratchScope();
+
+	FHoudiniScratchScope(const FHoudiniScratchScope&) = delete;
+	FHoudiniScratchScope& operator=(const FHoudiniScratchScope&) = delete;
+
+	// Returns true if a scratch scope is active on the calling thread.
+	static bool IsActive();
+
+	// Returns the amount of scratch memory currently used on the calling thread, in bytes.
+	static int64 GetBytesUsed();
+
+	// Returns the highest amount of scratch memory used by a scope or a cook arena since the module was loaded, in bytes.
+	static int64 GetHighWaterMark();
+
+private:
+
+	FMemMark Mark;
+};
+
+// Linear arena for the temporaries of a whole cook's output processing that are shared between threads, eg the part
+// data fetched and prepared on worker threads, then used on the game thread to create the meshes.
+// Allocations are thread safe. Nothing is freed before the arena is destroyed, once PostCook is done: it then records
+// the memory it used in the cook stats being recorded on the thread, if any.
+class HOUDINIENGINE_API FHoudiniCookScratchArena
+{
+public:
+
+	FHoudiniCookScratchArena() = default;
+	~FHoudiniCookScratchArena();
+
+	FHoudiniCookScratchArena(const FHoudiniCookScratchArena&) = delete;
+	FHoudiniCookScratchArena& operator=(const FHoudiniCookScratchArena&) = delete;
+
+	void* Allocate(SIZE_T InSize, uint32 InAlignment);
+
+	// Returns the amount of memory held by the arena, in bytes.
+	int64 GetBytesUsed() const;
+
+	// Returns the arena the containers created on the calling thread allocate from, if any.
+	static FHoudiniCookScratchArena* GetCurrent();
+
+private:
+
+	mutable FCriticalSection Lock;
+
+	TArray<uint8*> Blocks;
+
+	// Free space left in the last block allocations are packed in
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+
+	int64 BytesUsed = 0;
+};
+
+// Sets the arena that the containers created on the calling thread allocate from, for the lifetime of the scope.
+// Worker tasks open one with the arena of the cook that started them, so the data they return to the game thread is
+// allocated in it.
+class HOUDINIENGINE_API FHoudiniCookScratchArenaScope
+{
+public:
+
+	FHoudiniCookScratchArenaScope(FHoudiniCookScratchArena* InArena);
+	~FHoudiniCookScratchArenaScope();
+
+private:
+
+	FHoudiniCookScratchArena* PreviousArena;
+};
+
+// Container allocator using the cook arena that is current when the container is created, or the heap if there is
+// none. Containers can be moved and used across threads, but must not outlive the arena they were created in.
+// Memory is only reclaimed with the arena, so blocks left behind by containers that grow stay allocated until then.
+class FHoudiniCookScratchAllocator
+{
+public:
+
+	using SizeType = int32;
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType()
+			: Data(nullptr)
+			, Arena(FHoudiniCookScratchArena::GetCurrent())
+		{
+		}
+
+		~ForElementType()
+		{
+			if (!Arena && Data)
+				FMemory::Free(Data);
+		}
+
+		void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+
+			if (!Arena && Data)
+				FMemory::Free(Data);
+
+			Data = Other.Data;
+			Arena = Other.Arena;
+			Other.Data = nullptr;
+		}
+
+		ElementType* GetAllocation() const
+		{
+			return Data;
+		}
+
+		void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, SIZE_T NumBytesPerElement)
+		{
+			if (!Arena)
+			{
+				if (Data || NumElements)
+					Data = (ElementType*)FMemory::Realloc(Data, NumElements * NumBytesPerElement);
+				return;
+			}
+
+			ElementType* OldData = Data;
+			Data = NumElements > 0
+				? (ElementType*)Arena->Allocate(NumElements * NumBytesPerElement, FMath::Max<uint32>(alignof(ElementType), DEFAULT_ALIGNMENT))
+				: nullptr;
+
+			if (Data && OldData && PreviousNumElements > 0)
+				FMemory::Memcpy(Data, OldData, FMath::Min(NumElements, PreviousNumElements) * NumBytesPerElement);
+		}
+
+		SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, !Arena);
+		}
+
+		SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, !Arena);
+		}
+
+		SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, !Arena);
+		}
+
+		SIZE_T GetAllocatedSize(SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+
+		bool HasAllocation() const
+		{
+			return !!Data;
+		}
+
+		SizeType GetInitialCapacity() const
+		{
+			return 0;
+		}
+
+	private:
+
+		ForElementType(const ForElementType&) = delete;
+		ForElementType& operator=(const ForElementType&) = delete;
+
+		ElementType* Data;
+		FHoudiniCookScratchArena* Arena;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template <>
+struct TAllocatorTraits<FHoudiniCookScratchAllocator> : TAllocatorTraitsBase<FHoudiniCookScratchAllocator>
+{
+	enum { SupportsMove = true };
+};
+
+using FHoudiniCookScratchSetAllocator = TSetAllocator<
+	TSparseArrayAllocator<FHoudiniCookScratchAllocator, FHoudiniCookScratchAllocator>,
+	FHoudiniCookScratchAllocator>;
+
+// Array and map allocated in the current cook arena, see FHoudiniCookScratchAllocator.
+template<typename ElementType>
+using THoudiniCookScratchArray = TArray<ElementType, FHoudiniCookScratchAllocator>;
+
+template<typename KeyType, typename ValueType>
+using THoudiniCookScratchMap = TMap<KeyType, ValueType, FHoudiniCookScratchSetAllocator>;
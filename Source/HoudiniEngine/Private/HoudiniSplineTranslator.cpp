@@ -65,8 +65,9 @@ FHoudiniSplineTranslator::ExtractStringPositions(const FString& Positions, TArra
 	}
 }
 
-void
-FHoudiniSplineTranslator::ConvertPositionToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
+// Sizes OutVectorData to the number of curves, and returns true if InRawData has a tuple for each of their points
+static bool
+HasCurvePointData(const TArray<float>& InRawData, const TArray<int32>& CurveCounts, const int32& InTupleSize, TArray<TArray<FVector>>& OutVectorData)
 {
 	OutVectorData.SetNum(CurveCounts.Num());
 
@@ -74,136 +75,72 @@ FHoudiniSplineTranslator::ConvertPositionToVectorData(const TArray<float>& InRaw
 	for (const int32& NextCount : CurveCounts)
 		TotalNumPoints += NextCount;
 
-	// Do not fill the output array, if the total number of points does not match
-	if (InRawData.Num() < TotalNumPoints * 3)
-		return;
+	return InRawData.Num() >= TotalNumPoints * InTupleSize;
+}
 
+// Splits the converted vectors of all the points in one array per curve
+static void
+SplitCurvePointData(const TArray<FVector>& InVectorData, const TArray<int32>& CurveCounts, TArray<TArray<FVector>>& OutVectorData)
+{
 	int32 Itr = 0;
 	for (int32 n = 0; n < CurveCounts.Num(); ++n)
 	{
-		TArray<FVector>& NextVectorDataArray = OutVectorData[n];
-		NextVectorDataArray.SetNumZeroed(CurveCounts[n]);
-
-		for (int32 PtIdx = 0; PtIdx < CurveCounts[n]; ++PtIdx)
-		{
-			if (Itr + 2 >= InRawData.Num())
-				return;
-
-			// Swap Y/Z convert meters to centimeters
-			NextVectorDataArray[PtIdx].X = (double)(InRawData[Itr] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
-			NextVectorDataArray[PtIdx].Y = (double)(InRawData[Itr + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
-			NextVectorDataArray[PtIdx].Z = (double)(InRawData[Itr + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
-
-			Itr += 3;
-		}
+		OutVectorData[n].SetNumUninitialized(CurveCounts[n]);
+		FMemory::Memcpy(OutVectorData[n].GetData(), InVectorData.GetData() + Itr, CurveCounts[n] * sizeof(FVector));
+		Itr += CurveCounts[n];
 	}
 }
 
 void
-FHoudiniSplineTranslator::ConvertScaleToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
+FHoudiniSplineTranslator::ConvertPositionToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
 {
-	OutVectorData.SetNum(CurveCounts.Num());
-
-	int32 TotalNumPoints = 0;
-	for (const int32& NextCount : CurveCounts)
-		TotalNumPoints += NextCount;
-
 	// Do not fill the output array, if the total number of points does not match
-	if (InRawData.Num() < TotalNumPoints * 3)
+	if (!HasCurvePointData(InRawData, CurveCounts, 3, OutVectorData))
 		return;
 
-	int32 Itr = 0;
-	for (int32 n = 0; n < CurveCounts.Num(); ++n)
-	{
-		TArray<FVector>& NextVectorDataArray = OutVectorData[n];
-		NextVectorDataArray.SetNumZeroed(CurveCounts[n]);
-
-		for (int32 PtIdx = 0; PtIdx < CurveCounts[n]; ++PtIdx)
-		{
-			if (Itr + 2 >= InRawData.Num())
-				return;
+	// Swap Y/Z convert meters to centimeters
+	TArray<FVector> VectorData;
+	FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector(InRawData, VectorData);
+	SplitCurvePointData(VectorData, CurveCounts, OutVectorData);
+}
 
-			// Just Swap Y/Z
-			NextVectorDataArray[PtIdx].X = (double)InRawData[Itr];
-			NextVectorDataArray[PtIdx].Y = (double)InRawData[Itr + 2];
-			NextVectorDataArray[PtIdx].Z = (double)InRawData[Itr + 1];
+void
+FHoudiniSplineTranslator::ConvertScaleToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
+{
+	// Do not fill the output array, if the total number of points does not match
+	if (!HasCurvePointData(InRawData, CurveCounts, 3, OutVectorData))
+		return;
 
-			Itr += 3;
-		}
-	}
+	// Just Swap Y/Z
+	TArray<FVector> VectorData;
+	FHoudiniEngineUtils::ConvertHoudiniScaleToUnrealVector(InRawData, VectorData);
+	SplitCurvePointData(VectorData, CurveCounts, OutVectorData);
 }
 
 void
 FHoudiniSplineTranslator::ConvertEulerRotationToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
 {
-	OutVectorData.SetNum(CurveCounts.Num());
-
-	int32 TotalNumPoints = 0;
-	for (const int32& NextCount : CurveCounts)
-		TotalNumPoints += NextCount;
-
 	// Do not fill the output array, if the total number of points does not match
-	if (InRawData.Num() < TotalNumPoints * 3)
+	if (!HasCurvePointData(InRawData, CurveCounts, 3, OutVectorData))
 		return;
 
-	int32 Itr = 0;
-	for (int32 n = 0; n < CurveCounts.Num(); ++n)
-	{
-		TArray<FVector>& NextVectorDataArray = OutVectorData[n];
-		NextVectorDataArray.SetNumZeroed(CurveCounts[n]);
-
-		for (int32 PtIdx = 0; PtIdx < CurveCounts[n]; ++PtIdx)
-		{
-			if (Itr + 2 >= InRawData.Num())
-				return;
-
-			// Just Swap Y/Z
-			NextVectorDataArray[PtIdx].X = (double)InRawData[Itr];
-			NextVectorDataArray[PtIdx].Y = (double)InRawData[Itr + 2];
-			NextVectorDataArray[PtIdx].Z = (double)InRawData[Itr + 1];
-
-			Itr += 3;
-		}
-	}
+	// Just Swap Y/Z
+	TArray<FVector> VectorData;
+	FHoudiniEngineUtils::ConvertHoudiniRotEulerToUnrealVector(InRawData, VectorData);
+	SplitCurvePointData(VectorData, CurveCounts, OutVectorData);
 }
 
 void
 FHoudiniSplineTranslator::ConvertQuaternionRotationToVectorData(const TArray<float>& InRawData, TArray<TArray<FVector>>& OutVectorData, const TArray<int32>& CurveCounts)
 {
-	OutVectorData.SetNum(CurveCounts.Num());
-
-	int32 TotalNumPoints = 0;
-	for (const int32& NextCount : CurveCounts)
-		TotalNumPoints += NextCount;
-
 	// Do not fill the output array, if the total number of points does not match
-	if (InRawData.Num() < TotalNumPoints * 4)
+	if (!HasCurvePointData(InRawData, CurveCounts, 4, OutVectorData))
 		return;
 
-	int32 Itr = 0;
-	for (int32 n = 0; n < CurveCounts.Num(); ++n)
-	{
-		TArray<FVector>& NextVectorDataArray = OutVectorData[n];
-		NextVectorDataArray.SetNumZeroed(CurveCounts[n]);
-
-		for (int32 PtIdx = 0; PtIdx < CurveCounts[n]; ++PtIdx)
-		{
-			if (Itr + 3 >= InRawData.Num())
-				return;
-
-			// Extract a quaternion: Swap Y/Z, invert W
-			FQuat ObjectRotation(
-				(double)InRawData[Itr + 0],
-				(double)InRawData[Itr + 2],
-				(double)InRawData[Itr + 1],
-				(double)-InRawData[Itr + 3]);
-
-			// Get Euler angles
-			NextVectorDataArray[PtIdx] = ObjectRotation.Euler();
-
-			Itr += 4;
-		}
-	}
+	// Extract the quaternions (Swap Y/Z, invert W) and get their Euler angles
+	TArray<FVector> VectorData;
+	FHoudiniEngineUtils::ConvertHoudiniRotQuatToUnrealVector(InRawData, VectorData);
+	SplitCurvePointData(VectorData, CurveCounts, OutVectorData);
 }
 
 void
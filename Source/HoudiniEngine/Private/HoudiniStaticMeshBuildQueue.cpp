@@ -0,0 +1,358 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniStaticMeshBuildQueue.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HoudiniStaticMeshComponent.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "EditorSupportDelegates.h"
+#include "StaticMeshCompiler.h"
+#include "StaticMeshResources.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+FHoudiniStaticMeshBuildQueue&
+FHoudiniStaticMeshBuildQueue::Get()
+{
+	static FHoudiniStaticMeshBuildQueue Instance;
+	return Instance;
+}
+
+bool
+FHoudiniStaticMeshBuildQueue::Build(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return false;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildQueue::Build);
+
+	TWeakObjectPtr<UStaticMesh> ReplacedStaticMesh;
+	PendingReplacements.RemoveAndCopyValue(InStaticMesh, ReplacedStaticMesh);
+
+	// Not passing an error array to Build() lets the engine compile the mesh asynchronously if it is allowed to.
+	// bSilent doesnt add the Build Errors anyway.
+	InStaticMesh->Build(true);
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bAsyncBuild = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bAsyncStaticMeshBuild : true;
+	if (InStaticMesh->IsCompiling() && !bAsyncBuild)
+	{
+		// Async builds are disabled in the plugin settings, wait for the mesh now
+		FStaticMeshCompilingManager::Get().FinishCompilation({ InStaticMesh });
+	}
+
+	if (!InStaticMesh->IsCompiling())
+	{
+		// The build was synchronous, complete it now
+		SwapReplacement(InStaticMesh, ReplacedStaticMesh.Get());
+		PostBuild(InStaticMesh, true);
+		return false;
+	}
+
+	// The package can be dirtied right away, the rest waits for the end of the build
+	UPackage* MeshPackage = InStaticMesh->GetOutermost();
+	if (IsValid(MeshPackage))
+	{
+		MeshPackage->MarkPackageDirty();
+	}
+
+	FPendingBuild* PendingBuild = PendingBuilds.FindByPredicate(
+		[InStaticMesh](const FPendingBuild& Entry) { return Entry.StaticMesh.Get() == InStaticMesh; });
+	if (!PendingBuild)
+	{
+		PendingBuild = &PendingBuilds.AddDefaulted_GetRef();
+		PendingBuild->StaticMesh = InStaticMesh;
+	}
+	PendingBuild->StartTime = FPlatformTime::Seconds();
+	if (ReplacedStaticMesh.IsValid())
+		PendingBuild->ReplacedStaticMesh = ReplacedStaticMesh;
+
+	return true;
+}
+
+bool
+FHoudiniStaticMeshBuildQueue::IsBuilding(const UStaticMesh* InStaticMesh) const
+{
+	if (!IsValid(InStaticMesh))
+		return false;
+
+	return PendingBuilds.ContainsByPredicate(
+		[InStaticMesh](const FPendingBuild& Entry) { return Entry.StaticMesh.Get() == InStaticMesh; });
+}
+
+UStaticMesh*
+FHoudiniStaticMeshBuildQueue::CreateReplacement(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return nullptr;
+
+	// A replacement that hasn't been swapped in yet isn't displayed, rebuild it again
+	const bool bIsPendingReplacement = PendingReplacements.Contains(InStaticMesh) || PendingBuilds.ContainsByPredicate(
+		[InStaticMesh](const FPendingBuild& Entry) { return Entry.StaticMesh.Get() == InStaticMesh && Entry.ReplacedStaticMesh.IsValid(); });
+	if (bIsPendingReplacement)
+		return InStaticMesh;
+
+	// Synchronous builds complete before anything is displayed
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings && !HoudiniRuntimeSettings->bAsyncStaticMeshBuild)
+		return nullptr;
+
+	// Without render data, there is nothing to keep displaying
+	if (!InStaticMesh->GetRenderData() || !InStaticMesh->GetRenderData()->IsInitialized())
+		return nullptr;
+
+	// The replacement is transient until it is swapped in, so saving its package in the meantime saves the replaced mesh
+	UObject* Outer = InStaticMesh->GetOuter();
+	UStaticMesh* Replacement = NewObject<UStaticMesh>(
+		Outer, MakeUniqueObjectName(Outer, UStaticMesh::StaticClass(), InStaticMesh->GetFName()), RF_Transient);
+	if (!IsValid(Replacement))
+		return nullptr;
+
+	PendingReplacements.Add(Replacement, InStaticMesh);
+
+	return Replacement;
+}
+
+void
+FHoudiniStaticMeshBuildQueue::KeepDisplayingReplacedMesh(UStaticMeshComponent* InComponent) const
+{
+	if (!IsValid(InComponent))
+		return;
+
+	UStaticMesh* StaticMesh = InComponent->GetStaticMesh();
+	const FPendingBuild* PendingBuild = PendingBuilds.FindByPredicate(
+		[StaticMesh](const FPendingBuild& Entry) { return Entry.StaticMesh.Get() == StaticMesh; });
+	if (!PendingBuild)
+		return;
+
+	// SwapReplacement() assigns the replacement back once it has compiled
+	UStaticMesh* ReplacedStaticMesh = PendingBuild->ReplacedStaticMesh.Get();
+	if (IsValid(ReplacedStaticMesh))
+		InComponent->SetStaticMesh(ReplacedStaticMesh);
+}
+
+bool
+FHoudiniStaticMeshBuildQueue::AddFence(UStaticMesh* InStaticMesh, UStaticMeshComponent* InComponent, UHoudiniStaticMeshComponent* InProxyComponent)
+{
+	if (!IsValid(InStaticMesh) || !IsValid(InComponent))
+		return false;
+
+	FPendingBuild* PendingBuild = PendingBuilds.FindByPredicate(
+		[InStaticMesh](const FPendingBuild& Entry) { return Entry.StaticMesh.Get() == InStaticMesh; });
+	if (!PendingBuild)
+		return false;
+
+	FFence* Fence = PendingBuild->Fences.FindByPredicate(
+		[InComponent](const FFence& Entry) { return Entry.Component.Get() == InComponent; });
+	if (!Fence)
+	{
+		Fence = &PendingBuild->Fences.AddDefaulted_GetRef();
+		Fence->Component = InComponent;
+		Fence->bComponentVisible = InComponent->GetVisibleFlag();
+	}
+	Fence->ProxyComponent = InProxyComponent;
+
+	// Keep displaying the proxy until the static mesh is ready
+	InComponent->SetVisibility(false);
+	if (IsValid(InProxyComponent))
+	{
+		InProxyComponent->SetVisibility(true);
+		InProxyComponent->SetHoudiniIconVisible(false);
+	}
+
+	return true;
+}
+
+void
+FHoudiniStaticMeshBuildQueue::RemoveFences(const UHoudiniStaticMeshComponent* InProxyComponent)
+{
+	if (!InProxyComponent)
+		return;
+
+	for (FPendingBuild& PendingBuild : PendingBuilds)
+	{
+		PendingBuild.Fences.RemoveAll(
+			[InProxyComponent](const FFence& Entry) { return Entry.ProxyComponent.Get() == InProxyComponent; });
+	}
+}
+
+void
+FHoudiniStaticMeshBuildQueue::Tick()
+{
+	// Forget the replacements that were discarded before being built
+	for (auto It = PendingReplacements.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (PendingBuilds.Num() <= 0)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildQueue::Tick);
+
+	bool bCompletedAny = false;
+	for (int32 Index = PendingBuilds.Num() - 1; Index >= 0; Index--)
+	{
+		UStaticMesh* StaticMesh = PendingBuilds[Index].StaticMesh.Get();
+		if (IsValid(StaticMesh) && StaticMesh->IsCompiling())
+			continue;
+
+		CompleteBuild(PendingBuilds[Index]);
+		PendingBuilds.RemoveAtSwap(Index);
+		bCompletedAny = true;
+	}
+
+	if (bCompletedAny)
+		FEditorSupportDelegates::RedrawAllViewports.Broadcast();
+}
+
+void
+FHoudiniStaticMeshBuildQueue::FinishAll()
+{
+	if (PendingBuilds.Num() <= 0)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshBuildQueue::FinishAll);
+
+	TArray<UStaticMesh*> StaticMeshes;
+	for (const FPendingBuild& PendingBuild : PendingBuilds)
+	{
+		UStaticMesh* StaticMesh = PendingBuild.StaticMesh.Get();
+		if (IsValid(StaticMesh) && StaticMesh->IsCompiling())
+			StaticMeshes.Add(StaticMesh);
+	}
+
+	if (StaticMeshes.Num() > 0)
+		FStaticMeshCompilingManager::Get().FinishCompilation(StaticMeshes);
+
+	Tick();
+}
+
+void
+FHoudiniStaticMeshBuildQueue::PostBuild(UStaticMesh* InStaticMesh, bool bInRecreatePhysicsState)
+{
+	if (!IsValid(InStaticMesh))
+		return;
+
+	// This replaces the call to RefreshCollision, but without CreateNavCollision
+	// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
+	// and can be expensive depending on the vert/poly count of the mesh.
+	// Meshes that were compiled asynchronously already had their components' physics state
+	// recreated by the static mesh compiling manager.
+	if (bInRecreatePhysicsState)
+	{
+		for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
+		{
+			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
+			if (StaticMeshComponent->GetStaticMesh() == InStaticMesh)
+			{
+				// it needs to recreate IF it already has been created
+				if (StaticMeshComponent->IsPhysicsStateCreated())
+				{
+					StaticMeshComponent->RecreatePhysicsState();
+				}
+			}
+		}
+
+		FEditorSupportDelegates::RedrawAllViewports.Broadcast();
+	}
+
+	InStaticMesh->GetOnMeshChanged().Broadcast();
+
+	UPackage* MeshPackage = InStaticMesh->GetOutermost();
+	if (IsValid(MeshPackage))
+	{
+		MeshPackage->MarkPackageDirty();
+	}
+}
+
+void
+FHoudiniStaticMeshBuildQueue::CompleteBuild(FPendingBuild& InPendingBuild)
+{
+	UStaticMesh* StaticMesh = InPendingBuild.StaticMesh.Get();
+	if (IsValid(StaticMesh))
+	{
+		SwapReplacement(StaticMesh, InPendingBuild.ReplacedStaticMesh.Get());
+		PostBuild(StaticMesh, false);
+		HOUDINI_LOG_MESSAGE(TEXT("Static mesh %s built asynchronously in %f seconds."),
+			*StaticMesh->GetName(), FPlatformTime::Seconds() - InPendingBuild.StartTime);
+	}
+
+	// Swap the proxies for the static mesh components that were waiting for this mesh
+	for (const FFence& Fence : InPendingBuild.Fences)
+	{
+		UStaticMeshComponent* Component = Fence.Component.Get();
+		if (!IsValid(Component))
+			continue;
+
+		// The component might have been assigned another mesh since
+		if (Component->GetStaticMesh() != StaticMesh)
+			continue;
+
+		Component->SetVisibility(Fence.bComponentVisible);
+
+		UHoudiniStaticMeshComponent* ProxyComponent = Fence.ProxyComponent.Get();
+		if (IsValid(ProxyComponent))
+		{
+			ProxyComponent->SetVisibility(false);
+			ProxyComponent->SetHiddenInGame(true);
+			ProxyComponent->SetHoudiniIconVisible(false);
+		}
+	}
+}
+
+void
+FHoudiniStaticMeshBuildQueue::SwapReplacement(UStaticMesh* InReplacement, UStaticMesh* InReplacedStaticMesh)
+{
+	if (!IsValid(InReplacement) || !IsValid(InReplacedStaticMesh))
+		return;
+
+	// Take over the replaced mesh's name and flags, so the package saves the replacement as the same asset
+	const FString ReplacedName = InReplacedStaticMesh->GetName();
+	UObject* ReplacedOuter = InReplacedStaticMesh->GetOuter();
+	const EObjectFlags ReplacedFlags = InReplacedStaticMesh->GetMaskedFlags(RF_Public | RF_Standalone | RF_Transactional);
+	const ERenameFlags RenameFlags = REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty;
+
+	InReplacedStaticMesh->ClearFlags(RF_Public | RF_Standalone);
+	InReplacedStaticMesh->Rename(nullptr, GetTransientPackage(), RenameFlags);
+	InReplacement->Rename(*ReplacedName, ReplacedOuter, RenameFlags);
+	InReplacement->ClearFlags(RF_Transient);
+	InReplacement->SetFlags(ReplacedFlags);
+
+	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
+		if (IsValid(StaticMeshComponent) && StaticMeshComponent->GetStaticMesh() == InReplacedStaticMesh)
+			StaticMeshComponent->SetStaticMesh(InReplacement);
+	}
+
+	InReplacedStaticMesh->MarkAsGarbage();
+}
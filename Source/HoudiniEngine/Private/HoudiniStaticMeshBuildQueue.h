@@ -0,0 +1,113 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UStaticMesh;
+class UStaticMeshComponent;
+class UHoudiniStaticMeshComponent;
+
+// Builds the static meshes created by the mesh translator.
+// When the editor allows it, the static meshes are compiled asynchronously by the engine (render data, Nanite,
+// distance fields and collision) instead of blocking the game thread after each cook. The queue keeps track of the
+// meshes that are still compiling, and of the components waiting for them (fences): until a mesh is ready, the
+// proxy component it replaces stays visible and its static mesh component is hidden.
+// A static mesh rebuilt in place loses its previous render data as soon as its compilation starts. To keep displaying
+// a mesh while its new version compiles, the new version is built into a replacement mesh (see CreateReplacement()),
+// which takes over the replaced mesh's name and components once it is ready.
+class HOUDINIENGINE_API FHoudiniStaticMeshBuildQueue
+{
+public:
+
+	static FHoudiniStaticMeshBuildQueue& Get();
+
+	// Builds the static mesh. Returns true if the mesh is being compiled asynchronously, in which case the post
+	// build steps (OnMeshChanged, viewport redraw) are run by Tick() once the mesh is ready.
+	bool Build(UStaticMesh* InStaticMesh);
+
+	// Returns true if the static mesh is still being built asynchronously.
+	bool IsBuilding(const UStaticMesh* InStaticMesh) const;
+
+	// Returns the mesh to build the new version of InStaticMesh into, or null if InStaticMesh can be rebuilt in place.
+	// A mesh that is displayed gets a new transient replacement in its package, a replacement that is still pending
+	// is returned as is.
+	UStaticMesh* CreateReplacement(UStaticMesh* InStaticMesh);
+
+	// If the component's mesh is a replacement that is still compiling, the component keeps displaying the
+	// replaced mesh until the replacement is ready.
+	void KeepDisplayingReplacedMesh(UStaticMeshComponent* InComponent) const;
+
+	// Hides InComponent and keeps InProxyComponent visible until InStaticMesh is built,
+	// then swaps their visibility. Returns false if the mesh was not being built.
+	bool AddFence(UStaticMesh* InStaticMesh, UStaticMeshComponent* InComponent, UHoudiniStaticMeshComponent* InProxyComponent);
+
+	// Removes the fences using this proxy component (the proxy is current again and must stay visible).
+	void RemoveFences(const UHoudiniStaticMeshComponent* InProxyComponent);
+
+	// Completes the builds that are finished. Called on every tick by the Houdini Engine manager.
+	void Tick();
+
+	// Waits for all the pending builds and completes them.
+	void FinishAll();
+
+	int32 GetNumPendingBuilds() const { return PendingBuilds.Num(); }
+
+private:
+
+	struct FFence
+	{
+		TWeakObjectPtr<UStaticMeshComponent> Component;
+		TWeakObjectPtr<UHoudiniStaticMeshComponent> ProxyComponent;
+		// Visibility of the static mesh component before it was hidden by the fence
+		bool bComponentVisible = true;
+	};
+
+	struct FPendingBuild
+	{
+		TWeakObjectPtr<UStaticMesh> StaticMesh;
+		TArray<FFence> Fences;
+		double StartTime = 0.0;
+		// The mesh this build replaces once it is ready
+		TWeakObjectPtr<UStaticMesh> ReplacedStaticMesh;
+	};
+
+	// Runs the post build steps on a static mesh that is ready.
+	static void PostBuild(UStaticMesh* InStaticMesh, bool bInRecreatePhysicsState);
+
+	// Runs the post build steps and releases the fences of a pending build.
+	static void CompleteBuild(FPendingBuild& InPendingBuild);
+
+	// Gives the replacement the replaced mesh's name and components, and discards the replaced mesh.
+	static void SwapReplacement(UStaticMesh* InReplacement, UStaticMesh* InReplacedStaticMesh);
+
+	TArray<FPendingBuild> PendingBuilds;
+
+	// Replacements that have been created but not built yet, and the meshes they replace
+	TMap<TWeakObjectPtr<UStaticMesh>, TWeakObjectPtr<UStaticMesh>> PendingReplacements;
+};
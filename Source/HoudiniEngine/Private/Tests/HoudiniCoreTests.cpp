@@ -1,5 +1,33 @@
-﻿#include "../HoudiniEngine.h"
+﻿#include "../GeometryToolsEngine.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineAssetLibraryCache.h"
+#include "../HoudiniEngineAttributeCatalog.h"
+#include "../HoudiniEngineCommandlet.h"
+#include "../HoudiniEngineCookWait.h"
+#include "../HoudiniEnginePrivatePCH.h"
+#include "../HoudiniEngineScheduler.h"
+#include "../HoudiniEngineSessionPool.h"
+#include "../HoudiniEngineString.h"
+#include "../HoudiniEngineTaskQueue.h"
+#include "../HoudiniEngineUtils.h"
+#include "../HoudiniEngineVectorConversion.h"
+#include "../HoudiniMeshTranslator.h"
+#include "../HoudiniScratchAllocator.h"
+#include "HoudiniApi.h"
+#include "HoudiniAsset.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniRuntimeSettings.h"
+#include "UnrealObjectInputRuntimeTypes.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "MeshDescription.h"
 #include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+#include "StaticMeshAttributes.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +38,1294 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
-#endif
\ No newline at end of file
+// Returns the given percentile of a sorted array of samples
+static double
+HoudiniCoreTests_Percentile(const TArray<double>& InSortedSamples, const double& InPercentile)
+{
+	if (InSortedSamples.Num() <= 0)
+		return 0.0;
+
+	int32 Index = FMath::Clamp(FMath::CeilToInt(InPercentile * InSortedSamples.Num()) - 1, 0, InSortedSamples.Num() - 1);
+	return InSortedSamples[Index];
+}
+
+// HAPI calls stubbed by the cook wait latency benchmark. Only the benchmark's scheduler thread gets the stubbed
+// answers, calls from any other thread are forwarded to the functions that were loaded.
+struct FHoudiniCoreTestsCookStubs
+{
+	static bool IsStubThread()
+	{
+		return FPlatformTLS::GetCurrentThreadId() == static_cast<uint32>(FPlatformAtomics::AtomicRead(&StubThreadId));
+	}
+
+	static HAPI_Result IsInitialized(const HAPI_Session* InSession)
+	{
+		return IsStubThread() ? HAPI_RESULT_SUCCESS : LoadedIsInitialized(InSession);
+	}
+
+	static HAPI_Result IsSessionValid(const HAPI_Session* InSession)
+	{
+		return IsStubThread() ? HAPI_RESULT_SUCCESS : LoadedIsSessionValid(InSession);
+	}
+
+	// Starts a cook that lasts the current cook duration
+	static HAPI_Result CookNode(const HAPI_Session* InSession, HAPI_NodeId InNodeId, const HAPI_CookOptions* InCookOptions)
+	{
+		if (!IsStubThread())
+			return LoadedCookNode(InSession, InNodeId, InCookOptions);
+
+		FPlatformAtomics::AtomicStore(&CookEndCycles, static_cast<int64>(FPlatformTime::Cycles64()) + FPlatformAtomics::AtomicRead(&CookDurationCycles));
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result GetStatus(const HAPI_Session* InSession, HAPI_StatusType InStatusType, int* OutStatus)
+	{
+		if (!IsStubThread())
+			return LoadedGetStatus(InSession, InStatusType, OutStatus);
+
+		const bool bCookDone = static_cast<int64>(FPlatformTime::Cycles64()) >= FPlatformAtomics::AtomicRead(&CookEndCycles);
+		*OutStatus = bCookDone ? HAPI_STATE_READY : HAPI_STATE_COOKING;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static void Install(const uint32& InThreadId)
+	{
+		LoadedIsInitialized = FHoudiniApi::IsInitialized;
+		LoadedIsSessionValid = FHoudiniApi::IsSessionValid;
+		LoadedCookNode = FHoudiniApi::CookNode;
+		LoadedGetStatus = FHoudiniApi::GetStatus;
+		FPlatformAtomics::AtomicStore(&StubThreadId, static_cast<int32>(InThreadId));
+
+		FHoudiniApi::IsInitialized = &IsInitialized;
+		FHoudiniApi::IsSessionValid = &IsSessionValid;
+		FHoudiniApi::CookNode = &CookNode;
+		FHoudiniApi::GetStatus = &GetStatus;
+	}
+
+	static void Uninstall()
+	{
+		FHoudiniApi::IsInitialized = LoadedIsInitialized;
+		FHoudiniApi::IsSessionValid = LoadedIsSessionValid;
+		FHoudiniApi::CookNode = LoadedCookNode;
+		FHoudiniApi::GetStatus = LoadedGetStatus;
+		FPlatformAtomics::AtomicStore(&StubThreadId, 0);
+	}
+
+	// Written by the game thread, read by the scheduler thread
+	static volatile int32 StubThreadId;
+	static volatile int64 CookDurationCycles;
+	static volatile int64 CookEndCycles;
+
+	static FHoudiniApi::IsInitializedFuncPtr LoadedIsInitialized;
+	static FHoudiniApi::IsSessionValidFuncPtr LoadedIsSessionValid;
+	static FHoudiniApi::CookNodeFuncPtr LoadedCookNode;
+	static FHoudiniApi::GetStatusFuncPtr LoadedGetStatus;
+};
+
+volatile int32 FHoudiniCoreTestsCookStubs::StubThreadId = 0;
+volatile int64 FHoudiniCoreTestsCookStubs::CookDurationCycles = 0;
+volatile int64 FHoudiniCoreTestsCookStubs::CookEndCycles = 0;
+FHoudiniApi::IsInitializedFuncPtr FHoudiniCoreTestsCookStubs::LoadedIsInitialized = nullptr;
+FHoudiniApi::IsSessionValidFuncPtr FHoudiniCoreTestsCookStubs::LoadedIsSessionValid = nullptr;
+FHoudiniApi::CookNodeFuncPtr FHoudiniCoreTestsCookStubs::LoadedCookNode = nullptr;
+FHoudiniApi::GetStatusFuncPtr FHoudiniCoreTestsCookStubs::LoadedGetStatus = nullptr;
+
+// Runs cook tasks of random durations through a scheduler whose HAPI calls are stubbed, and measures the time between
+// the end of each cook and the moment its task info is posted.
+static void
+HoudiniCoreTests_MeasureCookWaitLatency(const int32& InNumCooks, TArray<double>& OutLatencies)
+{
+	FRandomStream RandomStream(1234);
+
+	FHoudiniEngineScheduler Scheduler;
+	FRunnableThread* SchedulerThread = FRunnableThread::Create(&Scheduler, TEXT("HoudiniCookWaitLatencyTest"), 0, TPri_Normal);
+	FHoudiniCoreTestsCookStubs::Install(SchedulerThread->GetThreadID());
+
+	OutLatencies.Empty(InNumCooks);
+	for (int32 CookIdx = 0; CookIdx < InNumCooks; CookIdx++)
+	{
+		// Small cooks, between 0 and 30ms
+		const double CookDuration = RandomStream.FRandRange(0.0f, 0.03f);
+		FPlatformAtomics::AtomicStore(&FHoudiniCoreTestsCookStubs::CookDurationCycles, static_cast<int64>(CookDuration / FPlatformTime::GetSecondsPerCycle64()));
+		FPlatformAtomics::AtomicStore(&FHoudiniCoreTestsCookStubs::CookEndCycles, TNumericLimits<int64>::Max());
+
+		FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+		Task.ActorName = TEXT("CookWaitLatency");
+		Task.AssetId = 0;
+		Scheduler.AddTask(Task);
+
+		// Poll the posted task info until the cook is reported as finished
+		const double TimeOut = FPlatformTime::Seconds() + 5.0;
+		FHoudiniEngineTaskInfo TaskInfo;
+		while (FPlatformTime::Seconds() < TimeOut)
+		{
+			if (FHoudiniEngine::Get().RetrieveTaskInfo(Task.HapiGUID, TaskInfo) && TaskInfo.TaskState != EHoudiniEngineTaskState::Working)
+				break;
+
+			FPlatformProcess::YieldThread();
+		}
+
+		const int64 PostedCycles = static_cast<int64>(FPlatformTime::Cycles64());
+		FHoudiniEngine::Get().RemoveTaskInfo(Task.HapiGUID);
+
+		const int64 CookEndCycles = FPlatformAtomics::AtomicRead(&FHoudiniCoreTestsCookStubs::CookEndCycles);
+		OutLatencies.Add(FMath::Max(PostedCycles - CookEndCycles, (int64)0) * FPlatformTime::GetSecondsPerCycle64());
+	}
+
+	Scheduler.Stop();
+	SchedulerThread->WaitForCompletion();
+	delete SchedulerThread;
+	FHoudiniCoreTestsCookStubs::Uninstall();
+
+	OutLatencies.Sort();
+}
+
+// Sets the cook wait console variables for the lifetime of the scope
+struct FHoudiniCoreTestsCookWaitSettings
+{
+	FHoudiniCoreTestsCookWaitSettings(const float& InSpinTime, const float& InMinSleep, const float& InMaxSleep)
+	{
+		Set(TEXT("HoudiniEngine.CookWaitSpinTime"), InSpinTime, 0);
+		Set(TEXT("HoudiniEngine.CookWaitMinSleep"), InMinSleep, 1);
+		Set(TEXT("HoudiniEngine.CookWaitMaxSleep"), InMaxSleep, 2);
+	}
+
+	~FHoudiniCoreTestsCookWaitSettings()
+	{
+		for (int32 Idx = 0; Idx < 3; Idx++)
+		{
+			if (Variables[Idx])
+				Variables[Idx]->Set(PreviousValues[Idx], ECVF_SetByCode);
+		}
+	}
+
+	void Set(const TCHAR* InName, const float& InValue, const int32& InIdx)
+	{
+		Variables[InIdx] = IConsoleManager::Get().FindConsoleVariable(InName);
+		if (!Variables[InIdx])
+			return;
+
+		PreviousValues[InIdx] = Variables[InIdx]->GetFloat();
+		Variables[InIdx]->Set(InValue, ECVF_SetByCode);
+	}
+
+	IConsoleVariable* Variables[3] = { nullptr, nullptr, nullptr };
+	float PreviousValues[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_CookWaitLatency, "Houdini.Core.Benchmark.CookWaitLatency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreTest_CookWaitLatency::RunTest(const FString & Parameters)
+{
+	const int32 NumCooks = 50;
+
+	// Previous behaviour: fixed 100ms sleep between each status poll
+	TArray<double> FixedSleepLatencies;
+	{
+		FHoudiniCoreTestsCookWaitSettings FixedSleepSettings(0.0f, 0.1f, 0.1f);
+		HoudiniCoreTests_MeasureCookWaitLatency(NumCooks, FixedSleepLatencies);
+	}
+
+	// Spin, then adaptive backoff, with the default settings
+	TArray<double> AdaptiveLatencies;
+	HoudiniCoreTests_MeasureCookWaitLatency(NumCooks, AdaptiveLatencies);
+
+	AddInfo(FString::Printf(TEXT("Fixed sleep: p50 = %.3fms p95 = %.3fms p99 = %.3fms"),
+		HoudiniCoreTests_Percentile(FixedSleepLatencies, 0.5) * 1000.0,
+		HoudiniCoreTests_Percentile(FixedSleepLatencies, 0.95) * 1000.0,
+		HoudiniCoreTests_Percentile(FixedSleepLatencies, 0.99) * 1000.0));
+
+	AddInfo(FString::Printf(TEXT("Adaptive: p50 = %.3fms p95 = %.3fms p99 = %.3fms"),
+		HoudiniCoreTests_Percentile(AdaptiveLatencies, 0.5) * 1000.0,
+		HoudiniCoreTests_Percentile(AdaptiveLatencies, 0.95) * 1000.0,
+		HoudiniCoreTests_Percentile(AdaptiveLatencies, 0.99) * 1000.0));
+
+	// Posting the end of a cook should be faster than with the fixed sleep
+	TestTrue(TEXT("Adaptive wait p50 latency is lower than fixed sleep"),
+		HoudiniCoreTests_Percentile(AdaptiveLatencies, 0.5) <= HoudiniCoreTests_Percentile(FixedSleepLatencies, 0.5));
+	TestTrue(TEXT("Adaptive wait p95 latency is lower than fixed sleep"),
+		HoudiniCoreTests_Percentile(AdaptiveLatencies, 0.95) <= HoudiniCoreTests_Percentile(FixedSleepLatencies, 0.95));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_SessionPool, "Houdini.Core.SessionPool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_SessionPool::RunTest(const FString & Parameters)
+{
+	// Stand-in sessions aren't connected to a server, but are enough to test session assignment
+	FHoudiniEngineSessionPool SessionPool;
+	SessionPool.AddStandInSessions(3);
+	TestEqual(TEXT("Number of pool sessions"), SessionPool.GetNumPoolSessions(), 3);
+	TestNull(TEXT("Main session isn't owned by the pool"), SessionPool.GetSession(0));
+	TestNotNull(TEXT("Pool session 1"), SessionPool.GetSession(1));
+	TestNull(TEXT("Invalid pool session"), SessionPool.GetSession(4));
+
+	// Pin 8 objects, they should be spread evenly over the 4 sessions (main session included)
+	TArray<UHoudiniAsset*> Objects;
+	for (int32 Idx = 0; Idx < 8; Idx++)
+	{
+		UHoudiniAsset* Object = NewObject<UHoudiniAsset>(GetTransientPackage());
+		Object->AddToRoot();
+		Objects.Add(Object);
+		SessionPool.PinObject(Object);
+	}
+
+	for (int32 SessionIdx = 0; SessionIdx <= 3; SessionIdx++)
+		TestEqual(FString::Printf(TEXT("Objects pinned to session %d"), SessionIdx), SessionPool.GetNumPinnedObjects(SessionIdx), 2);
+
+	// Pinning again returns the same session
+	const int32 FirstSession = SessionPool.PinObject(Objects[0]);
+	TestEqual(TEXT("Pinning is stable"), SessionPool.PinObject(Objects[0]), FirstSession);
+
+	// Forced pins, and unpinning
+	TestEqual(TEXT("Forced pin"), SessionPool.PinObject(Objects[1], 3), 3);
+	SessionPool.UnpinObject(Objects[1]);
+	int32 NumPinned = 0;
+	for (int32 SessionIdx = 0; SessionIdx <= 3; SessionIdx++)
+		NumPinned += SessionPool.GetNumPinnedObjects(SessionIdx);
+	TestEqual(TEXT("Pinned objects after unpin"), NumPinned, 7);
+
+	// The scoped session sets and restores the calling thread's session
+	const int32 PreviousSessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	{
+		FHoudiniEngineScopedSession ScopedSession(2);
+		TestEqual(TEXT("Scoped session index"), FHoudiniEngineRuntime::GetCurrentSessionIndex(), 2);
+		{
+			FHoudiniEngineScopedSession NestedScopedSession(INDEX_NONE);
+			TestEqual(TEXT("Invalid index uses the main session"), FHoudiniEngineRuntime::GetCurrentSessionIndex(), 0);
+		}
+		TestEqual(TEXT("Nested scope restored"), FHoudiniEngineRuntime::GetCurrentSessionIndex(), 2);
+	}
+	TestEqual(TEXT("Scope restored"), FHoudiniEngineRuntime::GetCurrentSessionIndex(), PreviousSessionIndex);
+
+	// Input node identifiers are keyed by session, so input nodes are never shared across sessions
+	const FUnrealObjectInputIdentifier MainIdentifier(Objects[0], FUnrealObjectInputOptions(), true);
+	{
+		FHoudiniEngineScopedSession ScopedSession(2);
+		const FUnrealObjectInputIdentifier PoolIdentifier(Objects[0], FUnrealObjectInputOptions(), true);
+		TestEqual(TEXT("Identifier session"), PoolIdentifier.GetSessionIndex(), 2);
+		TestFalse(TEXT("Identifiers from different sessions differ"), PoolIdentifier == MainIdentifier);
+		TestTrue(TEXT("Identifiers from the same session match"), PoolIdentifier == FUnrealObjectInputIdentifier(Objects[0], FUnrealObjectInputOptions(), true));
+
+		FUnrealObjectInputIdentifier ParentIdentifier;
+		TestTrue(TEXT("Parent identifier"), PoolIdentifier.MakeParentIdentifier(ParentIdentifier));
+		TestEqual(TEXT("Parent identifier session"), ParentIdentifier.GetSessionIndex(), 2);
+	}
+
+	// Objects without an owner component use the calling thread's session
+	TestEqual(TEXT("Unowned object session"), FHoudiniEngineRuntime::GetSessionIndexForObject(Objects[0]), PreviousSessionIndex);
+
+	for (UHoudiniAsset* Object : Objects)
+		Object->RemoveFromRoot();
+
+	SessionPool.StopSessions();
+	TestEqual(TEXT("Pool stopped"), SessionPool.GetNumPoolSessions(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_TaskQueue, "Houdini.Core.TaskQueue", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_TaskQueue::RunTest(const FString & Parameters)
+{
+	// Tasks are retrieved by priority, then in the order they were added
+	{
+		FHoudiniEngineTaskQueue Queue;
+		const EHoudiniEngineTaskPriority Priorities[] = {
+			EHoudiniEngineTaskPriority::Low, EHoudiniEngineTaskPriority::Normal, EHoudiniEngineTaskPriority::High, EHoudiniEngineTaskPriority::Normal };
+		for (int32 Idx = 0; Idx < UE_ARRAY_COUNT(Priorities); Idx++)
+		{
+			FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+			Task.AssetId = Idx;
+			Task.Priority = Priorities[Idx];
+			Queue.Enqueue(Task);
+		}
+		TestEqual(TEXT("Queued tasks"), Queue.Num(), 4);
+
+		const int32 ExpectedOrder[] = { 2, 1, 3, 0 };
+		for (int32 Idx = 0; Idx < UE_ARRAY_COUNT(ExpectedOrder); Idx++)
+		{
+			FHoudiniEngineTask Task;
+			TestTrue(TEXT("Dequeue task"), Queue.Dequeue(Task));
+			TestEqual(FString::Printf(TEXT("Task %d order"), Idx), Task.AssetId, ExpectedOrder[Idx]);
+		}
+
+		FHoudiniEngineTask Task;
+		TestFalse(TEXT("Queue is empty"), Queue.Dequeue(Task));
+		TestTrue(TEXT("Queue is empty"), Queue.IsEmpty());
+	}
+
+	// Stress test: many threads adding tasks while a single consumer retrieves them.
+	// No task should be lost, and tasks from a producer should keep their order within a priority.
+	{
+		const int32 NumProducers = 16;
+		const int32 TasksPerProducer = 4096;
+		const int32 NumTasks = NumProducers * TasksPerProducer;
+		const int32 NumPriorities = static_cast<int32>(EHoudiniEngineTaskPriority::Count);
+
+		FHoudiniEngineTaskQueue Queue;
+		FThreadSafeBool bProducersDone(false);
+
+		TFuture<bool> Consumer = Async(EAsyncExecution::Thread, [&Queue, &bProducersDone, NumProducers, NumTasks, NumPriorities]()
+		{
+			// Last sequence number received for each producer and priority
+			TArray<int32> LastSequence;
+			LastSequence.Init(-1, NumProducers * NumPriorities);
+
+			bool bInOrder = true;
+			int32 NumReceived = 0;
+			while (NumReceived < NumTasks)
+			{
+				FHoudiniEngineTask Task;
+				if (!Queue.Dequeue(Task))
+				{
+					if (bProducersDone && Queue.IsEmpty())
+						break;
+
+					FPlatformProcess::Yield();
+					continue;
+				}
+
+				const int32 SlotIndex = Task.AssetId * NumPriorities + static_cast<int32>(Task.Priority);
+				if (Task.AssetHapiName <= LastSequence[SlotIndex])
+					bInOrder = false;
+				LastSequence[SlotIndex] = Task.AssetHapiName;
+
+				NumReceived++;
+			}
+
+			return bInOrder && NumReceived == NumTasks;
+		});
+
+		ParallelFor(NumProducers, [&Queue, TasksPerProducer, NumPriorities](int32 ProducerIdx)
+		{
+			for (int32 Sequence = 0; Sequence < TasksPerProducer; Sequence++)
+			{
+				FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid());
+				Task.AssetId = ProducerIdx;
+				Task.AssetHapiName = Sequence;
+				Task.Priority = static_cast<EHoudiniEngineTaskPriority>(Sequence % NumPriorities);
+				Queue.Enqueue(Task);
+			}
+		}, EParallelForFlags::Unbalanced);
+
+		bProducersDone = true;
+
+		TestTrue(TEXT("All tasks received, in order"), Consumer.Get());
+		TestTrue(TEXT("Queue is empty"), Queue.IsEmpty());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_BenchmarkPercentile, "Houdini.Core.BenchmarkPercentile", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_BenchmarkPercentile::RunTest(const FString & Parameters)
+{
+	TArray<double> Samples;
+	TestEqual(TEXT("No samples"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 50.0f), 0.0);
+
+	// Unsorted 1..10
+	Samples = { 7.0, 3.0, 10.0, 1.0, 5.0, 9.0, 2.0, 8.0, 4.0, 6.0 };
+	TestEqual(TEXT("p50"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 50.0f), 5.0);
+	TestEqual(TEXT("p90"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 90.0f), 9.0);
+	TestEqual(TEXT("p99"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 99.0f), 10.0);
+	TestEqual(TEXT("p0"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 0.0f), 1.0);
+
+	Samples = { 42.0 };
+	TestEqual(TEXT("Single sample"), UHoudiniEngineCommandlet::ComputePercentile(Samples, 90.0f), 42.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_AssetLibraryCache, "Houdini.Core.AssetLibraryCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_AssetLibraryCache::RunTest(const FString & Parameters)
+{
+	// Two assets with the same content share their library
+	const uint8 Content[] = { 'I', 'N', 'D', 'X' };
+	UHoudiniAsset* AssetA = NewObject<UHoudiniAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	UHoudiniAsset* AssetB = NewObject<UHoudiniAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	AssetA->CreateAsset(Content, Content + 4, TEXT("A.hda"));
+	AssetB->CreateAsset(Content, Content + 4, TEXT("B.hda"));
+
+	const FString KeyA = FHoudiniEngineAssetLibraryCache::GetLibraryKey(AssetA, false);
+	TestFalse(TEXT("Memory key"), KeyA.IsEmpty());
+	TestEqual(TEXT("Same content, same key"), FHoudiniEngineAssetLibraryCache::GetLibraryKey(AssetB, false), KeyA);
+
+	const uint8 OtherContent[] = { 'I', 'N', 'D', 'Y' };
+	UHoudiniAsset* AssetC = NewObject<UHoudiniAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	AssetC->CreateAsset(OtherContent, OtherContent + 4, TEXT("A.hda"));
+	const FString KeyC = FHoudiniEngineAssetLibraryCache::GetLibraryKey(AssetC, false);
+	TestNotEqual(TEXT("Different content, different key"), KeyC, KeyA);
+
+	FHoudiniEngineAssetLibraryCache Cache;
+	TestEqual(TEXT("Not loaded"), Cache.FindLibrary(0, KeyA), -1);
+
+	// Libraries are cached per session
+	Cache.AddLibrary(0, KeyA, 3);
+	Cache.AddLibrary(1, KeyA, 5);
+	Cache.AddLibrary(1, KeyC, 7);
+	TestEqual(TEXT("Main session"), Cache.FindLibrary(0, KeyA), 3);
+	TestEqual(TEXT("Pool session"), Cache.FindLibrary(1, KeyA), 5);
+	TestEqual(TEXT("Not loaded in the main session"), Cache.FindLibrary(0, KeyC), -1);
+
+	// Sub-asset names are cached with their library
+	TArray<HAPI_StringHandle> AssetNames;
+	TestFalse(TEXT("No sub-asset names yet"), Cache.FindSubAssetNames(1, 5, AssetNames));
+	Cache.AddSubAssetNames(1, 5, { 11, 12 });
+	TestTrue(TEXT("Sub-asset names"), Cache.FindSubAssetNames(1, 5, AssetNames) && AssetNames.Num() == 2 && AssetNames[1] == 12);
+	TestFalse(TEXT("Sub-asset names of another session"), Cache.FindSubAssetNames(0, 5, AssetNames));
+
+	// A reimported asset needs to be reloaded in every session
+	Cache.RemoveAsset(AssetB);
+	TestEqual(TEXT("Removed from the main session"), Cache.FindLibrary(0, KeyA), -1);
+	TestEqual(TEXT("Removed from the pool session"), Cache.FindLibrary(1, KeyA), -1);
+	TestEqual(TEXT("Other libraries are kept"), Cache.FindLibrary(1, KeyC), 7);
+
+	// Stopping a session forgets its libraries
+	Cache.Empty(1);
+	TestEqual(TEXT("Session emptied"), Cache.Num(1), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_StringTable, "Houdini.Core.StringTable", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_StringTable::RunTest(const FString & Parameters)
+{
+	FHoudiniEngineStringTable Table;
+	TestEqual(TEXT("Not resolved"), Table.FindIndex(4), (int32)INDEX_NONE);
+
+	// Handles resolving to the same text share the same string
+	const int32 IndexA = Table.Add(4, TEXT("/Game/Rock"));
+	const int32 IndexB = Table.Add(9, TEXT("/Game/Rock"));
+	const int32 IndexC = Table.Add(12, TEXT("/Game/rock"));
+	TestEqual(TEXT("Same text, same string"), IndexB, IndexA);
+	TestNotEqual(TEXT("Strings are case sensitive"), IndexC, IndexA);
+	TestEqual(TEXT("Unique strings"), Table.Num(), 2);
+	TestEqual(TEXT("Resolved handles"), Table.NumHandles(), 3);
+	TestEqual(TEXT("Found"), Table.FindIndex(9), IndexA);
+	TestEqual(TEXT("String"), Table.GetString(IndexC), FString(TEXT("/Game/rock")));
+	TestEqual(TEXT("Name"), Table.GetName(IndexA), FName(TEXT("/Game/Rock")));
+
+	// Handles already resolved don't need HAPI
+	TestTrue(TEXT("Nothing to resolve"), Table.Resolve({ 4, 9, 12 }));
+
+	// Scopes make the table current on the calling thread only, nested scopes share the outermost table
+	TestNull(TEXT("No scope"), FHoudiniEngineStringTable::GetCurrent());
+	{
+		FHoudiniEngineStringTableScope OuterScope;
+		FHoudiniEngineStringTable* OuterTable = FHoudiniEngineStringTable::GetCurrent();
+		TestNotNull(TEXT("Outer scope"), OuterTable);
+		{
+			FHoudiniEngineStringTableScope InnerScope;
+			TestEqual(TEXT("Inner scope shares the table"), FHoudiniEngineStringTable::GetCurrent(), OuterTable);
+		}
+		TestEqual(TEXT("Outer scope still active"), FHoudiniEngineStringTable::GetCurrent(), OuterTable);
+
+		FHoudiniEngineStringTable* OtherThreadTable = Async(EAsyncExecution::ThreadPool, []() { return FHoudiniEngineStringTable::GetCurrent(); }).Get();
+		TestNull(TEXT("Not current on other threads"), OtherThreadTable);
+	}
+	TestNull(TEXT("Scope ended"), FHoudiniEngineStringTable::GetCurrent());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_VectorConversion, "Houdini.Core.VectorConversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_VectorConversion::RunTest(const FString & Parameters)
+{
+	// 5 vectors: one SIMD iteration and a remainder
+	const TArray<float> HoudiniPositions = { 1.0f, 2.0f, 3.0f, -0.5f, 0.25f, 8.0f, 0.0f, 0.0f, 0.0f, 10.0f, -20.0f, 30.0f, 0.01f, 0.02f, 0.03f };
+	const TArray<float> UnrealPositions = { 100.0f, 300.0f, 200.0f, -50.0f, 800.0f, 25.0f, 0.0f, 0.0f, 0.0f, 1000.0f, 3000.0f, -2000.0f, 1.0f, 3.0f, 2.0f };
+	const int32 NumVectors = HoudiniPositions.Num() / 3;
+
+	TArray<float> Result;
+	Result.SetNumZeroed(HoudiniPositions.Num());
+	FHoudiniEngineVectorConversion::HoudiniToUnrealPositions(HoudiniPositions.GetData(), Result.GetData(), NumVectors);
+	for (int32 Idx = 0; Idx < Result.Num(); Idx++)
+		TestEqual(FString::Printf(TEXT("Houdini to Unreal position [%d]"), Idx), Result[Idx], UnrealPositions[Idx], KINDA_SMALL_NUMBER);
+
+	// In place, with a build scale applied in Unreal's coordinate system
+	const FVector3f BuildScale(2.0f, 3.0f, 4.0f);
+	Result = UnrealPositions;
+	FHoudiniEngineVectorConversion::UnrealToHoudiniPositions(Result.GetData(), Result.GetData(), NumVectors, BuildScale);
+	for (int32 Idx = 0; Idx < NumVectors; Idx++)
+	{
+		TestEqual(TEXT("Unreal to Houdini position X"), Result[Idx * 3 + 0], HoudiniPositions[Idx * 3 + 0] * BuildScale.X, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Unreal to Houdini position Y"), Result[Idx * 3 + 1], HoudiniPositions[Idx * 3 + 1] * BuildScale.Z, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Unreal to Houdini position Z"), Result[Idx * 3 + 2], HoudiniPositions[Idx * 3 + 2] * BuildScale.Y, KINDA_SMALL_NUMBER);
+	}
+
+	// Swapping twice gives back the original values
+	Result = HoudiniPositions;
+	FHoudiniEngineVectorConversion::SwapYZ(Result.GetData(), Result.GetData(), NumVectors);
+	TestEqual(TEXT("Swapped Y"), Result[4], 8.0f);
+	TestEqual(TEXT("Swapped Z"), Result[5], 0.25f);
+	FHoudiniEngineVectorConversion::SwapYZ(Result.GetData(), Result.GetData(), NumVectors);
+	TestTrue(TEXT("Swapped back"), Result == HoudiniPositions);
+
+	const float HoudiniQuats[] = { 0.1f, 0.2f, 0.3f, 0.9f, -0.5f, 0.5f, -0.5f, 0.5f };
+	const float UnrealQuats[] = { 0.1f, 0.3f, 0.2f, -0.9f, -0.5f, -0.5f, 0.5f, -0.5f };
+	float QuatResult[8];
+	FHoudiniEngineVectorConversion::ConvertQuaternions(HoudiniQuats, QuatResult, 2);
+	for (int32 Idx = 0; Idx < 8; Idx++)
+		TestEqual(FString::Printf(TEXT("Quaternion [%d]"), Idx), QuatResult[Idx], UnrealQuats[Idx]);
+
+	// The parallel conversion gives the same results as the serial one
+	const int32 NumLargeVectors = FHoudiniEngineVectorConversion::ParallelChunkSize * 2 + 7;
+	TArray<float> LargeStream;
+	LargeStream.SetNumUninitialized(NumLargeVectors * 3);
+	for (int32 Idx = 0; Idx < LargeStream.Num(); Idx++)
+		LargeStream[Idx] = (float)(Idx % 1000) * 0.37f - 100.0f;
+
+	TArray<float> SerialResult;
+	SerialResult.SetNumUninitialized(LargeStream.Num());
+	FHoudiniEngineVectorConversion::HoudiniToUnrealPositions(LargeStream.GetData(), SerialResult.GetData(), NumLargeVectors);
+	FHoudiniEngineVectorConversion::ParallelHoudiniToUnrealPositions(LargeStream.GetData(), LargeStream.GetData(), NumLargeVectors);
+	TestTrue(TEXT("Parallel conversion matches"), LargeStream == SerialResult);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_VectorConversionBenchmark, "Houdini.Core.Benchmark.VectorConversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreTest_VectorConversionBenchmark::RunTest(const FString & Parameters)
+{
+	const int32 NumVectors = 4 * 1024 * 1024;
+	const int32 NumRuns = 5;
+
+	TArray<float> Input;
+	Input.SetNumUninitialized(NumVectors * 3);
+	for (int32 Idx = 0; Idx < Input.Num(); Idx++)
+		Input[Idx] = (float)(Idx % 4096) * 0.01f;
+
+	TArray<float> ScalarOutput;
+	ScalarOutput.SetNumUninitialized(Input.Num());
+	TArray<float> Output;
+	Output.SetNumUninitialized(Input.Num());
+
+	// Previous behaviour: per-element swap and scale
+	double ScalarTime = 0.0;
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Idx = 0; Idx < NumVectors; Idx++)
+		{
+			ScalarOutput[Idx * 3 + 0] = Input[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			ScalarOutput[Idx * 3 + 1] = Input[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			ScalarOutput[Idx * 3 + 2] = Input[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		}
+		ScalarTime += FPlatformTime::Seconds() - StartTime;
+	}
+
+	double VectorTime = 0.0;
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniEngineVectorConversion::HoudiniToUnrealPositions(Input.GetData(), Output.GetData(), NumVectors);
+		VectorTime += FPlatformTime::Seconds() - StartTime;
+	}
+	TestTrue(TEXT("Vectorized conversion matches"), Output == ScalarOutput);
+
+	double ParallelTime = 0.0;
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniEngineVectorConversion::ParallelHoudiniToUnrealPositions(Input.GetData(), Output.GetData(), NumVectors);
+		ParallelTime += FPlatformTime::Seconds() - StartTime;
+	}
+	TestTrue(TEXT("Parallel conversion matches"), Output == ScalarOutput);
+
+	AddInfo(FString::Printf(TEXT("%d positions: scalar = %.3fms vectorized = %.3fms parallel = %.3fms"),
+		NumVectors,
+		ScalarTime / NumRuns * 1000.0,
+		VectorTime / NumRuns * 1000.0,
+		ParallelTime / NumRuns * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_MeshPartPreparation, "Houdini.Core.MeshPartPreparation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_MeshPartPreparation::RunTest(const FString & Parameters)
+{
+	// Two triangles, the first one in a collision group: the second one ends up in the main geo split
+	{
+		FHoudiniGeoPartObject HGPO;
+		HGPO.PartInfo.FaceCount = 2;
+		HGPO.PartInfo.VertexCount = 6;
+
+		FHoudiniMeshPartData PartData;
+		PartData.PartVertexList = { 0, 1, 2, 2, 1, 3 };
+		PartData.bHasVertexList = true;
+		PartData.AllSplitGroups = { TEXT("collision_geo_a") };
+		PartData.SplitGroupMemberships.Add(TEXT("collision_geo_a"), { 1, 0 });
+		FHoudiniMeshTranslator::PreparePartData(HGPO, PartData);
+
+		TestTrue(TEXT("Part is prepared"), PartData.bIsPrepared);
+		TestEqual(TEXT("Split groups"), PartData.AllSplitGroups.Num(), 2);
+		TestTrue(TEXT("Collision vertices"), PartData.AllSplitVertexLists.FindRef(TEXT("collision_geo_a")) == THoudiniCookScratchArray<int32>({ 0, 1, 2, -1, -1, -1 }));
+		TestTrue(TEXT("Main geo vertices"), PartData.AllSplitVertexLists.FindRef(HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION) == THoudiniCookScratchArray<int32>({ -1, -1, -1, 2, 1, 3 }));
+		TestTrue(TEXT("Main geo faces"), PartData.AllSplitFaceIndices.FindRef(HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION) == THoudiniCookScratchArray<int32>({ 1 }));
+	}
+
+	// Preparing many parts in parallel gives bit-identical results to preparing them one after another.
+	// The whole serial and parallel translation of an output are compared in the editor unit tests.
+	const int32 NumParts = 64;
+	FRandomStream RandomStream(1234);
+
+	TArray<FHoudiniGeoPartObject> HGPOs;
+	TArray<FHoudiniMeshPartData> FetchedData;
+	HGPOs.SetNum(NumParts);
+	FetchedData.SetNum(NumParts);
+	for (int32 PartIdx = 0; PartIdx < NumParts; PartIdx++)
+	{
+		const int32 NumFaces = RandomStream.RandRange(1, 2000);
+		const int32 NumPoints = NumFaces + 2;
+
+		FHoudiniGeoPartObject& HGPO = HGPOs[PartIdx];
+		HGPO.PartId = PartIdx;
+		HGPO.PartInfo.FaceCount = NumFaces;
+		HGPO.PartInfo.VertexCount = NumFaces * 3;
+		HGPO.PartInfo.PointCount = NumPoints;
+
+		FHoudiniMeshPartData& PartData = FetchedData[PartIdx];
+		PartData.bHasVertexList = true;
+		PartData.PartVertexList.SetNumUninitialized(NumFaces * 3);
+		for (int32& Vertex : PartData.PartVertexList)
+			Vertex = RandomStream.RandRange(0, NumPoints - 1);
+
+		// Some parts have no split groups, some have empty groups that get discarded,
+		// and some have groups covering all the faces so there is no main geo split
+		const int32 NumGroups = RandomStream.RandRange(0, 4);
+		const bool bCoverAllFaces = RandomStream.FRand() < 0.2f;
+		for (int32 GroupIdx = 0; GroupIdx < NumGroups; GroupIdx++)
+		{
+			const FString GroupName = FString::Printf(TEXT("lod%d"), GroupIdx);
+			PartData.AllSplitGroups.Add(GroupName);
+
+			TArray<int32>& Membership = PartData.SplitGroupMemberships.Add(GroupName);
+			Membership.SetNumZeroed(NumFaces);
+			if (GroupIdx != 2)
+			{
+				for (int32& InGroup : Membership)
+					InGroup = (bCoverAllFaces && GroupIdx == 0) || RandomStream.FRand() < 0.3f ? 1 : 0;
+			}
+		}
+	}
+
+	TArray<FHoudiniMeshPartData> SerialData = FetchedData;
+	for (int32 PartIdx = 0; PartIdx < NumParts; PartIdx++)
+		FHoudiniMeshTranslator::PreparePartData(HGPOs[PartIdx], SerialData[PartIdx]);
+
+	// The parallel path prepares the parts in a cook arena, like the mesh translator's workers
+	FHoudiniCookScratchArena ScratchArena;
+	FHoudiniCookScratchArenaScope ScratchArenaScope(&ScratchArena);
+	TArray<FHoudiniMeshPartData> ParallelData = FetchedData;
+	ParallelFor(NumParts, [&](int32 PartIdx)
+	{
+		FHoudiniCookScratchArenaScope WorkerArenaScope(&ScratchArena);
+		FHoudiniMeshTranslator::PreparePartData(HGPOs[PartIdx], ParallelData[PartIdx]);
+	});
+	TestTrue(TEXT("Split data allocated in the arena"), ScratchArena.GetBytesUsed() > 0);
+
+	for (int32 PartIdx = 0; PartIdx < NumParts; PartIdx++)
+	{
+		const FHoudiniMeshPartData& Serial = SerialData[PartIdx];
+		const FHoudiniMeshPartData& Parallel = ParallelData[PartIdx];
+
+		bool bIdentical = Parallel.bIsPrepared && Serial.bIsPrepared;
+		bIdentical &= Parallel.AllSplitGroups == Serial.AllSplitGroups;
+		bIdentical &= Parallel.AllSplitVertexLists.Num() == Serial.AllSplitVertexLists.Num();
+		for (const FString& SplitGroup : Serial.AllSplitGroups)
+		{
+			bIdentical &= Parallel.AllSplitVertexLists.FindRef(SplitGroup) == Serial.AllSplitVertexLists.FindRef(SplitGroup);
+			bIdentical &= Parallel.AllSplitVertexCounts.FindRef(SplitGroup) == Serial.AllSplitVertexCounts.FindRef(SplitGroup);
+			bIdentical &= Parallel.AllSplitFaceIndices.FindRef(SplitGroup) == Serial.AllSplitFaceIndices.FindRef(SplitGroup);
+			bIdentical &= Parallel.AllSplitFirstValidVertexIndex.FindRef(SplitGroup) == Serial.AllSplitFirstValidVertexIndex.FindRef(SplitGroup);
+			bIdentical &= Parallel.AllSplitFirstValidPrimIndex.FindRef(SplitGroup) == Serial.AllSplitFirstValidPrimIndex.FindRef(SplitGroup);
+		}
+
+		TestTrue(FString::Printf(TEXT("Part %d prepared like the serial path"), PartIdx), bIdentical);
+		TestFalse(FString::Printf(TEXT("Part %d empty group discarded"), PartIdx), Parallel.AllSplitGroups.Contains(TEXT("lod2")));
+	}
+
+	return true;
+}
+
+// Gives the tests access to the mesh translator's part caches and mesh description building
+struct FHoudiniMeshTranslatorTestAccess : public FHoudiniMeshTranslator
+{
+	using FHoudiniMeshTranslator::AllSplitVertexCounts;
+	using FHoudiniMeshTranslator::AttribInfoColors;
+	using FHoudiniMeshTranslator::OutputAssignmentMaterials;
+	using FHoudiniMeshTranslator::PartPositions;
+	using FHoudiniMeshTranslator::PartUVSets;
+	using FHoudiniMeshTranslator::BuildMeshDescription;
+	using FHoudiniMeshTranslator::BuildLODMeshDescriptions;
+};
+
+// Serializes a mesh description so that two descriptions can be compared byte for byte
+static TArray<uint8>
+HoudiniCoreTests_SerializeMeshDescription(FMeshDescription& InMeshDescription)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << InMeshDescription;
+	return Bytes;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_MeshDescriptionThreads, "Houdini.Core.MeshDescriptionThreads", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_MeshDescriptionThreads::RunTest(const FString& Parameters)
+{
+	// A part with a few LODs, each using its own subset of the part's points
+	const int32 NumPoints = 4000;
+	const int32 NumLODs = 4;
+	FRandomStream RandomStream(1357);
+
+	FHoudiniMeshTranslatorTestAccess Translator;
+	FMemory::Memzero(Translator.AttribInfoColors);
+	Translator.AttribInfoColors.exists = true;
+	Translator.AttribInfoColors.tupleSize = 4;
+
+	Translator.PartPositions.SetNumUninitialized(NumPoints * 3);
+	for (float& Position : Translator.PartPositions)
+		Position = RandomStream.FRandRange(-500.0f, 500.0f);
+
+	Translator.PartUVSets.SetNum(2);
+	Translator.PartUVSets[0].SetNumZeroed(1);
+
+	// Two material slots: each LOD knew about one or both of them when its data was pulled
+	Translator.OutputAssignmentMaterials.Add(FHoudiniMaterialIdentifier(TEXT("/Game/Test/M_First"), false), nullptr);
+	Translator.OutputAssignmentMaterials.Add(FHoudiniMaterialIdentifier(TEXT("/Game/Test/M_Second"), false), nullptr);
+	TArray<int32> LODNumMaterialSlots;
+
+	FHoudiniSplitGroupMesh Mesh;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		const int32 NumFaces = 2000 >> LODIndex;
+		const int32 NumSplitVertices = FMath::Max(NumFaces / 2, 3);
+
+		FHoudiniGroupedMeshPrimitives& LOD = Mesh.SplitMeshData.AddDefaulted_GetRef();
+		LOD.SplitGroupName = FString::Printf(TEXT("lod%d"), LODIndex);
+		LOD.SplitId = LODIndex;
+		LOD.bIsLOD = true;
+		Mesh.LODRenders.Add(LODIndex);
+		Translator.AllSplitVertexCounts.Add(LOD.SplitGroupName, NumFaces * 3);
+		LODNumMaterialSlots.Add(LODIndex == 0 ? 1 : 2);
+
+		LOD.NeededVertices.SetNumUninitialized(NumSplitVertices);
+		for (int32& NeededVertex : LOD.NeededVertices)
+			NeededVertex = RandomStream.RandRange(0, NumPoints - 1);
+
+		LOD.Indices.SetNumUninitialized(NumFaces * 3);
+		for (uint32& Index : LOD.Indices)
+			Index = RandomStream.RandRange(0, NumSplitVertices - 1);
+
+		auto RandomValues = [&RandomStream](TArray<float>& OutValues, const int32& InNum)
+		{
+			OutValues.SetNumUninitialized(InNum);
+			for (float& Value : OutValues)
+				Value = RandomStream.FRand();
+		};
+		RandomValues(LOD.Normals, NumFaces * 3 * 3);
+		RandomValues(LOD.TangentU, NumFaces * 3 * 3);
+		RandomValues(LOD.TangentV, NumFaces * 3 * 3);
+		RandomValues(LOD.Colors, NumFaces * 3 * 4);
+		LOD.UVSets.SetNum(2);
+		RandomValues(LOD.UVSets[0], NumFaces * 3 * 2);
+
+		LOD.FaceMaterialIndices.SetNumUninitialized(NumFaces);
+		for (int32& MaterialIndex : LOD.FaceMaterialIndices)
+			MaterialIndex = RandomStream.RandRange(0, LODNumMaterialSlots.Last() - 1);
+
+		LOD.FaceSmoothingMasks.SetNumUninitialized(NumFaces * 3);
+		for (int32& SmoothingMask : LOD.FaceSmoothingMasks)
+			SmoothingMask = RandomStream.RandRange(0, 1);
+	}
+
+	// Each LOD built on its own, in order, as a single LOD mesh is built in place
+	TArray<TArray<uint8>> SerialBytes;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		FMeshDescription MeshDescription;
+		FStaticMeshAttributes(MeshDescription).Register();
+		Translator.BuildMeshDescription(&MeshDescription, Mesh.SplitMeshData[LODIndex], LODNumMaterialSlots[LODIndex]);
+		SerialBytes.Add(HoudiniCoreTests_SerializeMeshDescription(MeshDescription));
+	}
+
+	// The per LOD path, forced on a single thread then on the workers
+	TArray<FMeshDescription> SingleThreadDescriptions;
+	Translator.BuildLODMeshDescriptions(Mesh, LODNumMaterialSlots, SingleThreadDescriptions, EParallelForFlags::ForceSingleThread);
+
+	for (int32 Run = 0; Run < 4; Run++)
+	{
+		TArray<FMeshDescription> ParallelDescriptions;
+		Translator.BuildLODMeshDescriptions(Mesh, LODNumMaterialSlots, ParallelDescriptions);
+
+		TestEqual(TEXT("One mesh description per LOD"), ParallelDescriptions.Num(), NumLODs);
+		for (int32 LODIndex = 0; LODIndex < NumLODs && LODIndex < ParallelDescriptions.Num(); LODIndex++)
+		{
+			TestTrue(FString::Printf(TEXT("Run %d LOD %d built on workers matches the serial build"), Run, LODIndex),
+				HoudiniCoreTests_SerializeMeshDescription(ParallelDescriptions[LODIndex]) == SerialBytes[LODIndex]);
+		}
+	}
+
+	for (int32 LODIndex = 0; LODIndex < NumLODs && LODIndex < SingleThreadDescriptions.Num(); LODIndex++)
+	{
+		TestTrue(FString::Printf(TEXT("LOD %d built on a single thread matches the serial build"), LODIndex),
+			HoudiniCoreTests_SerializeMeshDescription(SingleThreadDescriptions[LODIndex]) == SerialBytes[LODIndex]);
+		TestEqual(FString::Printf(TEXT("LOD %d polygon groups"), LODIndex),
+			SingleThreadDescriptions[LODIndex].PolygonGroups().Num(), LODNumMaterialSlots[LODIndex]);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_CollisionFitThreads, "Houdini.Core.CollisionFitThreads", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_CollisionFitThreads::RunTest(const FString & Parameters)
+{
+	// Random points in a rotated, non uniformly scaled box
+	FRandomStream RandomStream(4321);
+	const FTransform BoxTransform(FRotator(30.0, 45.0, 10.0), FVector(100.0, -50.0, 20.0), FVector(3.0, 1.0, 0.5));
+
+	const int32 NumPoints = 5000;
+	TArray<houdini::gte::Vector3<double>> Points;
+	Points.SetNum(NumPoints);
+	for (int32 Idx = 0; Idx < NumPoints; Idx++)
+	{
+		const FVector Point = BoxTransform.TransformPosition(RandomStream.VRand() * RandomStream.FRandRange(0.0f, 100.0f));
+		Points[Idx] = { Point.X, Point.Y, Point.Z };
+	}
+
+	auto ComputeVolume = [&Points](const uint32 InNumThreads)
+	{
+		houdini::gte::MinimumVolumeBox3<double, double> BoxCompute(InNumThreads, InNumThreads > 1);
+		houdini::gte::OrientedBox3<double> MinimalBox = BoxCompute(Points.Num(), Points.GetData(), nullptr);
+		return MinimalBox.extent[0] * MinimalBox.extent[1] * MinimalBox.extent[2] * 8.0;
+	};
+
+	// The boxes fitted on the task graph must have the same volume as the one fitted on a single thread
+	const double SerialVolume = ComputeVolume(1);
+	TestTrue(TEXT("Fitted box is not empty"), SerialVolume > 0.0);
+	for (const uint32 NumThreads : { 2u, 4u, 16u })
+	{
+		const double ParallelVolume = ComputeVolume(NumThreads);
+		TestTrue(
+			FString::Printf(TEXT("Box fitted with %d tasks has the same volume"), NumThreads),
+			FMath::IsNearlyEqual(ParallelVolume, SerialVolume, SerialVolume * 1e-9));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_ScratchScope, "Houdini.Core.ScratchScope", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_ScratchScope::RunTest(const FString& Parameters)
+{
+	TestFalse(TEXT("No scope active"), FHoudiniScratchScope::IsActive());
+
+	FHoudiniCookStats Stats;
+	{
+		FHoudiniCookStatsScope StatsScope(&Stats);
+		FHoudiniScratchScope OuterScope;
+		TestTrue(TEXT("Outer scope active"), FHoudiniScratchScope::IsActive());
+
+		THoudiniScratchArray<int32> OuterArray;
+		OuterArray.SetNumZeroed(64 * 1024);
+		const int64 OuterBytes = FHoudiniScratchScope::GetBytesUsed();
+		TestTrue(TEXT("Outer allocation"), OuterBytes >= 64 * 1024 * (int64)sizeof(int32));
+
+		// Nested scopes, like the mesh translators' per split scopes, release their own allocations when they end
+		for (int32 SplitIdx = 0; SplitIdx < 8; SplitIdx++)
+		{
+			FHoudiniScratchScope InnerScope;
+			THoudiniScratchArray<int32> InnerArray;
+			InnerArray.SetNumZeroed(2 * 64 * 1024);
+			TestTrue(TEXT("Inner allocation"), FHoudiniScratchScope::GetBytesUsed() >= OuterBytes + 2 * 64 * 1024 * (int64)sizeof(int32));
+		}
+
+		TestTrue(TEXT("Outer scope is still active"), FHoudiniScratchScope::IsActive());
+		TestEqual(TEXT("Inner allocations released when the nested scopes end"), FHoudiniScratchScope::GetBytesUsed(), OuterBytes);
+		TestEqual(TEXT("Outer allocation kept"), OuterArray.Num(), 64 * 1024);
+	}
+
+	TestFalse(TEXT("Scopes released"), FHoudiniScratchScope::IsActive());
+	TestEqual(TEXT("No scratch memory used outside of a scope"), FHoudiniScratchScope::GetBytesUsed(), (int64)0);
+
+	// The peak includes the nested scopes' allocations, but they didn't add up
+	TestTrue(TEXT("Scratch memory recorded in the cook stats"), Stats.ScratchMemoryUsed >= 3 * 64 * 1024 * (int64)sizeof(int32));
+	TestTrue(TEXT("Nested scopes reused the same memory"), Stats.ScratchMemoryUsed < 8 * 64 * 1024 * (int64)sizeof(int32));
+	TestTrue(TEXT("High water mark"), FHoudiniScratchScope::GetHighWaterMark() >= Stats.ScratchMemoryUsed);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_CookScratchArena, "Houdini.Core.CookScratchArena", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_CookScratchArena::RunTest(const FString& Parameters)
+{
+	TestNull(TEXT("No arena outside of a cook"), FHoudiniCookScratchArena::GetCurrent());
+
+	// Without an arena, the containers use the heap
+	THoudiniCookScratchArray<int32> HeapArray;
+	HeapArray.SetNumZeroed(1024);
+	TestEqual(TEXT("Heap array"), HeapArray.Num(), 1024);
+
+	const int32 NumTasks = 16;
+	const int32 NumValues = 100 * 1000;
+	FHoudiniCookStats Stats;
+	{
+		FHoudiniCookStatsScope StatsScope(&Stats);
+		FHoudiniCookScratchArena ScratchArena;
+		FHoudiniCookScratchArenaScope ScratchArenaScope(&ScratchArena);
+		TestTrue(TEXT("Arena is current"), FHoudiniCookScratchArena::GetCurrent() == &ScratchArena);
+
+		// Arrays filled on worker threads, growing one value at a time, then read and moved on this thread
+		THoudiniCookScratchMap<int32, THoudiniCookScratchArray<int32>> ValuesPerTask;
+		TArray<THoudiniCookScratchArray<int32>> TaskValues;
+		TaskValues.SetNum(NumTasks);
+		ParallelFor(NumTasks, [&](int32 TaskIdx)
+		{
+			FHoudiniCookScratchArenaScope WorkerArenaScope(&ScratchArena);
+			THoudiniCookScratchArray<int32> Values;
+			for (int32 ValueIdx = 0; ValueIdx < NumValues; ValueIdx++)
+				Values.Add(TaskIdx * NumValues + ValueIdx);
+			TaskValues[TaskIdx] = MoveTemp(Values);
+		});
+
+		bool bValuesMatch = true;
+		for (int32 TaskIdx = 0; TaskIdx < NumTasks; TaskIdx++)
+		{
+			THoudiniCookScratchArray<int32>& Values = ValuesPerTask.Add(TaskIdx, MoveTemp(TaskValues[TaskIdx]));
+			bValuesMatch &= Values.Num() == NumValues;
+			for (int32 ValueIdx = 0; bValuesMatch && ValueIdx < NumValues; ValueIdx++)
+				bValuesMatch = Values[ValueIdx] == TaskIdx * NumValues + ValueIdx;
+		}
+		TestTrue(TEXT("Worker arrays moved and read on this thread"), bValuesMatch);
+		TestTrue(TEXT("Arena memory"), ScratchArena.GetBytesUsed() >= NumTasks * NumValues * (int64)sizeof(int32));
+
+		// Copying into a container created outside of the arena's scope keeps it on the heap, so it outlives the arena
+		HeapArray = ValuesPerTask[0];
+	}
+
+	TestNull(TEXT("Arena scope released"), FHoudiniCookScratchArena::GetCurrent());
+	TestEqual(TEXT("Copy outlives the arena"), HeapArray.Num(), NumValues);
+	TestTrue(TEXT("Arena memory recorded in the cook stats"), Stats.ScratchMemoryUsed >= NumTasks * NumValues * (int64)sizeof(int32));
+	TestTrue(TEXT("High water mark"), FHoudiniScratchScope::GetHighWaterMark() >= Stats.ScratchMemoryUsed);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_MeshPartStreaming, "Houdini.Core.MeshPartStreaming", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_MeshPartStreaming::RunTest(const FString& Parameters)
+{
+	UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetMutableDefault<UHoudiniRuntimeSettings>();
+	const int32 PreviousThreshold = HoudiniRuntimeSettings->MeshStreamingTriangleThreshold;
+	HoudiniRuntimeSettings->MeshStreamingTriangleThreshold = 1000;
+
+	FHoudiniGeoPartObject HGPO;
+	HGPO.PartInfo.FaceCount = 1000;
+	HGPO.PartInfo.VertexCount = 3000;
+	HGPO.PartInfo.PointCount = 600;
+	TestTrue(TEXT("Large triangle part is streamed"), FHoudiniMeshTranslator::ShouldStreamPart(HGPO));
+
+	HGPO.PartInfo.FaceCount = 999;
+	HGPO.PartInfo.VertexCount = 2997;
+	TestFalse(TEXT("Part under the threshold is not streamed"), FHoudiniMeshTranslator::ShouldStreamPart(HGPO));
+
+	HGPO.PartInfo.FaceCount = 1000;
+	HGPO.PartInfo.VertexCount = 4000;
+	TestFalse(TEXT("Part with quads is not streamed"), FHoudiniMeshTranslator::ShouldStreamPart(HGPO));
+
+	HGPO.PartInfo.VertexCount = 3000;
+	HGPO.SplitGroups.Add(TEXT("collision_geo"));
+	TestFalse(TEXT("Part with split groups is not streamed"), FHoudiniMeshTranslator::ShouldStreamPart(HGPO));
+
+	HGPO.SplitGroups.Empty();
+	HoudiniRuntimeSettings->MeshStreamingTriangleThreshold = 0;
+	TestFalse(TEXT("Streaming disabled"), FHoudiniMeshTranslator::ShouldStreamPart(HGPO));
+
+	HoudiniRuntimeSettings->MeshStreamingTriangleThreshold = PreviousThreshold;
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_MeshPartStreamingTransfer, "Houdini.Core.MeshPartStreamingTransfer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_MeshPartStreamingTransfer::RunTest(const FString& Parameters)
+{
+	// A triangle part whose triangles mostly use nearby points, but where each range also uses the first and last points,
+	// so the points used by a range span the whole part
+	const int32 NumPoints = 20000;
+	const int32 NumTriangles = 3000;
+	const int32 TrianglesPerRange = 256;
+	FRandomStream RandomStream(2468);
+
+	TArray<int32> PartVertexList;
+	PartVertexList.SetNumUninitialized(NumTriangles * 3);
+	for (int32 VertexIdx = 0; VertexIdx < PartVertexList.Num(); VertexIdx++)
+		PartVertexList[VertexIdx] = FMath::Clamp(VertexIdx * 2 + RandomStream.RandRange(-50, 50), 0, NumPoints - 1);
+	for (int32 TriangleStart = 0; TriangleStart < NumTriangles; TriangleStart += TrianglesPerRange)
+	{
+		PartVertexList[TriangleStart * 3] = 0;
+		PartVertexList[TriangleStart * 3 + 1] = NumPoints - 1;
+	}
+
+	auto MakeAttribute = [&RandomStream](const HAPI_AttributeOwner& InOwner, const int32& InCount, const int32& InTupleSize, TArray<float>& OutValues)
+	{
+		HAPI_AttributeInfo AttribInfo;
+		FMemory::Memzero(AttribInfo);
+		AttribInfo.exists = true;
+		AttribInfo.owner = InOwner;
+		AttribInfo.count = InCount;
+		AttribInfo.tupleSize = InTupleSize;
+
+		OutValues.SetNumUninitialized(InCount * InTupleSize);
+		for (float& Value : OutValues)
+			Value = RandomStream.FRandRange(-1.0f, 1.0f);
+
+		return AttribInfo;
+	};
+
+	TArray<TArray<float>> AllValues;
+	TArray<HAPI_AttributeInfo> AllInfos;
+	AllValues.SetNum(4);
+	AllInfos.Add(MakeAttribute(HAPI_ATTROWNER_POINT, NumPoints, 3, AllValues[0]));
+	AllInfos.Add(MakeAttribute(HAPI_ATTROWNER_VERTEX, NumTriangles * 3, 2, AllValues[1]));
+	AllInfos.Add(MakeAttribute(HAPI_ATTROWNER_PRIM, NumTriangles, 1, AllValues[2]));
+	AllInfos.Add(MakeAttribute(HAPI_ATTROWNER_DETAIL, 1, 4, AllValues[3]));
+
+	for (int32 AttribIdx = 0; AttribIdx < AllInfos.Num(); AttribIdx++)
+	{
+		const HAPI_AttributeInfo& AttribInfo = AllInfos[AttribIdx];
+		const TArray<float>& Values = AllValues[AttribIdx];
+
+		// Values of the whole part, as the non-streamed mesh creation transfers them
+		TArray<float> ExpectedValues;
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(PartVertexList, AttribInfo, Values, ExpectedValues);
+
+		// Values transferred one range at a time, as the streamed mesh creation transfers them
+		TArray<float> StreamedValues;
+		TArray<int32> VertexList;
+		TArray<float> WedgeValues;
+		int32 MaxFetchedPerRange = 0;
+		bool bTransferred = true;
+		for (int32 TriangleStart = 0; TriangleStart < NumTriangles; TriangleStart += TrianglesPerRange)
+		{
+			const int32 TriangleCount = FMath::Min(TrianglesPerRange, NumTriangles - TriangleStart);
+			VertexList = TArray<int32>(&PartVertexList[TriangleStart * 3], TriangleCount * 3);
+
+			int32 FetchedInRange = 0;
+			bTransferred &= FHoudiniMeshTranslator::TransferStreamedAttributeToVertices(
+				VertexList, TriangleStart, NumPoints, AttribInfo.owner, AttribInfo.tupleSize,
+				[&](const int32 InStart, const int32 InCount, TArray<float>& OutValues)
+				{
+					if (InStart < 0 || InCount <= 0 || InStart + InCount > AttribInfo.count)
+						return false;
+
+					FetchedInRange += InCount;
+					OutValues = TArray<float>(&Values[InStart * AttribInfo.tupleSize], InCount * AttribInfo.tupleSize);
+					return true;
+				},
+				WedgeValues);
+
+			MaxFetchedPerRange = FMath::Max(MaxFetchedPerRange, FetchedInRange);
+			StreamedValues.Append(WedgeValues);
+		}
+
+		const FString Owner = FString::Printf(TEXT("Owner %d"), static_cast<int32>(AttribInfo.owner));
+		TestTrue(Owner + TEXT(" transferred"), bTransferred);
+		TestTrue(Owner + TEXT(" streamed values match the non-streamed values"), StreamedValues == ExpectedValues);
+		TestTrue(Owner + TEXT(" fetches no more values than the range's vertices"), MaxFetchedPerRange <= TrianglesPerRange * 3);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_InstanceTransformPipeline, "Houdini.Core.InstanceTransformPipeline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_InstanceTransformPipeline::RunTest(const FString& Parameters)
+{
+	const int32 NumTransforms = 2500;
+	auto MakeHapiTransform = [](const int32 InIndex)
+	{
+		HAPI_Transform HapiTransform;
+		FMemory::Memzero(HapiTransform);
+		HapiTransform.position[0] = (float)InIndex;
+		HapiTransform.position[1] = 1.0f;
+		HapiTransform.position[2] = -(float)InIndex;
+		HapiTransform.rotationQuaternion[3] = 1.0f;
+		HapiTransform.scale[0] = 1.0f;
+		HapiTransform.scale[1] = 2.0f;
+		HapiTransform.scale[2] = 3.0f;
+		HapiTransform.rstOrder = HAPI_SRT;
+		return HapiTransform;
+	};
+
+	// Chunks must be fetched in order, on the calling thread
+	int32 NextStart = 0;
+	bool bFetchedInOrder = true;
+	const uint32 CallingThreadId = FPlatformTLS::GetCurrentThreadId();
+	auto Fetcher = [&](const int32 InStart, const int32 InCount, HAPI_Transform* OutTransforms)
+	{
+		bFetchedInOrder &= InStart == NextStart && FPlatformTLS::GetCurrentThreadId() == CallingThreadId;
+		NextStart = InStart + InCount;
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			OutTransforms[Idx] = MakeHapiTransform(InStart + Idx);
+		return true;
+	};
+
+	TArray<FTransform> Transforms;
+	TestTrue(TEXT("Pipelined fetch"), FHoudiniEngineUtils::HapiGetTransformsPipelined(Fetcher, NumTransforms, Transforms, 1000));
+	TestTrue(TEXT("Chunks fetched in order on the calling thread"), bFetchedInOrder);
+	TestEqual(TEXT("Every transform fetched"), NextStart, NumTransforms);
+	TestEqual(TEXT("Transform count"), Transforms.Num(), NumTransforms);
+
+	bool bAllMatch = true;
+	for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+	{
+		FTransform Expected;
+		FHoudiniEngineUtils::TranslateHapiTransform(MakeHapiTransform(Idx), Expected);
+		bAllMatch &= Transforms[Idx].Equals(Expected);
+	}
+	TestTrue(TEXT("Transforms match the serial translation"), bAllMatch);
+
+	// A failed fetch aborts the download
+	auto FailingFetcher = [](const int32 InStart, const int32 InCount, HAPI_Transform* OutTransforms)
+	{
+		return InStart < 2000;
+	};
+	TestFalse(TEXT("Failed fetch"), FHoudiniEngineUtils::HapiGetTransformsPipelined(FailingFetcher, NumTransforms, Transforms, 1000));
+	TestEqual(TEXT("No transforms after a failed fetch"), Transforms.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_AttributeUploadPipeline, "Houdini.Core.AttributeUploadPipeline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_AttributeUploadPipeline::RunTest(const FString& Parameters)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FMemory::Memzero(AttributeInfo);
+	AttributeInfo.count = 2500;
+	AttributeInfo.tupleSize = 3;
+
+	const int32 ChunkSize = 1000;
+	auto Producer = [&AttributeInfo](const int32 InStart, const int32 InCount, float* OutValues)
+	{
+		for (int32 Idx = 0; Idx < InCount * AttributeInfo.tupleSize; Idx++)
+			OutValues[Idx] = (float)(InStart * AttributeInfo.tupleSize + Idx);
+		return true;
+	};
+
+	// Chunks must be sent in order, on the calling thread, with the values of their own elements
+	int32 NextStart = 0;
+	int32 NumChunks = 0;
+	bool bSentInOrder = true;
+	bool bValuesMatch = true;
+	const uint32 CallingThreadId = FPlatformTLS::GetCurrentThreadId();
+	auto Uploader = [&](const float* InValues, const int32 InStart, const int32 InCount)
+	{
+		bSentInOrder &= InStart == NextStart && FPlatformTLS::GetCurrentThreadId() == CallingThreadId;
+		bSentInOrder &= InCount == FMath::Min(ChunkSize, AttributeInfo.count - InStart);
+		for (int32 Idx = 0; Idx < InCount * AttributeInfo.tupleSize; Idx++)
+			bValuesMatch &= InValues[Idx] == (float)(InStart * AttributeInfo.tupleSize + Idx);
+
+		NextStart = InStart + InCount;
+		NumChunks++;
+		return HAPI_RESULT_SUCCESS;
+	};
+
+	TestEqual(TEXT("Pipelined upload"), FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(Producer, Uploader, AttributeInfo, ChunkSize), HAPI_RESULT_SUCCESS);
+	TestTrue(TEXT("Chunks sent in order on the calling thread"), bSentInOrder);
+	TestTrue(TEXT("Chunk values match the produced values"), bValuesMatch);
+	TestEqual(TEXT("Every element sent"), NextStart, AttributeInfo.count);
+	TestEqual(TEXT("Chunk count"), NumChunks, 3);
+
+	// A single chunk is sent as is
+	NextStart = 0;
+	NumChunks = 0;
+	TestEqual(TEXT("Single chunk upload"), FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(Producer, Uploader, AttributeInfo, AttributeInfo.count), HAPI_RESULT_SUCCESS);
+	TestEqual(TEXT("Single chunk count"), NumChunks, 1);
+
+	// A failed production stops the upload before the chunk is sent
+	NextStart = 0;
+	NumChunks = 0;
+	auto FailingProducer = [&Producer](const int32 InStart, const int32 InCount, float* OutValues)
+	{
+		return InStart < 2000 && Producer(InStart, InCount, OutValues);
+	};
+	TestEqual(TEXT("Failed production"), FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(FailingProducer, Uploader, AttributeInfo, ChunkSize), HAPI_RESULT_FAILURE);
+	TestEqual(TEXT("Chunks sent before the failed production"), NumChunks, 2);
+
+	// A failed send stops the upload
+	NumChunks = 0;
+	auto FailingUploader = [&NumChunks](const float* InValues, const int32 InStart, const int32 InCount)
+	{
+		NumChunks++;
+		return InStart < 1000 ? HAPI_RESULT_SUCCESS : HAPI_RESULT_FAILURE;
+	};
+	TestEqual(TEXT("Failed send"), FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(Producer, FailingUploader, AttributeInfo, ChunkSize), HAPI_RESULT_FAILURE);
+	TestEqual(TEXT("No chunk sent after the failed send"), NumChunks, 2);
+
+	// Empty attributes are rejected
+	AttributeInfo.count = 0;
+	TestEqual(TEXT("Empty upload"), FHoudiniEngineUtils::HapiSetAttributeFloatDataPipelined(Producer, Uploader, AttributeInfo, ChunkSize), HAPI_RESULT_INVALID_ARGUMENT);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_AttributeCatalogScope, "Houdini.Core.AttributeCatalogScope", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_AttributeCatalogScope::RunTest(const FString& Parameters)
+{
+	FHoudiniEngineAttributeCatalog Catalog;
+	HAPI_AttributeInfo AttributeInfo;
+
+	// Nodes aren't cataloged outside of a scope, HAPI has to be queried directly
+	Catalog.SetCookCount(1, 3);
+	TestEqual(TEXT("No catalog outside of a scope"), Catalog.NumGeoCatalogs(), 0);
+	TestFalse(TEXT("Uncataloged lookup"), Catalog.FindAttributeInfo(1, 0, "P", HAPI_ATTROWNER_POINT, AttributeInfo));
+
+	{
+		FHoudiniEngineAttributeCatalogScope Scope(Catalog);
+		Catalog.SetCookCount(1, 3);
+		Catalog.SetCookCount(2, 5);
+		Catalog.SetCookCount(2, 6);
+		TestEqual(TEXT("Nodes cataloged in the scope"), Catalog.NumGeoCatalogs(), 2);
+
+		{
+			// Nested scopes share the outermost scope's nodes
+			FHoudiniEngineAttributeCatalogScope NestedScope(Catalog);
+			Catalog.SetCookCount(3, 1);
+		}
+		TestEqual(TEXT("Nodes kept after a nested scope"), Catalog.NumGeoCatalogs(), 3);
+
+		// A negative cook count removes the node
+		Catalog.SetCookCount(2, -1);
+		TestEqual(TEXT("Node removed"), Catalog.NumGeoCatalogs(), 2);
+
+		// Scopes only catalog nodes in their own catalog
+		FHoudiniEngineAttributeCatalog OtherCatalog;
+		OtherCatalog.SetCookCount(4, 1);
+		TestEqual(TEXT("Other catalog unaffected"), OtherCatalog.NumGeoCatalogs(), 0);
+	}
+	TestEqual(TEXT("Catalogs removed at the end of the scope"), Catalog.NumGeoCatalogs(), 0);
+
+	{
+		FHoudiniEngineAttributeCatalogScope Scope(Catalog);
+		Catalog.SetCookCount(1, 3);
+		Catalog.Empty(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+		TestEqual(TEXT("Session catalogs emptied"), Catalog.NumGeoCatalogs(), 0);
+	}
+
+	return true;
+}
+
+#endif
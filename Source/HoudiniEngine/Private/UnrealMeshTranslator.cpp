@@ -31,6 +31,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineTimers.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineVectorConversion.h"
 #include "HoudiniMeshUtils.h"
 #include "UnrealObjectInputRuntimeTypes.h"
 #include "UnrealObjectInputRuntimeUtils.h"
@@ -1119,20 +1120,17 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	//--------------------------------------------------------------------------------------------------------------------- 
 	if (RawMesh.VertexPositions.Num() > 3)
 	{
-		TArray<float> StaticMeshVertices;
-		StaticMeshVertices.SetNumZeroed(RawMesh.VertexPositions.Num() * 3);
-		for (int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx)
-		{			
+		// Convert the positions chunk by chunk while they are being uploaded
+		auto ConvertPositions = [&RawMesh, &BuildScaleVector](const int32 InStart, const int32 InCount, float* OutValues)
+		{
 			// Convert Unreal to Houdini
-			const FVector3f& PositionVector = RawMesh.VertexPositions[VertexIdx];
-			StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X;
-			StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z;
-			StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y;
-		}
+			FHoudiniEngineVectorConversion::UnrealToHoudiniPositions(
+				&RawMesh.VertexPositions[InStart].X, OutValues, InCount, BuildScaleVector);
+			return true;
+		};
 
-		// Now that we have raw positions, we can upload them for our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-			StaticMeshVertices, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatDataStreamed(
+			ConvertPositions, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
 	}
 
 	//--------------------------------------------------------------------------------------------------------------------- 
@@ -2951,30 +2949,37 @@ FUnrealMeshTranslator::CreateAndPopulateMeshPartFromMeshDescription(
 	TArray<int32> VertexIDToHIndex;
 	if (bIsVertexPositionsValid && VertexPositions.GetNumElements() >= 3)
 	{
-		TArray<float> StaticMeshVertices;
-		StaticMeshVertices.SetNumUninitialized(NumVertices * 3);
-				
 		VertexIDToHIndex.SetNumUninitialized(MDVertices.GetArraySize());
 		for (int32 n = 0; n < VertexIDToHIndex.Num(); n++)
 			VertexIDToHIndex[n] = INDEX_NONE;
 
-		int32 VertexIdx = 0;
+		// Record the UE Vertex ID to Houdini Point Index lookup (and its reverse, used to convert the positions)
+		TArray<FVertexID> HIndexToVertexID;
+		HIndexToVertexID.Reserve(NumVertices);
 		for (const FVertexID& VertexID : MDVertices.GetElementIDs())
 		{
-			// Convert Unreal to Houdini
-			const FVector3f& PositionVector = VertexPositions.Get(VertexID);
-			StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X;
-			StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z;
-			StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y;
-
-			// Record the UE Vertex ID to Houdini Point Index lookup
-			VertexIDToHIndex[VertexID.GetValue()] = VertexIdx;
-			VertexIdx++;
+			VertexIDToHIndex[VertexID.GetValue()] = HIndexToVertexID.Add(VertexID);
 		}
 
-		// Now that we have raw positions, we can upload them for our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-			StaticMeshVertices, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
+		// Convert the positions chunk by chunk while they are being uploaded
+		auto ConvertPositions = [&VertexPositions, &HIndexToVertexID, &BuildScaleVector](const int32 InStart, const int32 InCount, float* OutValues)
+		{
+			// Gather the sparse positions, then convert them Unreal to Houdini in place
+			for (int32 VertexIdx = InStart; VertexIdx < InStart + InCount; ++VertexIdx)
+			{
+				const FVector3f& PositionVector = VertexPositions.Get(HIndexToVertexID[VertexIdx]);
+				float* StaticMeshVertex = OutValues + (VertexIdx - InStart) * 3;
+				StaticMeshVertex[0] = PositionVector.X;
+				StaticMeshVertex[1] = PositionVector.Y;
+				StaticMeshVertex[2] = PositionVector.Z;
+			}
+
+			FHoudiniEngineVectorConversion::UnrealToHoudiniPositions(OutValues, OutValues, InCount, BuildScaleVector);
+			return true;
+		};
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatDataStreamed(
+			ConvertPositions, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
 	}
 
 	//--------------------------------------------------------------------------------------------------------------------- 
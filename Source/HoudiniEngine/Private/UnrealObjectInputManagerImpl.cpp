@@ -30,12 +30,14 @@
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniEngineUtils.h"
 #include "UnrealObjectInputRuntimeTypes.h"
 #include "UnrealObjectInputUtils.h"
 
 FUnrealObjectInputManagerImpl::FUnrealObjectInputManagerImpl()
-	: WorldOriginNodeId()
+	: WorldOriginNodeIds()
 {
 }
 
@@ -596,7 +598,9 @@ FUnrealObjectInputHAPINodeId
 FUnrealObjectInputManagerImpl::GetWorldOriginNodeId(const bool bInCreateIfMissingOrInvalid)
 {
 	static const FUnrealObjectInputHAPINodeId InvalidNode;
-	
+
+	// Each session has its own world origin node
+	FUnrealObjectInputHAPINodeId& WorldOriginNodeId = WorldOriginNodeIds.FindOrAdd(FHoudiniEngineRuntime::GetCurrentSessionIndex());
 	if (WorldOriginNodeId.IsValid())
 		return WorldOriginNodeId;
 
@@ -703,6 +707,8 @@ FUnrealObjectInputManagerImpl::AreHAPINodesValid(const FUnrealObjectInputIdentif
 	FUnrealObjectInputNode const* Node = nullptr;
 	if (!GetNode(InIdentifier, Node) || !Node)
 		return false;
+	// The nodes are checked in the session they were created in
+	FHoudiniEngineScopedSession ScopedSession(InIdentifier.GetSessionIndex());
 	return Node->AreHAPINodesValid();
 }
 
@@ -794,7 +800,8 @@ FUnrealObjectInputManagerImpl::RemoveRef(const FUnrealObjectInputIdentifier& InI
 	
 	if (Node->IsRefCounted() && Node->GetRefCount() == 0 && Node->CanBeDeleted())
 	{
-		// Destroy HAPI nodes
+		// Destroy HAPI nodes, in the session they were created in
+		FHoudiniEngineScopedSession ScopedSession(InIdentifier.GetSessionIndex());
 		if (Node->AreHAPINodesValid())
 		{
 			// if (FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), Node->GetNodeId()) != HAPI_RESULT_SUCCESS)
@@ -169,8 +169,8 @@ private:
 	/** The input node entries by identifier. */
 	TMap<FUnrealObjectInputIdentifier, FUnrealObjectInputNode*> InputNodes;
 
-	/** The HAPI Node id of the world origin null, use for transforms when object merging. */
-	FUnrealObjectInputHAPINodeId WorldOriginNodeId;
+	/** The HAPI Node ids of the world origin nulls, use for transforms when object merging, by session index. */
+	TMap<int32, FUnrealObjectInputHAPINodeId> WorldOriginNodeIds;
 
 	/** Map of a node identifier to data about nodes that reference it. */
 	TMap<FUnrealObjectInputIdentifier, FUnrealObjectInputBackLinkReferences> BackLinks;
@@ -149,6 +149,66 @@ FHoudiniAssetComponentDetails::GetSessionStatusAndColor(
 	return result;
 }
 
+void
+FHoudiniAssetComponentDetails::AddCookStatsRows(IDetailCategoryBuilder& InCategory, const TWeakObjectPtr<UHoudiniAssetComponent>& InHAC)
+{
+	InCategory.AddCustomRow(FText::FromString("Cook Stats"))
+	.WholeRowContent()
+	[
+		SNew(STextBlock)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+		.Text_Lambda([InHAC]()
+		{
+			return GetCookStatsText(InHAC.Get());
+		})
+	];
+}
+
+FText
+FHoudiniAssetComponentDetails::GetCookStatsText(const UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC))
+		return FText::GetEmpty();
+
+	const FHoudiniCookStatsHistory& History = InHAC->GetCookStatsHistory();
+	if (History.Num() <= 0)
+		return FText::FromString(TEXT("No cook recorded yet."));
+
+	const int32 NumPhases = static_cast<int32>(EHoudiniCookStatsPhase::Count);
+
+	// Average of all the cooks in the history
+	TArray<double> AveragePhaseTimes;
+	AveragePhaseTimes.Init(0.0, NumPhases);
+	for (int32 CookIdx = 0; CookIdx < History.Num(); CookIdx++)
+	{
+		for (int32 PhaseIdx = 0; PhaseIdx < NumPhases; PhaseIdx++)
+			AveragePhaseTimes[PhaseIdx] += History.Get(CookIdx).PhaseTimes[PhaseIdx] / History.Num();
+	}
+
+	const FHoudiniCookStats& LastCook = History.Get(0);
+	FString StatsString = FString::Printf(TEXT("Last cook: %.3fs%s\t(Average of %d cooks)\n"),
+		LastCook.GetTotalTime(), LastCook.bOutputsProcessed ? TEXT("") : TEXT(" - outputs not processed"), History.Num());
+
+	for (int32 PhaseIdx = 0; PhaseIdx < NumPhases; PhaseIdx++)
+	{
+		StatsString += FString::Printf(TEXT("    %s: %.3fs\t(%.3fs)\n"),
+			FHoudiniCookStats::GetPhaseName(static_cast<EHoudiniCookStatsPhase>(PhaseIdx)),
+			LastCook.PhaseTimes[PhaseIdx], AveragePhaseTimes[PhaseIdx]);
+
+		if (static_cast<EHoudiniCookStatsPhase>(PhaseIdx) != EHoudiniCookStatsPhase::InputUpload)
+			continue;
+
+		for (const auto& InputTime : LastCook.InputUploadTimes)
+			StatsString += FString::Printf(TEXT("        %s: %.3fs\n"), *InputTime.Key, InputTime.Value);
+	}
+
+	StatsString += FString::Printf(TEXT("Sent: %s    Received: %s    Attribute lookups: %lld\n"),
+		*FText::AsMemory(LastCook.BytesSent).ToString(), *FText::AsMemory(LastCook.BytesReceived).ToString(), LastCook.AttributeLookupRoundTrips);
+	StatsString += FString::Printf(TEXT("Scratch memory: %s"), *FText::AsMemory(LastCook.ScratchMemoryUsed).ToString());
+
+	return FText::FromString(StatsString);
+}
+
 void 
 FHoudiniAssetComponentDetails::AddBakeMenu(IDetailCategoryBuilder& InCategory, UHoudiniAssetComponent* HAC) 
 {
@@ -593,6 +653,19 @@ FHoudiniAssetComponentDetails::CustomizeDetails(IDetailLayoutBuilder& DetailBuil
 			// TODO: Handle multi selection of outputs like params/inputs?	
 			OutputDetails->CreateWidget(HouOutputCategory, EditedOutputs);
 		}
+
+		//
+		// 7. COOK STATS
+		//
+
+		FString CookStatsCatName = TEXT(HOUDINI_ENGINE_EDITOR_CATEGORY_COOK_STATS);
+		CookStatsCatName += MultiSelectionIdentifier;
+
+		IDetailCategoryBuilder & HouCookStatsCategory =
+			DetailBuilder.EditCategory(*CookStatsCatName, FText::FromString("Houdini - Cook Stats"), ECategoryPriority::Uncommon);
+		HouCookStatsCategory.InitiallyCollapsed(true);
+
+		AddCookStatsRows(HouCookStatsCategory, MainComponent);
 	}
 }
 
@@ -62,6 +62,12 @@ private:
 	// Adds a category for baking options
 	void AddBakeMenu(IDetailCategoryBuilder& InCategory, UHoudiniAssetComponent* HAC);
 
+	// Adds rows displaying the timing breakdown of the component's last cooks
+	void AddCookStatsRows(IDetailCategoryBuilder& InCategory, const TWeakObjectPtr<UHoudiniAssetComponent>& InHAC);
+
+	// Returns a description of the component's last cook stats, and of its average cook stats
+	static FText GetCookStatsText(const UHoudiniAssetComponent* InHAC);
+
 	// Handler for double clicking the static mesh thumbnail, opens the editor.
 	FReply OnThumbnailDoubleClick(
 		const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent, UObject* Object);
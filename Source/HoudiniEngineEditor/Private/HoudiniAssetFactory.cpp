@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineEditorPrivatePCH.h"
 #include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
 #include "HoudiniToolsPackageAsset.h"
 #include "HoudiniToolsEditor.h"
 #include "HoudiniEngineUtils.h"
@@ -100,6 +101,10 @@ UHoudiniAssetFactory::FactoryCreateBinary(
 
 	// Import with the sanitized filename from the AssetImportData
 	FString SanitizedFileName = AssetImportData->GetSourceData().SourceFiles.Num() > 0 ? AssetImportData->GetSourceData().SourceFiles[0].RelativeFilename : UFactory::GetCurrentFilename();
+
+	// The asset's content is changing (reimport), its library needs to be reloaded in the sessions
+	FHoudiniEngine::Get().GetAssetLibraryCache().RemoveAsset(HoudiniAsset);
+
 	HoudiniAsset->CreateAsset(Buffer, BufferEnd, SanitizedFileName);
 
 	// Import optional external data for the HoudiniAsset.
@@ -39,7 +39,9 @@
 #include "HoudiniEngineEditor.h"
 #include "HoudiniEngineOutputStats.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniEngineSessionPool.h"
 #include "HoudiniFoliageTools.h"
 #include "HoudiniGeometryCollectionTranslator.h"
 #include "HoudiniGeoPartObject.h"
@@ -54,6 +56,7 @@
 #include "HoudiniPDGAssetLink.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniSplineComponent.h"
+#include "HoudiniStaticMeshBuildQueue.h"
 #include "HoudiniStringResolver.h"
 #include "UnrealLandscapeTranslator.h"
 
@@ -289,6 +292,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	EHoudiniEngineBakeOption InBakeOption,
 	bool bInRemoveHACOutputOnSuccess)
 {
+	// The HAC's nodes only exist in the session it is pinned to
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InHACToBake));
+
 	if (!IsValid(InHACToBake))
 		return false;
 
@@ -300,6 +306,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 		return false;
 	}
 
+	// Static meshes that are still being built asynchronously must be ready (and their components visible) before baking
+	FHoudiniStaticMeshBuildQueue::Get().FinishAll();
+
 	bool bSuccess = false;
 	switch (InBakeOption)
 	{
@@ -392,6 +401,8 @@ FHoudiniEngineBakeUtils::BakeHDAToActors(
 	AActor* InFallbackActor,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HoudiniAssetComponent));
+
 	if (!IsValid(HoudiniAssetComponent))
 		return false;
 
@@ -4544,6 +4555,8 @@ FHoudiniEngineBakeUtils::BakeBlueprints(
 	const FHoudiniBakeSettings& BakeSettings,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(HoudiniAssetComponent));
+
 	if (!IsValid(HoudiniAssetComponent))
 		return false;
 
@@ -7057,6 +7070,8 @@ FHoudiniEngineBakeUtils::BakePDGWorkResultObject(
 	TArray<EHoudiniInstancerComponentType> * InInstancerComponentTypesToBake,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniEngineScopedSession ScopedSession(FHoudiniEngineRuntime::GetSessionIndexForObject(InPDGAssetLink));
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -55,6 +55,8 @@
 #include "ObjectTools.h"
 #include "CoreGlobals.h"
 #include "HoudiniEngineOutputStats.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Misc/FeedbackContext.h"
 #include "HAL/FileManager.h"
 #include "Modules/ModuleManager.h"
@@ -2068,4 +2070,40 @@ FHoudiniEngineCommands::DumpGenericAttribute(const TArray<FString>& Args)
 	}
 }
 
+void
+FHoudiniEngineCommands::DumpCookStats(const TArray<FString>& Args)
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	FString FilePath = Args.Num() > 0
+		? Args[0]
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("CookStats.csv"));
+
+	TArray<FString> Lines;
+	Lines.Add(FHoudiniCookStats::GetCSVHeader());
+
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+	for (int32 Idx = 0; Idx < Runtime.GetRegisteredHoudiniComponentCount(); Idx++)
+	{
+		UHoudiniAssetComponent* HAC = Runtime.GetRegisteredHoudiniComponentAt(Idx);
+		if (!IsValid(HAC))
+			continue;
+
+		// Oldest cooks first
+		const FString ComponentName = HAC->GetPathName();
+		const FHoudiniCookStatsHistory& History = HAC->GetCookStatsHistory();
+		for (int32 CookIdx = History.Num() - 1; CookIdx >= 0; CookIdx--)
+			Lines.Add(History.Get(CookIdx).ToCSVRow(ComponentName));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("DumpCookStats: Unable to write %s."), *FilePath);
+		return;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("DumpCookStats: Exported %d cooks to %s."), Lines.Num() - 1, *FilePath);
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -141,6 +141,10 @@ public:
 
 	static void DumpGenericAttribute(const TArray<FString>& Args);
 
+	// Exports the cook stats of all the registered Houdini Asset Components to a CSV file.
+	// The file path can be given as argument, defaults to Saved/HoudiniEngine/CookStats.csv
+	static void DumpCookStats(const TArray<FString>& Args);
+
 	// Helper function for building static meshes for all assets using HoudiniStaticMesh
 	// If bSilent is false, show a progress dialog.
 	// If bRefineAll is true, then all components with HoudiniStaticMesh meshes will be
@@ -1611,6 +1611,11 @@ FHoudiniEngineEditor::RegisterConsoleCommands()
 		TEXT("Houdini.DumpGenericAttribute"),
 		TEXT("Outputs a list of all the generic property attribute for a given class."),
 		FConsoleCommandWithArgsDelegate::CreateStatic(&FHoudiniEngineCommands::DumpGenericAttribute));
+
+	static FAutoConsoleCommand CCmdDumpCookStats = FAutoConsoleCommand(
+		TEXT("Houdini.DumpCookStats"),
+		TEXT("Exports the timing breakdown of the last cooks of all Houdini Asset Components to a CSV file (default: Saved/HoudiniEngine/CookStats.csv)."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FHoudiniEngineCommands::DumpCookStats));
 }
 
 void
@@ -47,6 +47,10 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "HoudiniEditorUnitTestUtils.h"
 #include "FoliageType_InstancedStaticMesh.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshAttributes.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryWriter.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutput, "Houdini.UnitTests.OutputTests", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
@@ -294,6 +298,154 @@ bool FHoudiniEditorTestOutput::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Flattens the static meshes and instance transforms of every output object into one buffer per object. Node ids
+// change when the HDA is rebuilt, so objects are keyed by output index and part instead.
+static TMap<FString, TArray<uint8>>
+CaptureTranslatedOutputData(UHoudiniAssetComponent* HAC)
+{
+	TMap<FString, TArray<uint8>> Result;
+
+	TArray<UHoudiniOutput*> Outputs;
+	HAC->GetOutputs(Outputs);
+	for (int32 OutputIdx = 0; OutputIdx < Outputs.Num(); OutputIdx++)
+	{
+		for (const auto& OutputObjectPair : Outputs[OutputIdx]->GetOutputObjects())
+		{
+			const FHoudiniOutputObjectIdentifier& Identifier = OutputObjectPair.Key;
+			const FString Key = FString::Printf(TEXT("%d/%d/%s/%s/%d/%d"), OutputIdx, Identifier.PartId,
+				*Identifier.PartName, *Identifier.SplitIdentifier, Identifier.PrimitiveIndex, Identifier.PointIndex);
+
+			TArray<uint8>& Data = Result.Add(Key);
+			FMemoryWriter Writer(Data);
+
+			if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(OutputObjectPair.Value.OutputObject))
+			{
+				for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); LODIndex++)
+				{
+					const FMeshDescription* MeshDescription = StaticMesh->GetMeshDescription(LODIndex);
+					if (!MeshDescription)
+						continue;
+
+					FStaticMeshConstAttributes Attributes(*MeshDescription);
+					TVertexAttributesConstRef<FVector3f> Positions = Attributes.GetVertexPositions();
+					TVertexInstanceAttributesConstRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+					for (const FVertexID VertexID : MeshDescription->Vertices().GetElementIDs())
+					{
+						FVector3f Position = Positions[VertexID];
+						Writer << Position;
+					}
+
+					for (const FTriangleID TriangleID : MeshDescription->Triangles().GetElementIDs())
+					{
+						for (const FVertexInstanceID VertexInstanceID : MeshDescription->GetTriangleVertexInstances(TriangleID))
+						{
+							int32 VertexIndex = MeshDescription->GetVertexInstanceVertex(VertexInstanceID).GetValue();
+							FVector3f Normal = Normals[VertexInstanceID];
+							Writer << VertexIndex << Normal;
+						}
+					}
+				}
+			}
+
+			for (UObject* Component : OutputObjectPair.Value.OutputComponents)
+			{
+				UInstancedStaticMeshComponent* InstancedComponent = Cast<UInstancedStaticMeshComponent>(Component);
+				if (!InstancedComponent)
+					continue;
+
+				for (int32 InstanceIdx = 0; InstanceIdx < InstancedComponent->GetInstanceCount(); InstanceIdx++)
+				{
+					FTransform Transform;
+					InstancedComponent->GetInstanceTransform(InstanceIdx, Transform, true);
+					Writer << Transform;
+				}
+			}
+		}
+	}
+
+	return Result;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestParallelOutputTranslation, "Houdini.UnitTests.Outputs.ParallelTranslation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestParallelOutputTranslation::RunTest(const FString & Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// This test rebuilds an HDA with several meshes and instancers twice, once with the output translators running
+	///	serially and once with them fetching and building on worker threads, and checks both produce identical outputs.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	IConsoleVariable* ParallelTranslationCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.ParallelOutputTranslation"));
+	if (!TestNotNull(TEXT("HoudiniEngine.ParallelOutputTranslation"), ParallelTranslationCVar))
+		return false;
+
+	const int32 PreviousParallelTranslation = ParallelTranslationCVar->GetInt();
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/Game/TestHDAs/Instancer/instancer_types_obj"), FTransform::Identity, false));
+	Context->HAC->bOverrideGlobalProxyStaticMeshSettings = true;
+	Context->HAC->bEnableProxyStaticMeshOverride = false;
+
+	TSharedPtr<TMap<FString, TArray<uint8>>> SerialOutputData = MakeShared<TMap<FString, TArray<uint8>>>();
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Firstly: Rebuild with serial translation and record the outputs.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, ParallelTranslationCVar]()
+	{
+		ParallelTranslationCVar->Set(0);
+		Context->StartRebuildingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, SerialOutputData]()
+	{
+		*SerialOutputData = CaptureTranslatedOutputData(Context->HAC);
+		HOUDINI_TEST_NOT_EQUAL(SerialOutputData->Num(), 0);
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Next: Rebuild with parallel translation. Every output should match the serial one exactly.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, ParallelTranslationCVar]()
+	{
+		ParallelTranslationCVar->Set(1);
+		Context->StartRebuildingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, SerialOutputData, ParallelTranslationCVar, PreviousParallelTranslation]()
+	{
+		ParallelTranslationCVar->Set(PreviousParallelTranslation);
+
+		const TMap<FString, TArray<uint8>> ParallelOutputData = CaptureTranslatedOutputData(Context->HAC);
+		HOUDINI_TEST_EQUAL_ON_FAIL(ParallelOutputData.Num(), SerialOutputData->Num(), return true);
+
+		for (const auto& SerialPair : *SerialOutputData)
+		{
+			const TArray<uint8>* ParallelData = ParallelOutputData.Find(SerialPair.Key);
+			if (!TestNotNull(*SerialPair.Key, ParallelData))
+				continue;
+
+			TestTrue(*SerialPair.Key, *ParallelData == SerialPair.Value);
+		}
+
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Done
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	return true;
+}
+
 
 #endif
 
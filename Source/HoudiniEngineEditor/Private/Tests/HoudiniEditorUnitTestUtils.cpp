@@ -139,6 +139,13 @@ void FHoudiniTestContext::StartCookingHDA()
 	bPostOutputDelegateCalled = false;
 }
 
+void FHoudiniTestContext::StartRebuildingHDA()
+{
+	HAC->MarkAsNeedRebuild();
+	bCookInProgress = true;
+	bPostOutputDelegateCalled = false;
+}
+
 void FHoudiniTestContext::WaitForTicks(int Count)
 {
 	WaitTickFrame = Count + GFrameCounter;
@@ -275,6 +275,9 @@ struct FHoudiniTestContext
 	// Starts cooking the HDA asynchrously.
 	void StartCookingHDA();
 
+	// Starts rebuilding the HDA asynchronously, so every part is translated from scratch.
+	void StartRebuildingHDA();
+
 	// Starts cooking the Selected top network in the HDA asynchronously.
 	void StartCookingSelectedTOPNetwork();
 
@@ -29,10 +29,15 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniRuntimeSettings.h"
 #include "HoudiniToolsPackageAsset.h"
 #include "HoudiniToolsRuntimeUtils.h"
 
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "HAL/UnrealMemory.h"
 #include "UObject/ObjectSaveContext.h"
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
@@ -53,6 +58,9 @@ UHoudiniAsset::CreateAsset(const uint8 * BufferStart, const uint8 * BufferEnd, c
 {
 	AssetFileName = InFileName;
 
+	// Release the previous memory-mapped data
+	UnmapAssetBytes();
+
 	// Calculate buffer size.
 	AssetBytesCount = BufferEnd - BufferStart;
 
@@ -89,6 +97,8 @@ UHoudiniAsset::CreateAsset(const uint8 * BufferStart, const uint8 * BufferEnd, c
 		// ... or non commercial (Apprentice)
 		bAssetNonCommercial = true;
 	}
+
+	UpdateAssetBytesStorage();
 }
 
 void
@@ -96,12 +106,16 @@ UHoudiniAsset::FinishDestroy()
 {
 	// Release buffer which was used to store raw OTL data.
 	AssetBytes.Empty();
+	UnmapAssetBytes();
 	Super::FinishDestroy();
 }
 
 const uint8 *
 UHoudiniAsset::GetAssetBytes() const
 {
+	if (MappedAssetBytes.IsValid())
+		return MappedAssetBytes->GetMappedPtr();
+
 	return AssetBytes.GetData();
 }
 
@@ -117,11 +131,36 @@ UHoudiniAsset::GetAssetBytesCount() const
 	return AssetBytesCount;
 }
 
+const FString &
+UHoudiniAsset::GetAssetBytesHash() const
+{
+	return AssetBytesHash;
+}
+
+bool
+UHoudiniAsset::IsAssetBytesMemoryMapped() const
+{
+	return MappedAssetBytes.IsValid();
+}
+
 void
 UHoudiniAsset::Serialize(FArchive & Ar)
 {
+	// Memory-mapped data needs to be copied back to the buffer to be saved with the asset
+	const bool bSaveMappedAssetBytes = IsAssetBytesMemoryMapped() 
+		&& Ar.IsSaving() && !Ar.IsObjectReferenceCollector() && !Ar.IsCountingMemory();
+	if (bSaveMappedAssetBytes)
+		AssetBytes = TArray<uint8>(MappedAssetBytes->GetMappedPtr(), AssetBytesCount);
+
+	// Loaded data replaces the memory-mapped data
+	if (Ar.IsLoading())
+		UnmapAssetBytes();
+
 	// Serializes our UProperties
 	Super::Serialize(Ar);
+
+	if (bSaveMappedAssetBytes)
+		AssetBytes.Empty();
 	Ar.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
 
 	// Get the version
@@ -214,6 +253,95 @@ UHoudiniAsset::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS;
 }
 
+void
+UHoudiniAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+		UpdateAssetBytesStorage();
+}
+
+void
+UHoudiniAsset::UpdateAssetBytesStorage()
+{
+	const uint8* Bytes = GetAssetBytes();
+	if (!Bytes || AssetBytesCount <= 0)
+	{
+		AssetBytesHash.Empty();
+		return;
+	}
+
+	FSHAHash Hash;
+	FSHA1::HashBuffer(Bytes, AssetBytesCount, Hash.Hash);
+	AssetBytesHash = Hash.ToString();
+
+	// Expanded HDAs are always loaded from their directory, and never use the memory copy
+	if (IsAssetBytesMemoryMapped() || bAssetExpanded)
+		return;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bMemoryMapLargeHdas)
+		return;
+
+	const int64 SizeThreshold = (int64)HoudiniRuntimeSettings->MemoryMapHdaSizeThreshold * 1024 * 1024;
+	if ((int64)AssetBytesCount < SizeThreshold)
+		return;
+
+	// Release the in-memory copy once the data is mapped
+	if (MapAssetBytes())
+		AssetBytes.Empty();
+}
+
+bool
+UHoudiniAsset::MapAssetBytes()
+{
+	if (AssetBytesHash.IsEmpty())
+		return false;
+
+	// The cache files are named after the hash of their content, so can be shared by assets and editor sessions
+	const FString CacheFilePath = FPaths::Combine(
+		FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("HDACache"), AssetBytesHash + TEXT(".hda"));
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (FileManager.FileSize(*CacheFilePath) != (int64)AssetBytesCount)
+	{
+		if (AssetBytes.Num() != AssetBytesCount)
+			return false;
+
+		// Write to a temporary file first so a partially written file is never mapped
+		const FString TempFilePath = FPaths::CreateTempFilename(*FPaths::GetPath(CacheFilePath), TEXT("HDACache"));
+		if (!FFileHelper::SaveArrayToFile(AssetBytes, *TempFilePath)
+			|| !FileManager.Move(*CacheFilePath, *TempFilePath, true))
+		{
+			FileManager.Delete(*TempFilePath, false, false, true);
+			HOUDINI_LOG_WARNING(TEXT("Could not write the HDA cache file %s, keeping %s in memory."), *CacheFilePath, *GetPathName());
+			return false;
+		}
+	}
+
+	TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*CacheFilePath));
+	if (!MappedFile.IsValid())
+		return false;
+
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(0, AssetBytesCount));
+	if (!MappedRegion.IsValid() || MappedRegion->GetMappedSize() != (int64)AssetBytesCount)
+		return false;
+
+	MappedAssetFile = MoveTemp(MappedFile);
+	MappedAssetBytes = MoveTemp(MappedRegion);
+
+	return true;
+}
+
+void
+UHoudiniAsset::UnmapAssetBytes()
+{
+	// The region needs to be released before its file
+	MappedAssetBytes.Reset();
+	MappedAssetFile.Reset();
+}
+
 bool
 UHoudiniAsset::IsAssetLimitedCommercial() const
 {
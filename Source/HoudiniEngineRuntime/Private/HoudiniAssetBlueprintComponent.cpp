@@ -1676,6 +1676,7 @@ UHoudiniAssetBlueprintComponent::ApplyComponentInstanceData(FHoudiniAssetBluepri
 		bHasRegisteredComponentTemplate = InstanceData->bRegisteredComponentTemplate;
 
 		AssetState = InstanceData->AssetState;
+		FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
 		
 		SetCanDeleteHoudiniNodes(false);
 
@@ -1782,6 +1783,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 	{	
 		AssetId = -1;
 		AssetState = EHoudiniAssetState::ProcessTemplate;
+		FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
 	}
 
 	if (IsPreview()) 
@@ -1801,6 +1803,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 			AssetState = EHoudiniAssetState::NeedInstantiation;
 			bForceNeedUpdate = true;
 			bHoudiniAssetChanged = false;
+			FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
 			// TODO: Make this better?
 			CachedTemplateComponent->bHoudiniAssetChanged = false;
 		}
@@ -2147,6 +2150,7 @@ UHoudiniAssetBlueprintComponent::OnTemplateParametersChangedHandler(UHoudiniAsse
 		// to trigger an HDA update) so we are going to force NeedUpdate() to return true
 		// in order to get an initial cook.
 		bForceNeedUpdate = true;
+		FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
 	}
 
 	bUpdatedFromTemplate = true;
@@ -2170,7 +2174,7 @@ UHoudiniAssetBlueprintComponent::InvalidateData()
 			Input->InvalidateData();
 		}
 
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 		AssetId = -1;
 	}
 }
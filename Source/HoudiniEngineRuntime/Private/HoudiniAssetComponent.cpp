@@ -158,9 +158,18 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bCookOnAssetInputCook = true;
 
 	AssetId = -1;
+	SessionIndex = INDEX_NONE;
+	bRegisteredInRuntime = false;
 	AssetState = EHoudiniAssetState::NewHDA;
 	AssetStateResult = EHoudiniAssetStateResult::None;
 	AssetCookCount = 0;
+	CookInputsVersion = 0;
+	CookedInputsVersion = 0;
+	bCookCancelRequested = false;
+	bLastCookDiscarded = false;
+	CookTaskStartTime = 0.0;
+	bProxyMeshesBeingUpdated = false;
+	ProxyMeshesUpdateTime = 0.0;
 	
 	SubAssetIndex = -1;
 
@@ -878,6 +887,8 @@ UHoudiniAssetComponent::MarkAsNeedCook()
 	bRecookRequested = true;
 	bRebuildRequested = false;
 
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
+
 	//bEditorPropertiesNeedFullUpdate = true;
 
 	// We need to mark all our parameters as changed/trigger update
@@ -1633,6 +1644,9 @@ UHoudiniAssetComponent::PostEditChangeProperty(FPropertyChangedEvent & PropertyC
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	// Any property change may require processing (cook triggers, outputs...)
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
+
 	FProperty * Property = PropertyChangedEvent.MemberProperty;
 	if (!Property)
 		return;
@@ -1995,6 +2009,9 @@ UHoudiniAssetComponent::SetHasComponentTransformChanged(const bool& InHasChanged
 	{
 		bHasComponentTransformChanged = InHasChanged;
 		LastComponentTransform = GetComponentTransform();
+
+		if (InHasChanged)
+			FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
 	}
 }
 
@@ -2215,6 +2232,38 @@ UHoudiniAssetComponent::SetRefineMeshesTimer()
 	}
 }
 
+void
+UHoudiniAssetComponent::SetProxyMeshesBeingUpdated(bool bInBeingUpdated)
+{
+	if (bInBeingUpdated)
+		ProxyMeshesUpdateTime = FPlatformTime::Seconds();
+	else if (!bProxyMeshesBeingUpdated)
+		return;
+
+	bProxyMeshesBeingUpdated = bInBeingUpdated;
+	for (UHoudiniOutput* Output : Outputs)
+	{
+		if (!IsValid(Output))
+			continue;
+
+		for (auto& OutputObjectPair : Output->GetOutputObjects())
+		{
+			UHoudiniStaticMeshComponent* HSMC = Cast<UHoudiniStaticMeshComponent>(OutputObjectPair.Value.ProxyComponent);
+			if (IsValid(HSMC))
+				HSMC->SetMeshBeingUpdated(bInBeingUpdated);
+		}
+	}
+}
+
+void
+UHoudiniAssetComponent::UpdateProxyMeshesDrawPath()
+{
+	// Wait a bit after the last update, so that interactive edits that cook continuously stay on the dynamic path
+	const double StaticDrawDelaySeconds = 1.0;
+	if (bProxyMeshesBeingUpdated && (FPlatformTime::Seconds() - ProxyMeshesUpdateTime) > StaticDrawDelaySeconds)
+		SetProxyMeshesBeingUpdated(false);
+}
+
 void 
 UHoudiniAssetComponent::OnRefineMeshesTimerFired()
 {
@@ -2483,6 +2532,9 @@ UHoudiniAssetComponent::SetAssetState(EHoudiniAssetState InNewState)
 	const EHoudiniAssetState OldState = AssetState;
 	AssetState = InNewState;
 
+	// Make sure the manager processes us on its next tick
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(this);
+
 #if WITH_EDITOR
 	IHoudiniEditorAssetStateSubsystemInterface* const EditorSubsystem = IHoudiniEditorAssetStateSubsystemInterface::Get(); 
 	if (EditorSubsystem)
@@ -36,6 +36,7 @@
 #include "HoudiniOutput.h"
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniAssetStateTypes.h"
+#include "HoudiniCookStats.h"
 #include "IHoudiniAssetStateEvents.h"
 
 #include "Engine/EngineTypes.h"
@@ -97,6 +98,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
 	friend class FHoudiniAssetComponentDetails;
 #endif
 	friend class FHoudiniEditorEquivalenceUtils;
+	friend class FHoudiniEngineRuntime;
 	
 public:
 
@@ -177,6 +179,8 @@ public:
 
 	EHoudiniAssetStateResult GetAssetStateResult() const { return AssetStateResult; };
 	FGuid GetHapiGUID() const { return HapiGUID; };
+	int32 GetSessionIndex() const { return SessionIndex; };
+	bool IsRegisteredInRuntime() const { return bRegisteredInRuntime; };
 	FString GetHapiAssetName() const { return HapiAssetName; };
 	FGuid GetComponentGUID() const { return ComponentGUID; };
 
@@ -257,6 +261,16 @@ public:
 	// Returns true if the last cook of the HDA was successful
 	bool WasLastCookSuccessful() const { return bLastCookSuccess; }
 
+	// Returns true if parameters or inputs have changed since the current cook was started
+	bool IsCookOutOfDate() const { return CookInputsVersion != CookedInputsVersion; }
+
+	// Returns true if an out of date cook can be cancelled or have its outputs discarded.
+	// Cooks are only discarded once in a row, so the cook following a discarded one is always processed.
+	bool CanDiscardOutOfDateCook() const { return !bLastCookDiscarded; }
+
+	// Returns the timing breakdown of the last cooks of this component
+	const FHoudiniCookStatsHistory& GetCookStatsHistory() const { return CookStatsHistory; }
+
 	// Returns true if a parameter definition update (excluding values) is needed.
 	bool IsParameterDefinitionUpdateNeeded() const { return bParameterDefinitionUpdateNeeded; }
 
@@ -276,6 +290,7 @@ public:
 	//void SetAssetStateResult(const EHoudiniAssetStateResult& InAssetStateResult) { AssetStateResult = InAssetStateResult; };
 
 	//void SetHapiGUID(const FGuid& InGUID) { HapiGUID = InGUID; };
+	void SetSessionIndex(const int32& InSessionIndex) { SessionIndex = InSessionIndex; };
 	//void SetComponentGUID(const FGuid& InGUID) { ComponentGUID = InGUID; };
 
 	//UFUNCTION(BlueprintSetter)
@@ -291,6 +306,8 @@ public:
 
 	// Marks the assets as needing a recook
 	void MarkAsNeedCook();
+	// Indicates that a parameter or input value has changed, making any cook in progress out of date
+	void MarkCookInputsChanged() { CookInputsVersion++; };
 	// Marks the assets as needing a full rebuild
 	void MarkAsNeedRebuild();
 	// Marks the asset as needing to be instantiated
@@ -343,6 +360,8 @@ public:
 	//
 	void ClearDownstreamHoudiniAsset() { DownstreamHoudiniAssets.Empty(); };
 	//
+	const TSet<UHoudiniAssetComponent*>& GetDownstreamHoudiniAssets() const { return DownstreamHoudiniAssets; };
+	//
 	bool NotifyCookedToDownstreamAssets();
 	//
 	bool NeedsToWaitForInputHoudiniAssets();
@@ -354,6 +373,13 @@ public:
 	void SetRefineMeshesTimer();
 
 	virtual void OnRefineMeshesTimerFired();
+
+	// Marks the proxy mesh components of the outputs as being updated by cooks or not. Proxy meshes that are being
+	// updated are drawn with the dynamic path instead of caching static draw commands.
+	void SetProxyMeshesBeingUpdated(bool bInBeingUpdated);
+
+	// Switches the proxy meshes back to cached static draws once no cook has updated them for a short while.
+	void UpdateProxyMeshesDrawPath();
 	
 	// Called by RefineMeshesTimer when the timer is triggered.
 	// Checks for any UHoudiniStaticMesh in Outputs and bakes UStaticMesh for them via FHoudiniMeshTranslator.	 
@@ -671,6 +697,14 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	FGuid HapiGUID;
 
+	// Index of the Houdini Engine session this component's nodes are created in.
+	// INDEX_NONE until the component has been assigned a session of the session pool.
+	UPROPERTY(Transient, DuplicateTransient)
+	int32 SessionIndex;
+
+	// Indicates that this component is in the runtime's component registry
+	bool bRegisteredInRuntime;
+
 	// The asset name of the selected asset inside the asset library
 	UPROPERTY(DuplicateTransient)
 	FString HapiAssetName;
@@ -836,6 +870,34 @@ protected:
 	UPROPERTY(Transient)
 	double LastLiveSyncPingTime;
 
+	// Incremented every time one of the parameters or inputs of this component changes.
+	// Compared to CookedInputsVersion to detect cooks that are out of date before they finish.
+	uint32 CookInputsVersion;
+
+	// Value of CookInputsVersion when the current cook was started
+	uint32 CookedInputsVersion;
+
+	// Indicates that the current cook has been cancelled because it is out of date
+	bool bCookCancelRequested;
+
+	// Indicates that the previous cook was cancelled or had its outputs discarded because it was out of date
+	bool bLastCookDiscarded;
+
+	// Stats of the cook currently being processed
+	FHoudiniCookStats CurrentCookStats;
+
+	// Time at which the current cook task was started
+	double CookTaskStartTime;
+
+	// Indicates that the proxy meshes are drawn with the dynamic path, see SetProxyMeshesBeingUpdated()
+	bool bProxyMeshesBeingUpdated;
+
+	// Time at which the proxy meshes were last updated by a cook
+	double ProxyMeshesUpdateTime;
+
+	// Stats of the last cooks of this component
+	FHoudiniCookStatsHistory CookStatsHistory;
+
 	//
 	// Begin: IHoudiniAssetStateEvents
 	//
@@ -0,0 +1,358 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniBoundsUtils.h"
+
+#include "Async/ParallelFor.h"
+
+const int32 FHoudiniBoundsUtils::ParallelChunkSize = 32 * 1024;
+
+// Returns the number of chunks a point set is split in
+static int32
+HoudiniGetNumChunks(const int32& InNumPoints)
+{
+	return FMath::Max(FMath::DivideAndRoundUp(InNumPoints, FHoudiniBoundsUtils::ParallelChunkSize), 1);
+}
+
+// Splits a point set in chunks reduced in parallel.
+// InReduce receives the chunk index, and the first point and number of points of the chunk.
+static void
+HoudiniParallelReduce(const int32& InNumPoints, TFunctionRef<void(const int32 InChunkIdx, const int32 InStart, const int32 InCount)> InReduce)
+{
+	const int32 ChunkSize = FHoudiniBoundsUtils::ParallelChunkSize;
+	const int32 NumChunks = HoudiniGetNumChunks(InNumPoints);
+	if (NumChunks <= 1)
+	{
+		InReduce(0, 0, InNumPoints);
+		return;
+	}
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIdx)
+	{
+		const int32 Start = ChunkIdx * ChunkSize;
+		InReduce(ChunkIdx, Start, FMath::Min(ChunkSize, InNumPoints - Start));
+	});
+}
+
+// Min and max of a non empty range of points, one point per register
+template<typename T>
+static void
+HoudiniReduceBox(const UE::Math::TVector<T>* InPoints, const int32& InNumPoints, UE::Math::TVector<T>& OutMin, UE::Math::TVector<T>& OutMax)
+{
+	auto Min = VectorLoadFloat3(&InPoints[0].X);
+	auto Max = Min;
+	for (int32 PointIdx = 1; PointIdx < InNumPoints; ++PointIdx)
+	{
+		const auto Point = VectorLoadFloat3(&InPoints[PointIdx].X);
+		Min = VectorMin(Min, Point);
+		Max = VectorMax(Max, Point);
+	}
+
+	VectorStoreFloat3(Min, &OutMin.X);
+	VectorStoreFloat3(Max, &OutMax.X);
+}
+
+// Min and max of the points, reduced in parallel chunks
+template<typename T>
+static bool
+HoudiniParallelReduceBox(const UE::Math::TVector<T>* InPoints, const int32& InNumPoints, UE::Math::TVector<T>& OutMin, UE::Math::TVector<T>& OutMax)
+{
+	if (!InPoints || InNumPoints <= 0)
+		return false;
+
+	TArray<UE::Math::TVector<T>> ChunkMins, ChunkMaxs;
+	ChunkMins.SetNumUninitialized(HoudiniGetNumChunks(InNumPoints));
+	ChunkMaxs.SetNumUninitialized(ChunkMins.Num());
+	HoudiniParallelReduce(InNumPoints, [&](const int32 InChunkIdx, const int32 InStart, const int32 InCount)
+	{
+		HoudiniReduceBox(InPoints + InStart, InCount, ChunkMins[InChunkIdx], ChunkMaxs[InChunkIdx]);
+	});
+
+	OutMin = ChunkMins[0];
+	OutMax = ChunkMaxs[0];
+	for (int32 ChunkIdx = 1; ChunkIdx < ChunkMins.Num(); ++ChunkIdx)
+	{
+		OutMin = OutMin.ComponentMin(ChunkMins[ChunkIdx]);
+		OutMax = OutMax.ComponentMax(ChunkMaxs[ChunkIdx]);
+	}
+
+	return true;
+}
+
+FBox
+FHoudiniBoundsUtils::CalcBox(const FVector* InPoints, const int32& InNumPoints)
+{
+	FVector Min, Max;
+	if (!HoudiniParallelReduceBox(InPoints, InNumPoints, Min, Max))
+		return FBox(ForceInit);
+
+	return FBox(Min, Max);
+}
+
+FBox
+FHoudiniBoundsUtils::CalcBox(const FVector3f* InPoints, const int32& InNumPoints)
+{
+	FVector3f Min, Max;
+	if (!HoudiniParallelReduceBox(InPoints, InNumPoints, Min, Max))
+		return FBox(ForceInit);
+
+	return FBox(FVector(Min), FVector(Max));
+}
+
+void
+FHoudiniBoundsUtils::CalcExtremePoints(const FVector* InPoints, const int32& InNumPoints, int32 OutMinIndices[3], int32 OutMaxIndices[3])
+{
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		OutMinIndices[Axis] = INDEX_NONE;
+		OutMaxIndices[Axis] = INDEX_NONE;
+	}
+
+	FVector Min, Max;
+	if (!HoudiniParallelReduceBox(InPoints, InNumPoints, Min, Max))
+		return;
+
+	// Look for the first point reaching each extreme value, in each chunk.
+	// The chunks are merged in order, so the first point of the whole set is kept.
+	TArray<int32> ChunkIndices;
+	ChunkIndices.Init(INDEX_NONE, HoudiniGetNumChunks(InNumPoints) * 6);
+	HoudiniParallelReduce(InNumPoints, [&](const int32 InChunkIdx, const int32 InStart, const int32 InCount)
+	{
+		int32* Indices = ChunkIndices.GetData() + InChunkIdx * 6;
+		int32 NumFound = 0;
+		for (int32 PointIdx = InStart; PointIdx < InStart + InCount && NumFound < 6; ++PointIdx)
+		{
+			const FVector& Point = InPoints[PointIdx];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				if (Indices[Axis] == INDEX_NONE && Point[Axis] == Min[Axis])
+				{
+					Indices[Axis] = PointIdx;
+					NumFound++;
+				}
+
+				if (Indices[Axis + 3] == INDEX_NONE && Point[Axis] == Max[Axis])
+				{
+					Indices[Axis + 3] = PointIdx;
+					NumFound++;
+				}
+			}
+		}
+	});
+
+	for (int32 ChunkIdx = 0; ChunkIdx < ChunkIndices.Num() / 6; ++ChunkIdx)
+	{
+		const int32* Indices = ChunkIndices.GetData() + ChunkIdx * 6;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (OutMinIndices[Axis] == INDEX_NONE)
+				OutMinIndices[Axis] = Indices[Axis];
+
+			if (OutMaxIndices[Axis] == INDEX_NONE)
+				OutMaxIndices[Axis] = Indices[Axis + 3];
+		}
+	}
+}
+
+void
+FHoudiniBoundsUtils::CalcSlabExtents(
+	const FVector* InPoints, const int32& InNumPoints, const FVector* InDirections, const int32& InNumDirections, double* OutMaxDistances)
+{
+	if (InNumDirections <= 0)
+		return;
+
+	const double Lowest = TNumericLimits<double>::Lowest();
+	for (int32 DirIdx = 0; DirIdx < InNumDirections; ++DirIdx)
+		OutMaxDistances[DirIdx] = Lowest;
+
+	if (!InPoints || InNumPoints <= 0)
+		return;
+
+	// Directions are processed four at a time: one register per component of four directions.
+	// The last group is padded with the last direction.
+	const int32 NumGroups = FMath::DivideAndRoundUp(InNumDirections, 4);
+	TArray<VectorRegister4Double, TInlineAllocator<8>> DirX, DirY, DirZ;
+	for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
+	{
+		const FVector* Dirs[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+			Dirs[Lane] = &InDirections[FMath::Min(GroupIdx * 4 + Lane, InNumDirections - 1)];
+
+		DirX.Add(MakeVectorRegisterDouble(Dirs[0]->X, Dirs[1]->X, Dirs[2]->X, Dirs[3]->X));
+		DirY.Add(MakeVectorRegisterDouble(Dirs[0]->Y, Dirs[1]->Y, Dirs[2]->Y, Dirs[3]->Y));
+		DirZ.Add(MakeVectorRegisterDouble(Dirs[0]->Z, Dirs[1]->Z, Dirs[2]->Z, Dirs[3]->Z));
+	}
+
+	const int32 NumValues = NumGroups * 4;
+	TArray<double> ChunkMaxDistances;
+	ChunkMaxDistances.SetNumUninitialized(HoudiniGetNumChunks(InNumPoints) * NumValues);
+	HoudiniParallelReduce(InNumPoints, [&](const int32 InChunkIdx, const int32 InStart, const int32 InCount)
+	{
+		TArray<VectorRegister4Double, TInlineAllocator<8>> MaxDistances;
+		MaxDistances.Init(MakeVectorRegisterDouble(Lowest, Lowest, Lowest, Lowest), NumGroups);
+
+		for (int32 PointIdx = InStart; PointIdx < InStart + InCount; ++PointIdx)
+		{
+			const FVector& Point = InPoints[PointIdx];
+			const VectorRegister4Double X = MakeVectorRegisterDouble(Point.X, Point.X, Point.X, Point.X);
+			const VectorRegister4Double Y = MakeVectorRegisterDouble(Point.Y, Point.Y, Point.Y, Point.Y);
+			const VectorRegister4Double Z = MakeVectorRegisterDouble(Point.Z, Point.Z, Point.Z, Point.Z);
+			for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
+			{
+				// Same operations and order as FVector's dot product
+				const VectorRegister4Double Dot = VectorAdd(
+					VectorAdd(VectorMultiply(X, DirX[GroupIdx]), VectorMultiply(Y, DirY[GroupIdx])),
+					VectorMultiply(Z, DirZ[GroupIdx]));
+				MaxDistances[GroupIdx] = VectorMax(MaxDistances[GroupIdx], Dot);
+			}
+		}
+
+		double* Out = ChunkMaxDistances.GetData() + InChunkIdx * NumValues;
+		for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
+			VectorStore(MaxDistances[GroupIdx], Out + GroupIdx * 4);
+	});
+
+	for (int32 ChunkIdx = 0; ChunkIdx < ChunkMaxDistances.Num() / NumValues; ++ChunkIdx)
+	{
+		const double* ChunkDistances = ChunkMaxDistances.GetData() + ChunkIdx * NumValues;
+		for (int32 DirIdx = 0; DirIdx < InNumDirections; ++DirIdx)
+			OutMaxDistances[DirIdx] = FMath::Max(OutMaxDistances[DirIdx], ChunkDistances[DirIdx]);
+	}
+}
+
+double
+FHoudiniBoundsUtils::CalcMaxDistSquared(const FVector* InPoints, const int32& InNumPoints, const FVector& InCenter)
+{
+	if (!InPoints || InNumPoints <= 0)
+		return 0.0;
+
+	TArray<double> ChunkMaxDistances;
+	ChunkMaxDistances.SetNumZeroed(HoudiniGetNumChunks(InNumPoints));
+	HoudiniParallelReduce(InNumPoints, [&](const int32 InChunkIdx, const int32 InStart, const int32 InCount)
+	{
+		const VectorRegister4Double Center = VectorLoadFloat3(&InCenter.X);
+		VectorRegister4Double MaxDistance = VectorZeroDouble();
+		for (int32 PointIdx = InStart; PointIdx < InStart + InCount; ++PointIdx)
+		{
+			const VectorRegister4Double Delta = VectorSubtract(VectorLoadFloat3(&InPoints[PointIdx].X), Center);
+			MaxDistance = VectorMax(MaxDistance, VectorDot3(Delta, Delta));
+		}
+
+		double Result[4];
+		VectorStore(MaxDistance, Result);
+		ChunkMaxDistances[InChunkIdx] = Result[0];
+	});
+
+	double MaxDistance = 0.0;
+	for (const double& ChunkMaxDistance : ChunkMaxDistances)
+		MaxDistance = FMath::Max(MaxDistance, ChunkMaxDistance);
+
+	return MaxDistance;
+}
+
+FSphere
+FHoudiniBoundsUtils::CalcRitterSphere(const FVector* InPoints, const int32& InNumPoints)
+{
+	FSphere Sphere(ForceInit);
+	if (!InPoints || InNumPoints <= 0)
+		return Sphere;
+
+	// First, find the points that are furthest in each direction
+	int32 MinIndices[3], MaxIndices[3];
+	CalcExtremePoints(InPoints, InNumPoints, MinIndices, MaxIndices);
+
+	const FVector Extremes[3] = {
+		InPoints[MaxIndices[0]] - InPoints[MinIndices[0]],
+		InPoints[MaxIndices[1]] - InPoints[MinIndices[1]],
+		InPoints[MaxIndices[2]] - InPoints[MinIndices[2]] };
+
+	// Now find extreme points furthest apart, and initial center and radius of sphere.
+	// (the arithmetic matches GeomFitUtils' bounding sphere, in single precision)
+	Sphere.Center = InPoints[0];
+	float d2 = 0.f;
+	for (int32 i = 0; i < 3; i++)
+	{
+		const float tmpd2 = Extremes[i].SizeSquared();
+		if (tmpd2 > d2)
+		{
+			d2 = tmpd2;
+			Sphere.Center = InPoints[MinIndices[i]] + (0.5f * Extremes[i]);
+		}
+	}
+
+	const FVector Extents = FVector(Extremes[0].X, Extremes[1].Y, Extremes[2].Z);
+
+	// radius and radius squared
+	float r = 0.5f * Extents.GetMax();
+	float r2 = FMath::Square(r);
+
+	// If this point is outside the current bounding sphere, expand the radius just enough to include it.
+	auto GrowToInclude = [&Sphere, &r, &r2](const FVector& InPoint)
+	{
+		const FVector cToP = InPoint - Sphere.Center;
+		const float pr2 = cToP.SizeSquared();
+		if (pr2 > r2)
+		{
+			const float pr = FMath::Sqrt(pr2);
+			r = 0.5f * (r + pr);
+			r2 = FMath::Square(r);
+
+			Sphere.Center += ((pr - r) / pr * cToP);
+		}
+	};
+
+	// Reject the points inside the sphere four at a time, and only grow the sphere serially when one of them is outside.
+	// The vector test uses a slightly smaller radius, so rounding differences can only send points to the exact test:
+	// the margin covers a few float ulps, as the exact test may compute the squared distance in single precision.
+	int32 PointIdx = 0;
+	for (; PointIdx + 4 <= InNumPoints; PointIdx += 4)
+	{
+		const VectorRegister4Double Center = VectorLoadFloat3(&Sphere.Center.X);
+		const double Threshold = (double)r2 * (1.0 - 1.e-6);
+		const VectorRegister4Double RadiusSquared = MakeVectorRegisterDouble(Threshold, Threshold, Threshold, Threshold);
+
+		const VectorRegister4Double D0 = VectorSubtract(VectorLoadFloat3(&InPoints[PointIdx + 0].X), Center);
+		const VectorRegister4Double D1 = VectorSubtract(VectorLoadFloat3(&InPoints[PointIdx + 1].X), Center);
+		const VectorRegister4Double D2 = VectorSubtract(VectorLoadFloat3(&InPoints[PointIdx + 2].X), Center);
+		const VectorRegister4Double D3 = VectorSubtract(VectorLoadFloat3(&InPoints[PointIdx + 3].X), Center);
+		const VectorRegister4Double Outside = VectorBitwiseOr(
+			VectorBitwiseOr(VectorCompareGT(VectorDot3(D0, D0), RadiusSquared), VectorCompareGT(VectorDot3(D1, D1), RadiusSquared)),
+			VectorBitwiseOr(VectorCompareGT(VectorDot3(D2, D2), RadiusSquared), VectorCompareGT(VectorDot3(D3, D3), RadiusSquared)));
+
+		if (VectorMaskBits(Outside) == 0)
+			continue;
+
+		for (int32 BlockIdx = 0; BlockIdx < 4; ++BlockIdx)
+			GrowToInclude(InPoints[PointIdx + BlockIdx]);
+	}
+
+	// Remaining points
+	for (; PointIdx < InNumPoints; ++PointIdx)
+		GrowToInclude(InPoints[PointIdx]);
+
+	Sphere.W = r;
+	return Sphere;
+}
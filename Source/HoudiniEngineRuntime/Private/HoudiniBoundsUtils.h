@@ -0,0 +1,60 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Bounding volume reductions over point sets: axis aligned boxes, k-DOP slab extents and bounding spheres.
+// Used by the simple collision generators of the mesh translator and by the proxy static meshes' bounds.
+// The reductions use VectorRegister to process one point per register. Point sets larger than ParallelChunkSize
+// points are reduced in parallel chunks whose results are merged in chunk order, so the results do not depend
+// on the number of worker threads.
+struct HOUDINIENGINERUNTIME_API FHoudiniBoundsUtils
+{
+	// Axis aligned bounding box of the points. Returns an invalid (zero) box if there are no points.
+	static FBox CalcBox(const FVector* InPoints, const int32& InNumPoints);
+	static FBox CalcBox(const FVector3f* InPoints, const int32& InNumPoints);
+
+	// Index of the first point with the smallest / largest coordinate on each axis.
+	// The indices are set to INDEX_NONE if there are no points.
+	static void CalcExtremePoints(const FVector* InPoints, const int32& InNumPoints, int32 OutMinIndices[3], int32 OutMaxIndices[3]);
+
+	// Largest projection of the points on each direction (the slab extents of a k-DOP).
+	// OutMaxDistances must have room for InNumDirections values.
+	static void CalcSlabExtents(
+		const FVector* InPoints, const int32& InNumPoints, const FVector* InDirections, const int32& InNumDirections, double* OutMaxDistances);
+
+	// Largest squared distance between the points and InCenter.
+	static double CalcMaxDistSquared(const FVector* InPoints, const int32& InNumPoints, const FVector& InCenter);
+
+	// Ritter's bounding sphere: starts from the sphere spanning the pair of extreme points farthest apart,
+	// then grows it to include every point. Points that are inside the sphere are rejected four at a time.
+	static FSphere CalcRitterSphere(const FVector* InPoints, const int32& InNumPoints);
+
+	// Number of points reduced by each parallel task
+	static const int32 ParallelChunkSize;
+};
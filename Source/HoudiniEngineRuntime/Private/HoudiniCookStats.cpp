@@ -0,0 +1,246 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniCookStats.h"
+
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformTime.h"
+
+static thread_local FHoudiniCookStats* HoudiniCurrentCookStats = nullptr;
+static thread_local FHoudiniCookStatsPhaseScope* HoudiniCurrentCookStatsPhaseScope = nullptr;
+
+FHoudiniCookStats::FHoudiniCookStats()
+	: StartTime(FDateTime::Now())
+	, BytesSent(0)
+	, BytesReceived(0)
+	, AttributeLookupRoundTrips(0)
+	, ScratchMemoryUsed(0)
+	, bOutputsProcessed(false)
+{
+	for (double& PhaseTime : PhaseTimes)
+		PhaseTime = 0.0;
+}
+
+const TCHAR*
+FHoudiniCookStats::GetPhaseName(const EHoudiniCookStatsPhase& InPhase)
+{
+	switch (InPhase)
+	{
+		case EHoudiniCookStatsPhase::ParameterUpload:
+			return TEXT("Parameter Upload");
+		case EHoudiniCookStatsPhase::InputUpload:
+			return TEXT("Input Upload");
+		case EHoudiniCookStatsPhase::Cook:
+			return TEXT("Cook");
+		case EHoudiniCookStatsPhase::OutputFetch:
+			return TEXT("Output Fetch");
+		case EHoudiniCookStatsPhase::MeshBuild:
+			return TEXT("Mesh Build");
+		case EHoudiniCookStatsPhase::ComponentUpdate:
+			return TEXT("Component Update");
+		default:
+			break;
+	}
+
+	return TEXT("Unknown");
+}
+
+double
+FHoudiniCookStats::GetTotalTime() const
+{
+	double TotalTime = 0.0;
+	for (const double& PhaseTime : PhaseTimes)
+		TotalTime += PhaseTime;
+
+	return TotalTime;
+}
+
+FString
+FHoudiniCookStats::GetCSVHeader()
+{
+	FString Header = TEXT("Component,StartTime,OutputsProcessed,Total");
+	for (int32 PhaseIdx = 0; PhaseIdx < static_cast<int32>(EHoudiniCookStatsPhase::Count); PhaseIdx++)
+		Header += FString::Printf(TEXT(",%s"), GetPhaseName(static_cast<EHoudiniCookStatsPhase>(PhaseIdx)));
+
+	Header += TEXT(",InputUploadByType,BytesSent,BytesReceived,AttributeLookupRoundTrips,ScratchMemoryUsed");
+	return Header;
+}
+
+FString
+FHoudiniCookStats::ToCSVRow(const FString& InComponentName) const
+{
+	FString Row = FString::Printf(TEXT("%s,%s,%d,%f"),
+		*InComponentName, *StartTime.ToString(), bOutputsProcessed ? 1 : 0, GetTotalTime());
+
+	for (const double& PhaseTime : PhaseTimes)
+		Row += FString::Printf(TEXT(",%f"), PhaseTime);
+
+	// Input upload times are stored in a single column as Type=Time pairs
+	TArray<FString> InputTimes;
+	for (const auto& InputTime : InputUploadTimes)
+		InputTimes.Add(FString::Printf(TEXT("%s=%f"), *InputTime.Key, InputTime.Value));
+
+	Row += FString::Printf(TEXT(",%s,%lld,%lld,%lld,%lld"),
+		*FString::Join(InputTimes, TEXT(";")), BytesSent, BytesReceived, AttributeLookupRoundTrips, ScratchMemoryUsed);
+	return Row;
+}
+
+FHoudiniCookStats*
+FHoudiniCookStats::GetCurrent()
+{
+	return HoudiniCurrentCookStats;
+}
+
+void
+FHoudiniCookStats::AddBytesSent(const int64& InBytes)
+{
+	if (HoudiniCurrentCookStats)
+		FPlatformAtomics::InterlockedAdd(&HoudiniCurrentCookStats->BytesSent, InBytes);
+}
+
+void
+FHoudiniCookStats::AddBytesReceived(const int64& InBytes)
+{
+	if (HoudiniCurrentCookStats)
+		FPlatformAtomics::InterlockedAdd(&HoudiniCurrentCookStats->BytesReceived, InBytes);
+}
+
+void
+FHoudiniCookStats::AddAttributeLookupRoundTrips(const int32& InRoundTrips)
+{
+	if (HoudiniCurrentCookStats)
+		FPlatformAtomics::InterlockedAdd(&HoudiniCurrentCookStats->AttributeLookupRoundTrips, static_cast<int64>(InRoundTrips));
+}
+
+void
+FHoudiniCookStats::RecordScratchMemoryUsed(const int64& InBytes)
+{
+	if (!HoudiniCurrentCookStats)
+		return;
+
+	int64 PeakBytes = FPlatformAtomics::AtomicRead(&HoudiniCurrentCookStats->ScratchMemoryUsed);
+	while (InBytes > PeakBytes)
+	{
+		const int64 PreviousPeakBytes = FPlatformAtomics::InterlockedCompareExchange(&HoudiniCurrentCookStats->ScratchMemoryUsed, InBytes, PeakBytes);
+		if (PreviousPeakBytes == PeakBytes)
+			break;
+
+		PeakBytes = PreviousPeakBytes;
+	}
+}
+
+FHoudiniCookStatsHistory::FHoudiniCookStatsHistory(const int32& InCapacity)
+	: NextIndex(0)
+	, Capacity(FMath::Max(InCapacity, 1))
+{
+}
+
+void
+FHoudiniCookStatsHistory::Add(const FHoudiniCookStats& InStats)
+{
+	if (Entries.Num() < Capacity)
+		Entries.Add(InStats);
+	else
+		Entries[NextIndex] = InStats;
+
+	NextIndex = (NextIndex + 1) % Capacity;
+}
+
+const FHoudiniCookStats&
+FHoudiniCookStatsHistory::Get(const int32& InIndex) const
+{
+	check(Entries.IsValidIndex(InIndex));
+
+	// The most recent entry is right before NextIndex
+	const int32 EntryIndex = (NextIndex - 1 - InIndex + Entries.Num()) % Entries.Num();
+	return Entries[EntryIndex];
+}
+
+void
+FHoudiniCookStatsHistory::Empty()
+{
+	Entries.Empty();
+	NextIndex = 0;
+}
+
+FHoudiniCookStatsScope::FHoudiniCookStatsScope(FHoudiniCookStats* InStats)
+	: PreviousStats(HoudiniCurrentCookStats)
+{
+	HoudiniCurrentCookStats = InStats;
+}
+
+FHoudiniCookStatsScope::~FHoudiniCookStatsScope()
+{
+	HoudiniCurrentCookStats = PreviousStats;
+}
+
+FHoudiniCookStatsPhaseScope::FHoudiniCookStatsPhaseScope(const EHoudiniCookStatsPhase& InPhase, const FString& InInputType)
+	: Stats(HoudiniCurrentCookStats)
+	, Phase(InPhase)
+	, InputType(InInputType)
+	, StartTime(0.0)
+	, ParentScope(nullptr)
+{
+	if (!Stats)
+		return;
+
+	// Phase times are exclusive, pause the enclosing phase
+	ParentScope = HoudiniCurrentCookStatsPhaseScope;
+	if (ParentScope)
+		ParentScope->Pause();
+
+	HoudiniCurrentCookStatsPhaseScope = this;
+	Resume();
+}
+
+FHoudiniCookStatsPhaseScope::~FHoudiniCookStatsPhaseScope()
+{
+	if (!Stats)
+		return;
+
+	Pause();
+
+	HoudiniCurrentCookStatsPhaseScope = ParentScope;
+	if (ParentScope)
+		ParentScope->Resume();
+}
+
+void
+FHoudiniCookStatsPhaseScope::Pause()
+{
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+	Stats->AddPhaseTime(Phase, ElapsedTime);
+
+	if (!InputType.IsEmpty())
+		Stats->InputUploadTimes.FindOrAdd(InputType) += ElapsedTime;
+}
+
+void
+FHoudiniCookStatsPhaseScope::Resume()
+{
+	StartTime = FPlatformTime::Seconds();
+}
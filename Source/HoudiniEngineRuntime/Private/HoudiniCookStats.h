@@ -0,0 +1,167 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Phases of the processing of an HDA cook, from parameter upload to component update.
+enum class EHoudiniCookStatsPhase : uint8
+{
+	ParameterUpload,
+	InputUpload,
+	Cook,
+	OutputFetch,
+	MeshBuild,
+	ComponentUpdate,
+
+	Count
+};
+
+// Timing breakdown and amount of data transferred over the session for a single cook of a HAC.
+// Phase times are exclusive: the time spent in a nested phase is not counted in its parent phase.
+struct HOUDINIENGINERUNTIME_API FHoudiniCookStats
+{
+	FHoudiniCookStats();
+
+	// Returns the display name of a phase
+	static const TCHAR* GetPhaseName(const EHoudiniCookStatsPhase& InPhase);
+
+	// Returns the time (in seconds) spent in the given phase
+	double GetPhaseTime(const EHoudiniCookStatsPhase& InPhase) const { return PhaseTimes[static_cast<int32>(InPhase)]; };
+	// Adds time (in seconds) to the given phase
+	void AddPhaseTime(const EHoudiniCookStatsPhase& InPhase, const double& InTime) { PhaseTimes[static_cast<int32>(InPhase)] += InTime; };
+
+	// Returns the sum of all the phase times
+	double GetTotalTime() const;
+
+	// Returns the header line of the CSV export
+	static FString GetCSVHeader();
+	// Returns this cook's stats as a CSV line
+	FString ToCSVRow(const FString& InComponentName) const;
+
+	// Returns the stats being recorded on the calling thread, or null.
+	static FHoudiniCookStats* GetCurrent();
+
+	// Adds the size of data sent to/received from the session to the stats recorded on the calling thread, if any.
+	// The counters are updated atomically: worker threads transferring data for a cook record into the cook's stats
+	// by opening an FHoudiniCookStatsScope on it.
+	static void AddBytesSent(const int64& InBytes);
+	static void AddBytesReceived(const int64& InBytes);
+
+	// Adds to the number of HAPI round trips made to look up attributes by the calling thread, if recording stats.
+	static void AddAttributeLookupRoundTrips(const int32& InRoundTrips);
+
+	// Raises the peak scratch memory of the stats recorded on the calling thread, if any.
+	static void RecordScratchMemoryUsed(const int64& InBytes);
+
+	// Time at which the cook was started
+	FDateTime StartTime;
+
+	// Time spent in each phase, in seconds
+	double PhaseTimes[static_cast<int32>(EHoudiniCookStatsPhase::Count)];
+
+	// Input upload time, by input type
+	TMap<FString, double> InputUploadTimes;
+
+	// Size of the attribute data sent to and received from the session, in bytes
+	int64 BytesSent;
+	int64 BytesReceived;
+
+	// Number of HAPI round trips made to look up attributes (infos and names)
+	int64 AttributeLookupRoundTrips;
+
+	// Peak amount of scratch memory used by the output translators, in bytes
+	int64 ScratchMemoryUsed;
+
+	// Indicates that the cook's outputs were processed (false if the cook failed or was out of date)
+	bool bOutputsProcessed;
+};
+
+// Ring buffer keeping the stats of the last cooks of a HAC.
+class HOUDINIENGINERUNTIME_API FHoudiniCookStatsHistory
+{
+public:
+
+	FHoudiniCookStatsHistory(const int32& InCapacity = DefaultCapacity);
+
+	// Adds the stats of a cook, replacing the oldest ones if the history is full
+	void Add(const FHoudiniCookStats& InStats);
+
+	// Number of cooks in the history
+	int32 Num() const { return Entries.Num(); };
+
+	// Returns the stats of a cook, 0 being the most recent one
+	const FHoudiniCookStats& Get(const int32& InIndex) const;
+
+	void Empty();
+
+	static constexpr int32 DefaultCapacity = 32;
+
+private:
+
+	TArray<FHoudiniCookStats> Entries;
+
+	// Index at which the next stats will be stored
+	int32 NextIndex;
+
+	int32 Capacity;
+};
+
+// Sets the stats recorded by the calling thread for the lifetime of the scope.
+// Phase scopes must only be opened by the thread that owns the stats, their times are not updated atomically.
+struct HOUDINIENGINERUNTIME_API FHoudiniCookStatsScope
+{
+	FHoudiniCookStatsScope(FHoudiniCookStats* InStats);
+	~FHoudiniCookStatsScope();
+
+	private:
+
+		FHoudiniCookStats* PreviousStats;
+};
+
+// Adds the time spent in the scope to a phase of the stats recorded by the calling thread.
+// If InInputType is set, the time is also added to that input type's upload time.
+struct HOUDINIENGINERUNTIME_API FHoudiniCookStatsPhaseScope
+{
+	FHoudiniCookStatsPhaseScope(const EHoudiniCookStatsPhase& InPhase, const FString& InInputType = FString());
+	~FHoudiniCookStatsPhaseScope();
+
+	private:
+
+		// Adds the time elapsed since the scope was started/resumed to the stats
+		void Pause();
+		void Resume();
+
+		FHoudiniCookStats* Stats;
+		EHoudiniCookStatsPhase Phase;
+		FString InputType;
+		double StartTime;
+
+		// The enclosing phase scope, paused while this one is active
+		FHoudiniCookStatsPhaseScope* ParentScope;
+};
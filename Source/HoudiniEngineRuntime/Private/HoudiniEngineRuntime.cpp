@@ -40,6 +40,12 @@ DEFINE_LOG_CATEGORY(LogHoudiniEngineRuntime);
 FHoudiniEngineRuntime *
 FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 
+// Session used by the HAPI calls made on the current thread
+static thread_local int32 HoudiniCurrentSessionIndex = 0;
+
+// Indicates that the manager is processing a component on the current thread
+static thread_local bool bHoudiniProcessingComponents = false;
+
 
 FHoudiniEngineRuntime &
 FHoudiniEngineRuntime::Get()
@@ -172,20 +178,41 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 	{
 		FScopeLock ScopeLock(&CriticalSection);
 		RegisteredHoudiniComponents.Add(HAC);
+		HAC->bRegisteredInRuntime = true;
 	}
 
+	// Make sure the new component gets processed
+	MarkHoudiniComponentDirty(HAC);
+
 	HAC->NotifyHoudiniRegisterCompleted();
 }
 
 
 void 
-FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent)
+FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent, const int32& InSessionIndex)
 {
 	if (InNodeId >= 0) 
 	{
 		// FDebug::DumpStackTraceToLog();
 
-		NodeIdsPendingDelete.AddUnique(InNodeId);
+		const int32 SessionIndex = InSessionIndex >= 0 ? InSessionIndex : GetCurrentSessionIndex();
+
+		// Node ids are only unique within a session
+		bool bAlreadyPending = false;
+		for (int32 Idx = 0; Idx < NodeIdsPendingDelete.Num(); Idx++)
+		{
+			if (NodeIdsPendingDelete[Idx] == InNodeId && NodeIdsPendingDeleteSessionIndices[Idx] == SessionIndex)
+			{
+				bAlreadyPending = true;
+				break;
+			}
+		}
+
+		if (!bAlreadyPending)
+		{
+			NodeIdsPendingDelete.Add(InNodeId);
+			NodeIdsPendingDeleteSessionIndices.Add(SessionIndex);
+		}
 
 		if (bDeleteParent)
 		{
@@ -232,8 +259,11 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		UHoudiniAssetComponent* HAC = Ptr.Get();
 		if (HAC && HAC->CanDeleteHoudiniNodes())
 		{
-			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true);
+			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true, FMath::Max(HAC->GetSessionIndex(), 0));
 		}
+
+		if (HAC)
+			HAC->bRegisteredInRuntime = false;
 	}
 	
 	RegisteredHoudiniComponents.RemoveAt(ValidIndex);
@@ -278,6 +308,138 @@ FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 		return;
 
 	NodeIdsPendingDelete.RemoveAt(Index);
+	NodeIdsPendingDeleteSessionIndices.RemoveAt(Index);
+}
+
+
+int32
+FHoudiniEngineRuntime::GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index)
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!NodeIdsPendingDeleteSessionIndices.IsValidIndex(Index))
+		return 0;
+
+	return NodeIdsPendingDeleteSessionIndices[Index];
+}
+
+
+void
+FHoudiniEngineRuntime::MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC)
+{
+	if (!IsInitialized() || !HAC)
+		return;
+
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+	FScopeLock ScopeLock(&Runtime.CriticalSection);
+	Runtime.DirtyHoudiniComponents.Add(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(const UObject* InObject)
+{
+	UHoudiniAssetComponent* HAC = FindOwnerHoudiniComponent(InObject);
+	if (!HAC)
+		return;
+
+	// The values used by a cook in progress are now out of date.
+	// Changes made by the manager while processing components don't come from the user, ignore them.
+	if (!bHoudiniProcessingComponents)
+		HAC->MarkCookInputsChanged();
+	MarkHoudiniComponentDirty(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::DequeueDirtyHoudiniComponents(TArray<UHoudiniAssetComponent*>& OutComponents)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	OutComponents.Reserve(OutComponents.Num() + DirtyHoudiniComponents.Num());
+	for (const TWeakObjectPtr<UHoudiniAssetComponent>& Ptr : DirtyHoudiniComponents)
+	{
+		// Only registered components are processed
+		UHoudiniAssetComponent* HAC = Ptr.Get();
+		if (IsValid(HAC) && HAC->IsRegisteredInRuntime())
+			OutComponents.Add(HAC);
+	}
+
+	DirtyHoudiniComponents.Reset();
+}
+
+
+int32
+FHoudiniEngineRuntime::GetDirtyHoudiniComponentCount()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return DirtyHoudiniComponents.Num();
+}
+
+
+int32
+FHoudiniEngineRuntime::GetCurrentSessionIndex()
+{
+	return HoudiniCurrentSessionIndex;
+}
+
+
+void
+FHoudiniEngineRuntime::SetCurrentSessionIndex(const int32& InSessionIndex)
+{
+	HoudiniCurrentSessionIndex = FMath::Max(InSessionIndex, 0);
+}
+
+
+bool
+FHoudiniEngineRuntime::IsProcessingHoudiniComponents()
+{
+	return bHoudiniProcessingComponents;
+}
+
+
+void
+FHoudiniEngineRuntime::SetProcessingHoudiniComponents(const bool bInProcessing)
+{
+	bHoudiniProcessingComponents = bInProcessing;
+}
+
+
+int32
+FHoudiniEngineRuntime::GetSessionIndexForObject(const UObject* InObject)
+{
+	const UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(InObject);
+	if (!HAC)
+		HAC = FindOwnerHoudiniComponent(InObject);
+
+	// Components that haven't been assigned a session yet use the main session
+	if (HAC)
+		return FMath::Max(HAC->GetSessionIndex(), 0);
+
+	return GetCurrentSessionIndex();
+}
+
+
+UHoudiniAssetComponent*
+FHoudiniEngineRuntime::FindOwnerHoudiniComponent(const UObject* InObject)
+{
+	if (!InObject)
+		return nullptr;
+
+	// Parameters, inputs and input objects are outered to their component
+	UHoudiniAssetComponent* HAC = InObject->GetTypedOuter<UHoudiniAssetComponent>();
+	if (!HAC)
+	{
+		// Curves are attached to their component
+		const USceneComponent* SceneComponent = Cast<USceneComponent>(InObject);
+		if (SceneComponent)
+			HAC = Cast<UHoudiniAssetComponent>(SceneComponent->GetAttachParent());
+	}
+
+	return HAC;
 }
 
 
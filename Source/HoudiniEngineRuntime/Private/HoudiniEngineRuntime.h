@@ -68,20 +68,53 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		UHoudiniAssetComponent* GetRegisteredHoudiniComponentAt(const int32& Index);
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
+
+		//
+		// Houdini Asset Component ready queue
+		//
+		// Components queue themselves when their state, parameters, inputs or transform change,
+		// so the manager only has to look at those instead of scanning every registered component.
+		static void MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC);
+		// Queues the component that owns the given parameter, input, input object or curve,
+		// and flags its current cook as out of date unless the change is made while processing components
+		static void MarkOwnerHoudiniComponentDirty(const UObject* InObject);
+
+		// Set by the manager on its thread while it processes components, so changes it makes
+		// to parameters and inputs aren't mistaken for user changes
+		static bool IsProcessingHoudiniComponents();
+		static void SetProcessingHoudiniComponents(const bool bInProcessing);
+
+		// Moves the queued components to OutComponents and empties the queue
+		void DequeueDirtyHoudiniComponents(TArray<UHoudiniAssetComponent*>& OutComponents);
+		int32 GetDirtyHoudiniComponentCount();
 		
 		//
 		// Node deletion
 		//
-		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false);
+		// If InSessionIndex is INDEX_NONE, the node is assumed to belong to the calling thread's current session.
+		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false, const int32& InSessionIndex = INDEX_NONE);
 
 		int32 GetNodeIdsPendingDeleteCount();
 		int32 GetNodeIdsPendingDeleteAt(const int32& Index);
+		// Returns the index of the session that owns the pending delete node at the given index
+		int32 GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index);
 		void RemoveNodeIdPendingDeleteAt(const int32& Index);
 
 		bool IsParentNodePendingDelete(const int32& NodeId);
 
 		void RemoveParentNodePendingDelete(const int32& NodeId);
 
+		//
+		// Session pool
+		//
+		// Index of the Houdini Engine session used by HAPI calls made on the calling thread.
+		// 0 is the main session, higher indices refer to the sessions of the session pool.
+		static int32 GetCurrentSessionIndex();
+		static void SetCurrentSessionIndex(const int32& InSessionIndex);
+		// Index of the session owning the nodes of the given HAC, or of the parameter, input,
+		// input object or curve's owner HAC. Falls back to the calling thread's current session.
+		static int32 GetSessionIndexForObject(const UObject* InObject);
+
 		//
 		//
 		//
@@ -98,6 +131,9 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 
 	private:
 
+		// Returns the HAC that owns the given parameter, input, input object or curve
+		static UHoudiniAssetComponent* FindOwnerHoudiniComponent(const UObject* InObject);
+
 		// Synchronization primitive. 
 		FCriticalSection CriticalSection;
 
@@ -107,8 +143,14 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		// 
 		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponents;
 
+		// Components waiting to be processed by the manager
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> DirtyHoudiniComponents;
+
 		TArray<int32> NodeIdsPendingDelete;
 
+		// Session index for each node in NodeIdsPendingDelete
+		TArray<int32> NodeIdsPendingDeleteSessionIndices;
+
 		TArray<int32> NodeIdsParentPendingDelete;
 
 		FOnToolOrPackageChanged OnToolOrPackageChanged;
@@ -207,7 +207,7 @@ void UHoudiniInput::PostEditUndo()
 			 			continue;
 			 		
 			 		if (bCanDeleteHoudiniNodes)
-			 			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true);
+			 			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 			 	}
 
 			 	CreatedDataNodeIds.Empty();
@@ -1418,7 +1418,7 @@ void UHoudiniInput::InvalidateData()
 			if (bIsRefCountedInputSystemEnabled && ManagedNodeIds.Contains(NodeId))
 				continue;
 			
-			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true);
+			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 		}
 	}
 	
@@ -2323,6 +2323,17 @@ UHoudiniInput::IsDataUploadNeeded()
 	return HasChanged();
 }
 
+void
+UHoudiniInput::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	// Queue our component so it picks up the change
+	if (bInChanged)
+		FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(this);
+}
+
 // Indicates if this input has changed and should be updated
 bool 
 UHoudiniInput::HasChanged()
@@ -264,11 +264,7 @@ public:
 	// Mutators
 	//------------------------------------------------------------------------------------------------
 
-	void MarkChanged(const bool& bInChanged)
-	{
-		bHasChanged = bInChanged;
-		SetNeedsToTriggerUpdate(bInChanged);
-	};
+	void MarkChanged(const bool& bInChanged);
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
 	void MarkAllInputObjectsChanged(const bool& bInChanged);
@@ -797,6 +797,9 @@ UHoudiniInputObject::MarkChanged(const bool& bInChanged)
 	bHasChanged = bInChanged;
 	SetNeedsToTriggerUpdate(bInChanged);
 
+	if (bInChanged)
+		FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(this);
+
 	if (bInChanged && InputNodeHandle.IsValid())
 	{
 		static constexpr bool bAlsoDirtyReferencedNodes = true;
@@ -810,6 +813,9 @@ UHoudiniInputActor::MarkChanged(const bool& bInChanged)
 	bHasChanged = bInChanged;
 	SetNeedsToTriggerUpdate(bInChanged);
 
+	if (bInChanged)
+		FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(this);
+
 	static constexpr bool bAlsoDirtyReferencedNodes = true;
 	if (bInChanged && InputNodeHandle.IsValid())
 		FUnrealObjectInputRuntimeUtils::MarkInputNodeAsDirty(InputNodeHandle.GetIdentifier(), bAlsoDirtyReferencedNodes);
@@ -1422,14 +1428,14 @@ UHoudiniInputObject::InvalidateData()
 	
 	if (InputNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 		InputNodeId = -1;
 	}
 
 	// ... and the parent OBJ as well to clean up
 	if (InputObjectNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId, false, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 		InputObjectNodeId = -1;
 	}
 
@@ -2454,14 +2460,14 @@ UHoudiniInputActor::InvalidateSplinesMeshData()
 		
 		if (SplinesMeshNodeId >= 0)
 		{
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SplinesMeshNodeId);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SplinesMeshNodeId, false, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 			SplinesMeshNodeId = -1;
 		}
 
 		// ... and the parent OBJ as well to clean up
 		if (SplinesMeshObjectNodeId >= 0)
 		{
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SplinesMeshObjectNodeId);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SplinesMeshObjectNodeId, false, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 			SplinesMeshObjectNodeId = -1;
 		}
 	}
@@ -25,6 +25,7 @@
 */
 
 #include "HoudiniParameter.h"
+#include "HoudiniEngineRuntime.h"
 
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -94,6 +95,17 @@ UHoudiniParameter::RevertToDefault(const int32& InAtTupleIndex)
 	MarkChanged(true);	
 }
 
+void
+UHoudiniParameter::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	// Queue our component so it picks up the change
+	if (bInChanged)
+		FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(this);
+}
+
 void
 UHoudiniParameter::MarkDefault(const bool& bInDefault)
 {
@@ -81,6 +81,9 @@ enum EHoudiniPluginSerializationVersion
 	// from UHoudiniInput to a member FHoudiniInputObjectSettings struct: UHoudiniInput::InputSettings
 	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_INPUT_OBJECT_SETTINGS_STRUCT = 101,
 
+	// UHoudiniStaticMesh saves its mesh data in a compact format: quantized attributes, compressed in chunks
+	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_COMPACT_STATIC_MESH = 102,
+
     // -----<new versions can be added before this line>-------------------------------------------------
     // - this needs to be the last line (see note below)
     VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE_PLUS_ONE,
@@ -63,6 +63,10 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
 	bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
 	AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+	bEnableSessionPool = false;
+	SessionPoolSize = 4;
+	bWarmUpSessionOnEditorStart = false;
+	bWarmUpLevelHoudiniAssets = true;
 
 	bSyncWithHoudiniCook = true;
 	bCookUsingHoudiniTime = true;
@@ -73,6 +77,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	// Instantiating options.
 	bShowMultiAssetDialog = true;
 	bPreferHdaMemoryCopyOverHdaSourceFile = false;
+	bMemoryMapLargeHdas = false;
+	MemoryMapHdaSizeThreshold = 64;
 
 	// Cooking options.
 	bPauseCookingOnStart = false;
@@ -107,8 +113,13 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = true;
+	bAsyncStaticMeshBuild = true;
+	MeshStreamingTriangleThreshold = 10000000;
+	MeshStreamingMemoryCeilingMB = 256;
 	bShowDefaultMesh = true;
 	bPreferNaniteFallbackMesh = false;
+	bWeldProxyStaticMeshVertices = true;
+	bQuantizeProxyStaticMeshPositions = false;
 
 	bEnableProxyStaticMeshRefinementByTimer = false;
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
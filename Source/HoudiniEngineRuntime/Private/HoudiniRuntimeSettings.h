@@ -35,6 +35,7 @@
 #include "HoudiniRuntimeSettings.generated.h"
 
 class UFoliageType_InstancedStaticMesh;
+class UHoudiniAsset;
 
 UENUM()
 enum EHoudiniRuntimeSettingsSessionType
@@ -197,6 +198,31 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		float AutomaticServerTimeout;
 
+		// EXPERIMENTAL: If enabled, additional Houdini Engine sessions (HARS processes) are started alongside the main session.
+		// Each Houdini Asset is assigned to one of the sessions, allowing multiple HDAs to be instantiated and cooked in parallel.
+		// Only used with named pipe or socket sessions started automatically, and ignored when using Session Sync.
+		// PDG assets are always instantiated in the main session.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, Experimental)
+		bool bEnableSessionPool;
+
+		// Total number of Houdini Engine sessions (including the main session) used when the session pool is enabled.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (ClampMin = "1", ClampMax = "32", UIMin = "1", UIMax = "16", EditCondition = "bEnableSessionPool"))
+		int32 SessionPoolSize;
+
+		// If enabled, the Houdini Engine session is started in the background when the editor starts,
+		// instead of when the first Houdini Asset is instantiated or cooked.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
+		bool bWarmUpSessionOnEditorStart;
+
+		// Houdini Assets whose libraries are loaded in the session(s) once the warm up session is started.
+		// They are loaded in this order: list the HDAs used by other HDAs first.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (EditCondition = "bWarmUpSessionOnEditorStart"))
+		TArray<TSoftObjectPtr<UHoudiniAsset>> WarmUpHoudiniAssets;
+
+		// If enabled, the libraries of the Houdini Assets used in the current level are also loaded once the warm up session is started.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (EditCondition = "bWarmUpSessionOnEditorStart"))
+		bool bWarmUpLevelHoudiniAssets;
+
 		// If enabled, changes made in Houdini, when connected to Houdini running in Session Sync mode will be automatically be pushed to Unreal.
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
 		bool bSyncWithHoudiniCook;
@@ -233,6 +259,15 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Instantiating)
 		bool bPreferHdaMemoryCopyOverHdaSourceFile;
 
+		// When enabled, the memory copy of large HDAs is not kept in memory after the Houdini Asset is loaded.
+		// It is written once to the project's Saved/HoudiniEngine/HDACache folder, and memory-mapped from there instead.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Instantiating)
+		bool bMemoryMapLargeHdas;
+
+		// Size (in MB) from which the memory copy of an HDA is memory-mapped instead of kept in memory.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Instantiating, meta = (ClampMin = "1", UIMin = "1", UIMax = "1024", EditCondition = "bMemoryMapLargeHdas"))
+		int32 MemoryMapHdaSizeThreshold;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Cooking options.
 		//-------------------------------------------------------------------------------------------------------------
@@ -319,6 +354,20 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Static Mesh", meta = (DisplayName = "Enable Proxy Static Mesh"))
 		bool bEnableProxyStaticMesh;
 
+		// For StaticMesh outputs: build the static meshes asynchronously after a cook (if the editor allows asynchronous
+		// static mesh compilation). Proxy meshes stay visible until the static meshes that replace them are ready.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Build Static Meshes Asynchronously"))
+		bool bAsyncStaticMeshBuild;
+
+		// For proxy static meshes: mesh parts with at least this many triangles are streamed. Their geometry is fetched
+		// and converted one range of primitives at a time instead of all at once, to bound the memory used. 0 disables streaming.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Stream Mesh Parts Above Triangle Count", ClampMin = "0", EditCondition = "bEnableProxyStaticMesh"))
+		int32 MeshStreamingTriangleThreshold;
+
+		// Memory ceiling, in megabytes, for the attribute data of a range of primitives of a streamed mesh part.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Mesh Streaming Memory Ceiling (MB)", ClampMin = "16", EditCondition = "bEnableProxyStaticMesh && MeshStreamingTriangleThreshold > 0"))
+		int32 MeshStreamingMemoryCeilingMB;
+
 		// For static mesh outputs and socket actors: should spawn a default actor if the reference is invalid?
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Static Mesh", meta = (DisplayName = "Show Default Mesh"))
 		bool bShowDefaultMesh;
@@ -327,6 +376,16 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Static Mesh", meta = (DisplayName = "Prefer Nanite Fallback Mesh"))
 		bool bPreferNaniteFallbackMesh;
 
+		// For proxy static meshes: weld identical vertices and optimize the triangle order for the vertex cache before rendering.
+		// Streamed parts (see MeshStreamingTriangleThreshold) are never welded.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Weld Proxy Static Mesh Vertices", EditCondition = "bEnableProxyStaticMesh"))
+		bool bWeldProxyStaticMeshVertices;
+
+		// For proxy static meshes: quantize positions on 16 bits per axis against the mesh bounds when saving. Reduces the
+		// size of levels that keep proxy meshes, at the cost of precision on very large meshes.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Quantize Saved Proxy Static Mesh Positions", EditCondition = "bEnableProxyStaticMesh"))
+		bool bQuantizeProxyStaticMeshPositions;
+
 		// If fast proxy meshes are being created, must it be baked as a StaticMesh after a period of no updates?
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes After a Timeout", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementByTimer;
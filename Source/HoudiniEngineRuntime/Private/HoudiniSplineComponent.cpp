@@ -545,13 +545,16 @@ void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 {
 	bHasChanged = Changed;
 	bNeedsToTriggerUpdate = Changed;
+
+	if (Changed)
+		FHoudiniEngineRuntime::MarkOwnerHoudiniComponentDirty(this);
 }
 
 void UHoudiniSplineComponent::MarkInputNodesAsPendingKill()
 {
 	// InputObject->MarkPendingKill();
 	if(NodeId > -1)
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NodeId, false, FHoudiniEngineRuntime::GetSessionIndexForObject(this));
 
 	SetNodeId(-1); // Set nodeId to invalid for reconstruct on re-do
 }
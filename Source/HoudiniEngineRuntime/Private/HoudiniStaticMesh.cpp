@@ -27,8 +27,16 @@
 #include "HoudiniStaticMesh.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
+#include "HoudiniBoundsUtils.h"
+#include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniRuntimeSettings.h"
+
 #include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Math/Float16.h"
 #include "MeshUtilitiesCommon.h"
+#include "Misc/Compression.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -38,6 +46,8 @@ UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializ
 	bHasColors = false;
 	NumUVLayers = 0;
 	bHasPerFaceMaterials = false;
+	bWeldVertices = false;
+	NumWeldedVertices = 0;
 }
 
 void 
@@ -51,6 +61,8 @@ UHoudiniStaticMesh::Initialize(
 	bool bInHasColors,
 	bool bInHasPerFaceMaterials)
 {
+	ClearWeldedVertices();
+
 	// Initialize the vertex positions and triangle indices arrays
 	VertexPositions.SetNumUninitialized(InNumVertices);
 	for(int32 n = 0; n < VertexPositions.Num(); n++)
@@ -411,6 +423,306 @@ void UHoudiniStaticMesh::Optimize()
 	VertexInstanceUVs.Shrink();
 	MaterialIDsPerTriangle.Shrink();
 	StaticMaterials.Shrink();
+
+	// The mesh data may have changed: the welded vertices are rebuilt when the next proxy is created
+	ClearWeldedVertices();
+}
+
+// Linear-speed vertex cache optimization, see Tom Forsyth, "Linear-Speed Vertex Cache Optimisation".
+// Greedily emits the triangle with the best score, where the score of a triangle is the sum of the scores of its
+// vertices: vertices that are in the (simulated LRU) cache and vertices with few remaining triangles score higher.
+static void
+OptimizeTriangleOrderForVertexCache(const TArray<uint32>& InIndices, const uint32 InNumVertices, TArray<uint32>& OutTriangleOrder)
+{
+	const int32 CacheSize = 32;
+	const int32 NumTriangles = InIndices.Num() / 3;
+
+	OutTriangleOrder.Reset(NumTriangles);
+	if (NumTriangles == 0)
+		return;
+
+	// Scores for the cache position and the number of remaining triangles of a vertex
+	float CachePositionScores[CacheSize];
+	for (int32 CachePosition = 0; CachePosition < CacheSize; ++CachePosition)
+	{
+		// The last triangle's vertices get a fixed score, so that the same triangle strip is not favored
+		CachePositionScores[CachePosition] = CachePosition < 3
+			? 0.75f
+			: FMath::Pow(1.0f - (CachePosition - 3) / (float)(CacheSize - 3), 1.5f);
+	}
+
+	auto GetVertexScore = [&CachePositionScores](const int32 InCachePosition, const int32 InNumActiveTriangles)
+	{
+		// Vertices without remaining triangles are not candidates anymore
+		if (InNumActiveTriangles <= 0)
+			return -1.0f;
+
+		const float Score = InCachePosition >= 0 ? CachePositionScores[InCachePosition] : 0.0f;
+		return Score + 2.0f * FMath::InvSqrt((float)InNumActiveTriangles);
+	};
+
+	// Build the vertex to triangle adjacency. The first NumActiveTriangles[Vertex] entries of a vertex's
+	// adjacency are the triangles that have not been emitted yet.
+	TArray<int32> NumActiveTriangles;
+	NumActiveTriangles.SetNumZeroed(InNumVertices);
+	for (const uint32 VertexIndex : InIndices)
+		NumActiveTriangles[VertexIndex]++;
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.SetNumUninitialized(InNumVertices + 1);
+	AdjacencyOffsets[0] = 0;
+	for (uint32 VertexIndex = 0; VertexIndex < InNumVertices; ++VertexIndex)
+		AdjacencyOffsets[VertexIndex + 1] = AdjacencyOffsets[VertexIndex] + NumActiveTriangles[VertexIndex];
+
+	TArray<int32> Adjacency;
+	Adjacency.SetNumUninitialized(InIndices.Num());
+	{
+		TArray<int32> Cursors(AdjacencyOffsets.GetData(), InNumVertices);
+		for (int32 Index = 0; Index < InIndices.Num(); ++Index)
+			Adjacency[Cursors[InIndices[Index]]++] = Index / 3;
+	}
+
+	TArray<int32> CachePositions;
+	CachePositions.Init(INDEX_NONE, InNumVertices);
+
+	TArray<float> VertexScores;
+	VertexScores.SetNumUninitialized(InNumVertices);
+	for (uint32 VertexIndex = 0; VertexIndex < InNumVertices; ++VertexIndex)
+		VertexScores[VertexIndex] = GetVertexScore(INDEX_NONE, NumActiveTriangles[VertexIndex]);
+
+	TBitArray<> TriangleEmitted(false, NumTriangles);
+
+	// The cache can temporarily hold 3 more entries, which are evicted after each triangle
+	int32 Cache[CacheSize + 3];
+	int32 CacheCount = 0;
+
+	int32 BestTriangle = INDEX_NONE;
+	int32 ScanCursor = 0;
+	while (OutTriangleOrder.Num() < NumTriangles)
+	{
+		if (BestTriangle == INDEX_NONE)
+		{
+			// No candidate around the cache: continue with the next triangle that hasn't been emitted yet
+			while (ScanCursor < NumTriangles && TriangleEmitted[ScanCursor])
+				ScanCursor++;
+
+			if (ScanCursor >= NumTriangles)
+				break;
+
+			BestTriangle = ScanCursor;
+		}
+
+		TriangleEmitted[BestTriangle] = true;
+		OutTriangleOrder.Add(BestTriangle);
+
+		// The triangle's vertices move to the front of the cache
+		int32 NewCache[CacheSize + 3];
+		int32 NewCacheCount = 0;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const int32 VertexIndex = InIndices[BestTriangle * 3 + Corner];
+
+			// Remove the triangle from the vertex's active triangles
+			int32* ActiveTriangles = &Adjacency[AdjacencyOffsets[VertexIndex]];
+			const int32 LastActive = --NumActiveTriangles[VertexIndex];
+			for (int32 ActiveIdx = 0; ActiveIdx <= LastActive; ++ActiveIdx)
+			{
+				if (ActiveTriangles[ActiveIdx] == BestTriangle)
+				{
+					Swap(ActiveTriangles[ActiveIdx], ActiveTriangles[LastActive]);
+					break;
+				}
+			}
+
+			bool bAlreadyInCache = false;
+			for (int32 CacheIdx = 0; CacheIdx < NewCacheCount; ++CacheIdx)
+				bAlreadyInCache |= NewCache[CacheIdx] == VertexIndex;
+
+			if (!bAlreadyInCache)
+				NewCache[NewCacheCount++] = VertexIndex;
+		}
+
+		const int32 NumTriangleVertices = NewCacheCount;
+		for (int32 CacheIdx = 0; CacheIdx < CacheCount; ++CacheIdx)
+		{
+			const int32 VertexIndex = Cache[CacheIdx];
+			bool bIsTriangleVertex = false;
+			for (int32 TriVertIdx = 0; TriVertIdx < NumTriangleVertices; ++TriVertIdx)
+				bIsTriangleVertex |= NewCache[TriVertIdx] == VertexIndex;
+
+			if (!bIsTriangleVertex)
+				NewCache[NewCacheCount++] = VertexIndex;
+		}
+
+		// Update the scores of the vertices in the cache and of the evicted vertices
+		for (int32 CacheIdx = 0; CacheIdx < NewCacheCount; ++CacheIdx)
+		{
+			const int32 VertexIndex = NewCache[CacheIdx];
+			CachePositions[VertexIndex] = CacheIdx < CacheSize ? CacheIdx : INDEX_NONE;
+			VertexScores[VertexIndex] = GetVertexScore(CachePositions[VertexIndex], NumActiveTriangles[VertexIndex]);
+		}
+
+		// The next triangle is the best scoring active triangle of the touched vertices
+		BestTriangle = INDEX_NONE;
+		float BestScore = -1.0f;
+		for (int32 CacheIdx = 0; CacheIdx < NewCacheCount; ++CacheIdx)
+		{
+			const int32 VertexIndex = NewCache[CacheIdx];
+			const int32* ActiveTriangles = &Adjacency[AdjacencyOffsets[VertexIndex]];
+			for (int32 ActiveIdx = 0; ActiveIdx < NumActiveTriangles[VertexIndex]; ++ActiveIdx)
+			{
+				const int32 TriangleIndex = ActiveTriangles[ActiveIdx];
+				const float Score =
+					VertexScores[InIndices[TriangleIndex * 3 + 0]]
+					+ VertexScores[InIndices[TriangleIndex * 3 + 1]]
+					+ VertexScores[InIndices[TriangleIndex * 3 + 2]];
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestTriangle = TriangleIndex;
+				}
+			}
+		}
+
+		CacheCount = FMath::Min(NewCacheCount, CacheSize);
+		FMemory::Memcpy(Cache, NewCache, CacheCount * sizeof(int32));
+	}
+}
+
+void
+UHoudiniStaticMesh::BuildWeldedVertices(bool bInOptimizeVertexCache)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UHoudiniStaticMesh::BuildWeldedVertices"));
+
+	ClearWeldedVertices();
+
+	if (!IsValid(true))
+		return;
+
+	const int32 NumVertexInstances = GetNumVertexInstances();
+	const int32 NumVertices = GetNumVertices();
+	const bool bUseColors = VertexInstanceColors.Num() == NumVertexInstances;
+	const bool bUseNormals = VertexInstanceNormals.Num() == NumVertexInstances;
+	const bool bUseUTangents = VertexInstanceUTangents.Num() == NumVertexInstances;
+	const bool bUseVTangents = VertexInstanceVTangents.Num() == NumVertexInstances;
+
+	auto GetVertexIndex = [this](const int32 InVertexInstanceIndex)
+	{
+		return TriangleIndices[InVertexInstanceIndex / 3][InVertexInstanceIndex % 3];
+	};
+
+	// Hash the full attributes of each vertex instance. Attributes are compared bitwise, so that
+	// welding never changes what is rendered.
+	TArray<uint32> InstanceHashes;
+	InstanceHashes.SetNumUninitialized(NumVertexInstances);
+	ParallelFor(NumVertexInstances, [&](int32 InstanceIdx)
+	{
+		const int32 VertexIndex = GetVertexIndex(InstanceIdx);
+		uint32 Hash = FCrc::MemCrc32(&VertexIndex, sizeof(VertexIndex));
+		if (bUseColors)
+			Hash = FCrc::MemCrc32(&VertexInstanceColors[InstanceIdx], sizeof(FColor), Hash);
+		if (bUseNormals)
+			Hash = FCrc::MemCrc32(&VertexInstanceNormals[InstanceIdx], sizeof(FVector3f), Hash);
+		if (bUseUTangents)
+			Hash = FCrc::MemCrc32(&VertexInstanceUTangents[InstanceIdx], sizeof(FVector3f), Hash);
+		if (bUseVTangents)
+			Hash = FCrc::MemCrc32(&VertexInstanceVTangents[InstanceIdx], sizeof(FVector3f), Hash);
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+			Hash = FCrc::MemCrc32(&VertexInstanceUVs[UVLayerIdx * NumVertexInstances + InstanceIdx], sizeof(FVector2f), Hash);
+		InstanceHashes[InstanceIdx] = Hash;
+	});
+
+	auto AreVertexInstancesEqual = [&](const int32 InA, const int32 InB)
+	{
+		if (InstanceHashes[InA] != InstanceHashes[InB] || GetVertexIndex(InA) != GetVertexIndex(InB))
+			return false;
+		if (bUseColors && VertexInstanceColors[InA] != VertexInstanceColors[InB])
+			return false;
+		if (bUseNormals && FMemory::Memcmp(&VertexInstanceNormals[InA], &VertexInstanceNormals[InB], sizeof(FVector3f)) != 0)
+			return false;
+		if (bUseUTangents && FMemory::Memcmp(&VertexInstanceUTangents[InA], &VertexInstanceUTangents[InB], sizeof(FVector3f)) != 0)
+			return false;
+		if (bUseVTangents && FMemory::Memcmp(&VertexInstanceVTangents[InA], &VertexInstanceVTangents[InB], sizeof(FVector3f)) != 0)
+			return false;
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+		{
+			const int32 LayerOffset = UVLayerIdx * NumVertexInstances;
+			if (FMemory::Memcmp(&VertexInstanceUVs[LayerOffset + InA], &VertexInstanceUVs[LayerOffset + InB], sizeof(FVector2f)) != 0)
+				return false;
+		}
+		return true;
+	};
+
+	// Weld with an open addressing hash table of welded vertex indices. Welded vertices are numbered in order
+	// of first use, so the result does not depend on the number of threads.
+	const uint32 TableSize = FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(NumVertexInstances * 2, 2));
+	const uint32 TableMask = TableSize - 1;
+	TArray<int32> Table;
+	Table.Init(INDEX_NONE, TableSize);
+
+	// The first vertex instance of each welded vertex, only needed to compare attributes while welding
+	TArray<uint32> SourceInstances;
+	SourceInstances.Reserve(FMath::Min(NumVertexInstances, NumVertices * 2));
+	WeldedVertexIndices.SetNumUninitialized(NumVertexInstances);
+	for (int32 InstanceIdx = 0; InstanceIdx < NumVertexInstances; ++InstanceIdx)
+	{
+		uint32 Slot = InstanceHashes[InstanceIdx] & TableMask;
+		while (true)
+		{
+			const int32 WeldedIdx = Table[Slot];
+			if (WeldedIdx == INDEX_NONE)
+			{
+				Table[Slot] = SourceInstances.Add(InstanceIdx);
+				WeldedVertexIndices[InstanceIdx] = Table[Slot];
+				break;
+			}
+
+			if (AreVertexInstancesEqual(SourceInstances[WeldedIdx], InstanceIdx))
+			{
+				WeldedVertexIndices[InstanceIdx] = WeldedIdx;
+				break;
+			}
+
+			Slot = (Slot + 1) & TableMask;
+		}
+	}
+	NumWeldedVertices = SourceInstances.Num();
+
+	if (bInOptimizeVertexCache)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UHoudiniStaticMesh::BuildWeldedVertices - OptimizeVertexCache"));
+		OptimizeTriangleOrderForVertexCache(WeldedVertexIndices, NumWeldedVertices, WeldedTriangleOrder);
+	}
+	else
+	{
+		WeldedTriangleOrder.SetNumUninitialized(GetNumTriangles());
+		for (int32 TriangleIdx = 0; TriangleIdx < WeldedTriangleOrder.Num(); ++TriangleIdx)
+			WeldedTriangleOrder[TriangleIdx] = TriangleIdx;
+	}
+
+	// Size of a render vertex in the proxy: position, packed tangents, half precision UVs and color
+	const int64 RenderVertexSize = sizeof(FVector3f) + 2 * sizeof(uint32) + FMath::Max<uint32>(NumUVLayers, 1) * 2 * sizeof(uint16) + sizeof(FColor);
+	const int64 BytesSaved = (int64)(NumVertexInstances - NumWeldedVertices) * RenderVertexSize;
+	HOUDINI_LOG_MESSAGE(
+		TEXT("[UHoudiniStaticMesh::BuildWeldedVertices]: %s: welded %d vertex instances into %d vertices, saving %.2f MB of render vertex data."),
+		*GetName(), NumVertexInstances, NumWeldedVertices, BytesSaved / (1024.0 * 1024.0));
+}
+
+void
+UHoudiniStaticMesh::ClearWeldedVertices()
+{
+	NumWeldedVertices = 0;
+	WeldedVertexIndices.Empty();
+	WeldedTriangleOrder.Empty();
+}
+
+bool
+UHoudiniStaticMesh::EnsureWeldedVertices()
+{
+	if (bWeldVertices && !HasWeldedVertices())
+		BuildWeldedVertices();
+
+	return HasWeldedVertices();
 }
 
 FBox UHoudiniStaticMesh::CalcBounds() const
@@ -420,17 +732,7 @@ FBox UHoudiniStaticMesh::CalcBounds() const
 	if (NumVertices == 0)
 		return FBox();
 
-	const FVector3f InitPosition = VertexPositions[0];
-	double MinX = InitPosition.X, MaxX = InitPosition.X, MinY = InitPosition.Y, MaxY = InitPosition.Y, MinZ = InitPosition.Z, MaxZ = InitPosition.Z;
-	for (uint32 VertIdx = 0; VertIdx < NumVertices; ++VertIdx)
-	{
-		const FVector3f Position = VertexPositions[VertIdx];
-		if (Position.X < MinX) MinX = Position.X; else if (Position.X > MaxX) MaxX = Position.X;
-		if (Position.Y < MinY) MinY = Position.Y; else if (Position.Y > MaxY) MaxY = Position.Y;
-		if (Position.Z < MinZ) MinZ = Position.Z; else if (Position.Z > MaxZ) MaxZ = Position.Z;
-	}
-
-	return FBox(FVector(MinX, MinY, MinZ), FVector(MaxX, MaxY, MaxZ));
+	return FHoudiniBoundsUtils::CalcBox(VertexPositions.GetData(), VertexPositions.Num());
 }
 
 UMaterialInterface* UHoudiniStaticMesh::GetMaterial(int32 InMaterialIndex)
@@ -498,6 +800,47 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 {
 	Super::Serialize(InArchive);
 
+	InArchive.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
+	// Undo/redo reloads the mesh data in place, the welded vertices no longer match it
+	if (InArchive.IsLoading())
+		ClearWeldedVertices();
+
+	if (InArchive.IsLoading() && InArchive.CustomVer(FHoudiniCustomSerializationVersion::GUID) < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_COMPACT_STATIC_MESH)
+	{
+		SerializeRaw(InArchive);
+		return;
+	}
+
+	// The compact format is lossy: only use it for data that is written to disk, so that undo/redo and duplication
+	// don't degrade the mesh
+	bool bCompact = InArchive.IsPersistent() && !InArchive.IsTransacting();
+	if (bCompact && InArchive.IsSaving() && !CanSerializeCompact())
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("[UHoudiniStaticMesh::Serialize]: The mesh data of %s is too large for the compact format, saving it uncompressed."),
+			*GetName());
+		bCompact = false;
+	}
+	InArchive << bCompact;
+
+	if (bCompact)
+	{
+		bool bQuantizePositions = false;
+		if (InArchive.IsSaving())
+		{
+			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+			bQuantizePositions = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bQuantizeProxyStaticMeshPositions : false;
+		}
+		SerializeCompact(InArchive, bQuantizePositions);
+	}
+	else
+	{
+		SerializeRaw(InArchive);
+	}
+}
+
+void UHoudiniStaticMesh::SerializeRaw(FArchive &InArchive)
+{
 	VertexPositions.Shrink();
 	VertexPositions.BulkSerialize(InArchive);
 
@@ -523,3 +866,378 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 	MaterialIDsPerTriangle.BulkSerialize(InArchive);
 }
 
+// Helpers for the compact mesh data format
+namespace HoudiniStaticMeshCompact
+{
+	// Size of the independently compressed chunks of the payload
+	static const int32 ChunkSize = 256 * 1024;
+
+	// Number of elements decoded per task when loading
+	static const int32 DecodeBatchSize = 16 * 1024;
+
+	static const int32 StreamAlignment = 16;
+
+	// Octahedral encoding of a direction, on 16 bits per component
+	static uint32
+	EncodeDirection(const FVector3f& InDirection)
+	{
+		const float L1Norm = FMath::Abs(InDirection.X) + FMath::Abs(InDirection.Y) + FMath::Abs(InDirection.Z);
+		if (L1Norm <= SMALL_NUMBER)
+			return 0;
+
+		float U = InDirection.X / L1Norm;
+		float V = InDirection.Y / L1Norm;
+		if (InDirection.Z < 0.0f)
+		{
+			// Fold the lower hemisphere over the diagonals
+			const float FoldedU = (1.0f - FMath::Abs(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+			const float FoldedV = (1.0f - FMath::Abs(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+			U = FoldedU;
+			V = FoldedV;
+		}
+
+		const int16 QuantizedU = (int16)FMath::RoundToInt(FMath::Clamp(U, -1.0f, 1.0f) * 32767.0f);
+		const int16 QuantizedV = (int16)FMath::RoundToInt(FMath::Clamp(V, -1.0f, 1.0f) * 32767.0f);
+		return (uint32)(uint16)QuantizedU | ((uint32)(uint16)QuantizedV << 16);
+	}
+
+	static FVector3f
+	DecodeDirection(const uint32 InEncoded)
+	{
+		const float U = (int16)(InEncoded & 0xFFFF) / 32767.0f;
+		const float V = (int16)(InEncoded >> 16) / 32767.0f;
+
+		FVector3f Direction(U, V, 1.0f - FMath::Abs(U) - FMath::Abs(V));
+		if (Direction.Z < 0.0f)
+		{
+			Direction.X = (1.0f - FMath::Abs(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+			Direction.Y = (1.0f - FMath::Abs(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+		}
+
+		return Direction.GetSafeNormal(SMALL_NUMBER, FVector3f(0, 0, 1));
+	}
+
+	// Runs InFunction(Index) for all indices in [0, InNum), in batches on the task graph
+	template <typename FunctionType>
+	static void
+	ParallelForBatched(const int32 InNum, FunctionType InFunction)
+	{
+		const int32 NumBatches = FMath::DivideAndRoundUp(InNum, DecodeBatchSize);
+		ParallelFor(NumBatches, [&](int32 BatchIdx)
+		{
+			const int32 End = FMath::Min(InNum, (BatchIdx + 1) * DecodeBatchSize);
+			for (int32 Index = BatchIdx * DecodeBatchSize; Index < End; ++Index)
+				InFunction(Index);
+		});
+	}
+
+	// Offsets of the attribute streams in the uncompressed payload
+	struct FLayout
+	{
+		int64 Positions = 0;
+		int64 Indices = 0;
+		int64 Colors = 0;
+		int64 Normals = 0;
+		int64 UTangents = 0;
+		int64 VTangents = 0;
+		int64 UVs = 0;
+		int64 MaterialIDs = 0;
+		int64 Size = 0;
+
+		FLayout(
+			const int32 InNumPositions, const bool bInQuantizedPositions, const int64 InNumIndices, const int32 InIndexSize,
+			const int32 InNumColors, const int32 InNumNormals, const int32 InNumUTangents, const int32 InNumVTangents,
+			const int32 InNumUVs, const int32 InNumMaterialIDs)
+		{
+			auto AddStream = [this](const int64 InStreamSize)
+			{
+				const int64 Offset = Size;
+				Size = Align(Size + InStreamSize, StreamAlignment);
+				return Offset;
+			};
+
+			Positions = AddStream((int64)InNumPositions * (bInQuantizedPositions ? 3 * sizeof(uint16) : sizeof(FVector3f)));
+			Indices = AddStream((int64)InNumIndices * InIndexSize);
+			Colors = AddStream((int64)InNumColors * sizeof(FColor));
+			Normals = AddStream((int64)InNumNormals * sizeof(uint32));
+			UTangents = AddStream((int64)InNumUTangents * sizeof(uint32));
+			VTangents = AddStream((int64)InNumVTangents * sizeof(uint32));
+			UVs = AddStream((int64)InNumUVs * 2 * sizeof(uint16));
+			MaterialIDs = AddStream((int64)InNumMaterialIDs * sizeof(int32));
+		}
+	};
+}
+
+void UHoudiniStaticMesh::SerializeCompact(FArchive &InArchive, bool bInQuantizePositions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UHoudiniStaticMesh::SerializeCompact"));
+
+	using namespace HoudiniStaticMeshCompact;
+
+	// Header: quantization parameters and the number of elements of each array
+	bool bQuantizedPositions = bInQuantizePositions && VertexPositions.Num() > 0;
+	FVector3f PositionsMin = FVector3f::ZeroVector;
+	FVector3f PositionsStep = FVector3f::ZeroVector;
+	if (InArchive.IsSaving() && bQuantizedPositions)
+	{
+		const FBox Bounds = CalcBounds();
+		PositionsMin = FVector3f(Bounds.Min);
+		PositionsStep = FVector3f(Bounds.Max - Bounds.Min) / 65535.0f;
+	}
+
+	int32 NumPositions = VertexPositions.Num();
+	int32 NumTriangles = TriangleIndices.Num();
+	int32 NumColors = VertexInstanceColors.Num();
+	int32 NumNormals = VertexInstanceNormals.Num();
+	int32 NumUTangents = VertexInstanceUTangents.Num();
+	int32 NumVTangents = VertexInstanceVTangents.Num();
+	int32 NumUVs = VertexInstanceUVs.Num();
+	int32 NumMaterialIDs = MaterialIDsPerTriangle.Num();
+	const int32 ShortIndexSize = sizeof(uint16);
+	const int32 IntIndexSize = sizeof(uint32);
+	int32 IndexSize = NumPositions <= MAX_uint16 + 1 ? ShortIndexSize : IntIndexSize;
+
+	InArchive << bQuantizedPositions;
+	if (bQuantizedPositions)
+		InArchive << PositionsMin << PositionsStep;
+	InArchive << NumPositions << NumTriangles << NumColors << NumNormals << NumUTangents << NumVTangents << NumUVs << NumMaterialIDs;
+	InArchive << IndexSize;
+
+	const FLayout Layout(
+		NumPositions, bQuantizedPositions, (int64)NumTriangles * 3, IndexSize,
+		NumColors, NumNormals, NumUTangents, NumVTangents, NumUVs, NumMaterialIDs);
+
+	if (InArchive.IsError() || (IndexSize != ShortIndexSize && IndexSize != IntIndexSize) || Layout.Size > MAX_int32)
+	{
+		HOUDINI_LOG_ERROR(TEXT("[UHoudiniStaticMesh::SerializeCompact]: Invalid compact mesh data header for %s."), *GetName());
+		InArchive.SetError();
+		return;
+	}
+
+	const int32 NumChunks = (int32)FMath::DivideAndRoundUp<int64>(Layout.Size, ChunkSize);
+	auto GetChunkSize = [&Layout](const int32 InChunkIdx)
+	{
+		return (int32)FMath::Min<int64>(ChunkSize, Layout.Size - (int64)InChunkIdx * ChunkSize);
+	};
+
+	TArray<uint8> Payload;
+	Payload.SetNumZeroed((int32)Layout.Size);
+	uint8* const PayloadData = Payload.GetData();
+
+	// Chunks are stored uncompressed when compression doesn't make them smaller
+	TArray<int32> CompressedChunkSizes;
+	TArray<uint8> CompressedData;
+
+	if (InArchive.IsSaving())
+	{
+		// Encode the attributes
+		if (bQuantizedPositions)
+		{
+			uint16* const Positions = reinterpret_cast<uint16*>(PayloadData + Layout.Positions);
+			const FVector3f InvStep(
+				PositionsStep.X > 0.0f ? 1.0f / PositionsStep.X : 0.0f,
+				PositionsStep.Y > 0.0f ? 1.0f / PositionsStep.Y : 0.0f,
+				PositionsStep.Z > 0.0f ? 1.0f / PositionsStep.Z : 0.0f);
+			ParallelForBatched(NumPositions, [&](int32 Index)
+			{
+				const FVector3f Quantized = (VertexPositions[Index] - PositionsMin) * InvStep;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+					Positions[Index * 3 + Axis] = (uint16)FMath::Clamp(FMath::RoundToInt(Quantized[Axis]), 0, (int32)MAX_uint16);
+			});
+		}
+		else
+		{
+			FMemory::Memcpy(PayloadData + Layout.Positions, VertexPositions.GetData(), NumPositions * sizeof(FVector3f));
+		}
+
+		if (IndexSize == ShortIndexSize)
+		{
+			uint16* const Indices = reinterpret_cast<uint16*>(PayloadData + Layout.Indices);
+			ParallelForBatched(NumTriangles, [&](int32 Index)
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+					Indices[Index * 3 + Corner] = (uint16)TriangleIndices[Index][Corner];
+			});
+		}
+		else
+		{
+			FMemory::Memcpy(PayloadData + Layout.Indices, TriangleIndices.GetData(), NumTriangles * sizeof(FIntVector));
+		}
+
+		FMemory::Memcpy(PayloadData + Layout.Colors, VertexInstanceColors.GetData(), NumColors * sizeof(FColor));
+
+		auto EncodeDirections = [&](const TArray<FVector3f>& InDirections, const int64 InOffset)
+		{
+			uint32* const Encoded = reinterpret_cast<uint32*>(PayloadData + InOffset);
+			ParallelForBatched(InDirections.Num(), [&](int32 Index) { Encoded[Index] = EncodeDirection(InDirections[Index]); });
+		};
+		EncodeDirections(VertexInstanceNormals, Layout.Normals);
+		EncodeDirections(VertexInstanceUTangents, Layout.UTangents);
+		EncodeDirections(VertexInstanceVTangents, Layout.VTangents);
+
+		uint16* const UVs = reinterpret_cast<uint16*>(PayloadData + Layout.UVs);
+		ParallelForBatched(NumUVs, [&](int32 Index)
+		{
+			UVs[Index * 2 + 0] = FFloat16(VertexInstanceUVs[Index].X).Encoded;
+			UVs[Index * 2 + 1] = FFloat16(VertexInstanceUVs[Index].Y).Encoded;
+		});
+
+		FMemory::Memcpy(PayloadData + Layout.MaterialIDs, MaterialIDsPerTriangle.GetData(), NumMaterialIDs * sizeof(int32));
+
+		// Compress the chunks
+		const int32 MaxCompressedChunkSize = FCompression::CompressMemoryBound(NAME_Oodle, ChunkSize);
+		TArray64<uint8> CompressedChunks;
+		CompressedChunks.SetNumUninitialized((int64)NumChunks * MaxCompressedChunkSize);
+		CompressedChunkSizes.SetNumUninitialized(NumChunks);
+		ParallelFor(NumChunks, [&](int32 ChunkIdx)
+		{
+			const int32 UncompressedSize = GetChunkSize(ChunkIdx);
+			int32 CompressedSize = MaxCompressedChunkSize;
+			const bool bCompressed = FCompression::CompressMemory(
+				NAME_Oodle,
+				CompressedChunks.GetData() + (int64)ChunkIdx * MaxCompressedChunkSize, CompressedSize,
+				PayloadData + (int64)ChunkIdx * ChunkSize, UncompressedSize);
+
+			CompressedChunkSizes[ChunkIdx] = (bCompressed && CompressedSize < UncompressedSize) ? CompressedSize : UncompressedSize;
+		});
+
+		int64 CompressedDataSize = 0;
+		for (const int32 CompressedSize : CompressedChunkSizes)
+			CompressedDataSize += CompressedSize;
+		CompressedData.SetNumUninitialized((int32)CompressedDataSize);
+
+		int64 CompressedOffset = 0;
+		for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+		{
+			const bool bStoredRaw = CompressedChunkSizes[ChunkIdx] == GetChunkSize(ChunkIdx);
+			const uint8* const ChunkData = bStoredRaw
+				? PayloadData + (int64)ChunkIdx * ChunkSize
+				: CompressedChunks.GetData() + (int64)ChunkIdx * MaxCompressedChunkSize;
+			FMemory::Memcpy(CompressedData.GetData() + CompressedOffset, ChunkData, CompressedChunkSizes[ChunkIdx]);
+			CompressedOffset += CompressedChunkSizes[ChunkIdx];
+		}
+	}
+
+	InArchive << CompressedChunkSizes;
+	CompressedData.BulkSerialize(InArchive);
+
+	if (!InArchive.IsLoading())
+		return;
+
+	if (InArchive.IsError() || CompressedChunkSizes.Num() != NumChunks)
+	{
+		HOUDINI_LOG_ERROR(TEXT("[UHoudiniStaticMesh::SerializeCompact]: Invalid compressed chunks for %s."), *GetName());
+		InArchive.SetError();
+		return;
+	}
+
+	// Decompress the chunks in parallel
+	TArray<int64> CompressedOffsets;
+	CompressedOffsets.SetNumUninitialized(NumChunks);
+	int64 CompressedOffset = 0;
+	for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+	{
+		CompressedOffsets[ChunkIdx] = CompressedOffset;
+		CompressedOffset += CompressedChunkSizes[ChunkIdx];
+	}
+
+	if (CompressedOffset != CompressedData.Num())
+	{
+		HOUDINI_LOG_ERROR(TEXT("[UHoudiniStaticMesh::SerializeCompact]: Invalid compressed data size for %s."), *GetName());
+		InArchive.SetError();
+		return;
+	}
+
+	FThreadSafeBool bDecompressionFailed = false;
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 UncompressedSize = GetChunkSize(ChunkIdx);
+		uint8* const ChunkData = PayloadData + (int64)ChunkIdx * ChunkSize;
+		const uint8* const CompressedChunk = CompressedData.GetData() + CompressedOffsets[ChunkIdx];
+		if (CompressedChunkSizes[ChunkIdx] == UncompressedSize)
+		{
+			FMemory::Memcpy(ChunkData, CompressedChunk, UncompressedSize);
+		}
+		else if (!FCompression::UncompressMemory(NAME_Oodle, ChunkData, UncompressedSize, CompressedChunk, CompressedChunkSizes[ChunkIdx]))
+		{
+			bDecompressionFailed = true;
+		}
+	});
+
+	if (bDecompressionFailed)
+	{
+		HOUDINI_LOG_ERROR(TEXT("[UHoudiniStaticMesh::SerializeCompact]: Failed to decompress the mesh data of %s."), *GetName());
+		InArchive.SetError();
+		return;
+	}
+
+	// Decode the attributes in parallel
+	VertexPositions.SetNumUninitialized(NumPositions);
+	if (bQuantizedPositions)
+	{
+		const uint16* const Positions = reinterpret_cast<const uint16*>(PayloadData + Layout.Positions);
+		ParallelForBatched(NumPositions, [&](int32 Index)
+		{
+			VertexPositions[Index] = PositionsMin + PositionsStep * FVector3f(Positions[Index * 3 + 0], Positions[Index * 3 + 1], Positions[Index * 3 + 2]);
+		});
+	}
+	else
+	{
+		FMemory::Memcpy(VertexPositions.GetData(), PayloadData + Layout.Positions, NumPositions * sizeof(FVector3f));
+	}
+
+	TriangleIndices.SetNumUninitialized(NumTriangles);
+	if (IndexSize == ShortIndexSize)
+	{
+		const uint16* const Indices = reinterpret_cast<const uint16*>(PayloadData + Layout.Indices);
+		ParallelForBatched(NumTriangles, [&](int32 Index)
+		{
+			TriangleIndices[Index] = FIntVector(Indices[Index * 3 + 0], Indices[Index * 3 + 1], Indices[Index * 3 + 2]);
+		});
+	}
+	else
+	{
+		FMemory::Memcpy(TriangleIndices.GetData(), PayloadData + Layout.Indices, NumTriangles * sizeof(FIntVector));
+	}
+
+	VertexInstanceColors.SetNumUninitialized(NumColors);
+	FMemory::Memcpy(VertexInstanceColors.GetData(), PayloadData + Layout.Colors, NumColors * sizeof(FColor));
+
+	auto DecodeDirections = [&](TArray<FVector3f>& OutDirections, const int32 InNum, const int64 InOffset)
+	{
+		const uint32* const Encoded = reinterpret_cast<const uint32*>(PayloadData + InOffset);
+		OutDirections.SetNumUninitialized(InNum);
+		ParallelForBatched(InNum, [&](int32 Index) { OutDirections[Index] = DecodeDirection(Encoded[Index]); });
+	};
+	DecodeDirections(VertexInstanceNormals, NumNormals, Layout.Normals);
+	DecodeDirections(VertexInstanceUTangents, NumUTangents, Layout.UTangents);
+	DecodeDirections(VertexInstanceVTangents, NumVTangents, Layout.VTangents);
+
+	const uint16* const UVs = reinterpret_cast<const uint16*>(PayloadData + Layout.UVs);
+	VertexInstanceUVs.SetNumUninitialized(NumUVs);
+	ParallelForBatched(NumUVs, [&](int32 Index)
+	{
+		FFloat16 U, V;
+		U.Encoded = UVs[Index * 2 + 0];
+		V.Encoded = UVs[Index * 2 + 1];
+		VertexInstanceUVs[Index] = FVector2f(U.GetFloat(), V.GetFloat());
+	});
+
+	MaterialIDsPerTriangle.SetNumUninitialized(NumMaterialIDs);
+	FMemory::Memcpy(MaterialIDsPerTriangle.GetData(), PayloadData + Layout.MaterialIDs, NumMaterialIDs * sizeof(int32));
+}
+
+bool
+UHoudiniStaticMesh::CanSerializeCompact() const
+{
+	// Chunks that don't compress are stored as is, so the compressed data is never larger than the payload.
+	// Unquantized positions give the largest payload.
+	const int32 IndexSize = VertexPositions.Num() <= MAX_uint16 + 1 ? sizeof(uint16) : sizeof(uint32);
+	const HoudiniStaticMeshCompact::FLayout Layout(
+		VertexPositions.Num(), false, (int64)TriangleIndices.Num() * 3, IndexSize,
+		VertexInstanceColors.Num(), VertexInstanceNormals.Num(), VertexInstanceUTangents.Num(), VertexInstanceVTangents.Num(),
+		VertexInstanceUVs.Num(), MaterialIDsPerTriangle.Num());
+
+	return Layout.Size <= MAX_int32;
+}
+
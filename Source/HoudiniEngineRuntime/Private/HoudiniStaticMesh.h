@@ -149,17 +149,58 @@ public:
 	
 	/**
 	 * Meant to be called after the mesh data arrays are populated.
-	 * Currently only calls Shrink on the arrays
+	 * Calls Shrink on the arrays, and clears the welded vertices so that the next proxy rebuilds them.
 	 */
 	UFUNCTION()
 	void Optimize();
 
+	UFUNCTION()
+	bool GetWeldVertices() const { return bWeldVertices; }
+
+	UFUNCTION()
+	void SetWeldVertices(bool bInWeldVertices) { bWeldVertices = bInWeldVertices; }
+
+	/**
+	 * Build the welded, indexed render data of the mesh: vertex instances that share the same vertex and have
+	 * identical normals, tangents, color and UVs are merged into a single welded vertex. If
+	 * bInOptimizeVertexCache is true, the triangle order is then optimized for the post-transform vertex cache
+	 * (Forsyth). The per vertex instance arrays are not modified.
+	 * Must be called after the mesh data arrays are populated.
+	 */
+	UFUNCTION()
+	void BuildWeldedVertices(bool bInOptimizeVertexCache=true);
+
+	UFUNCTION()
+	void ClearWeldedVertices();
+
+	/**
+	 * Builds the welded vertices if GetWeldVertices() is true and they have not been built yet. Called by the
+	 * scene proxy, so that meshes that are loaded but never rendered don't pay for the welding.
+	 * Returns HasWeldedVertices().
+	 */
+	bool EnsureWeldedVertices();
+
+	UFUNCTION()
+	bool HasWeldedVertices() const { return NumWeldedVertices > 0; }
+
+	UFUNCTION()
+	uint32 GetNumWeldedVertices() const { return NumWeldedVertices; }
+
+	// The welded vertex index of each vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex.
+	const TArray<uint32>& GetWeldedVertexIndices() const { return WeldedVertexIndices; }
+
+	// The triangle IDs in vertex cache optimized order
+	const TArray<uint32>& GetWeldedTriangleOrder() const { return WeldedTriangleOrder; }
+
 	UFUNCTION()
 	FBox CalcBounds() const;
 
 	UFUNCTION()
 	const TArray<FVector3f>& GetVertexPositions() const { return VertexPositions; }
 
+	// Mutable access to the positions, so they can be read straight into the mesh after Initialize()
+	TArray<FVector3f>& GetVertexPositions() { return VertexPositions; }
+
 	UFUNCTION()
 	const TArray<FIntVector>& GetTriangleIndices() const { return TriangleIndices; }
 
@@ -198,11 +239,30 @@ public:
 	UFUNCTION()
 	bool IsValid(bool bInSkipVertexIndicesCheck=false) const;
 
-	// Custom serialization: we use TArray::BulkSerialize to speed up array serialization
+	// Custom serialization: persistent archives use the compact format (see SerializeCompact()), other archives
+	// (undo/redo, duplication) use TArray::BulkSerialize to keep the data lossless.
 	virtual void Serialize(FArchive &InArchive) override;
 
+	/**
+	 * Serialize the mesh data arrays in the compact format: normals and tangents are octahedral encoded on 16 bits
+	 * per component, UVs are stored as half floats and positions, if bInQuantizePositions is true, are quantized on
+	 * 16 bits per axis against the bounds of the mesh. The payload is compressed in chunks that are decompressed
+	 * and decoded in parallel when loading.
+	 * Normals and tangents are stored as directions: they are normalized on load.
+	 *
+	 * @param bInQuantizePositions Only used when saving, the archive records whether positions were quantized.
+	 */
+	void SerializeCompact(FArchive &InArchive, bool bInQuantizePositions=false);
+
+	// Returns false if the uncompressed payload of the compact format would not fit in an int32 sized buffer.
+	// Serialize() then falls back to SerializeRaw().
+	bool CanSerializeCompact() const;
+
 protected:
 
+	// Serialize the mesh data arrays with TArray::BulkSerialize.
+	void SerializeRaw(FArchive &InArchive);
+
 	UPROPERTY()
 	bool bHasNormals;
 
@@ -256,5 +316,18 @@ protected:
 	/** The materials of the mesh. Index by MaterialID (MaterialIndex). */
 	UPROPERTY()
 	TArray<FStaticMaterial> StaticMaterials;
+
+	/** If true, the scene proxy renders the welded vertices of the mesh, see EnsureWeldedVertices(). */
+	UPROPERTY()
+	bool bWeldVertices;
+
+	/** The number of welded vertices, 0 if they are not built. Derived data, not serialized. */
+	uint32 NumWeldedVertices;
+
+	/** Welded vertex index per vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex. Derived data, not serialized. */
+	TArray<uint32> WeldedVertexIndices;
+
+	/** The triangle IDs, ordered for the post-transform vertex cache. Derived data, not serialized. */
+	TArray<uint32> WeldedTriangleOrder;
 };
 
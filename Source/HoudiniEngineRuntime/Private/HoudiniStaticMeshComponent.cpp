@@ -44,6 +44,7 @@ UHoudiniStaticMeshComponent::UHoudiniStaticMeshComponent(const FObjectInitialize
 
 	Mesh = nullptr;
 	bHoudiniIconVisible = true;
+	bMeshBeingUpdated = false;
 
 #if WITH_EDITOR
 	bVisualizeComponent = true;
@@ -155,6 +156,25 @@ void UHoudiniStaticMeshComponent::NotifyMeshUpdated()
 #endif
 }
 
+void UHoudiniStaticMeshComponent::SetMeshBeingUpdated(bool bInMeshBeingUpdated)
+{
+	if (bMeshBeingUpdated == bInMeshBeingUpdated)
+		return;
+
+	bMeshBeingUpdated = bInMeshBeingUpdated;
+
+	// Switch the draw path of the current proxy, without rebuilding its buffers
+	FHoudiniStaticMeshSceneProxy* Proxy = static_cast<FHoudiniStaticMeshSceneProxy*>(SceneProxy);
+	if (Proxy)
+	{
+		ENQUEUE_RENDER_COMMAND(FHoudiniStaticMeshComponent_SetMeshBeingUpdated)(
+			[Proxy, bInMeshBeingUpdated](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->SetUseDynamicDrawPath_RenderThread(bInMeshBeingUpdated);
+		});
+	}
+}
+
 #if WITH_EDITORONLY_DATA
 void UHoudiniStaticMeshComponent::UpdateSpriteComponent()
 {
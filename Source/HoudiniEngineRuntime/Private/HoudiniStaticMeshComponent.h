@@ -53,6 +53,14 @@ public:
 	// Call this if the mesh updated (outside of calling SetMesh).
 	UFUNCTION()
 	void NotifyMeshUpdated();
+
+	UFUNCTION()
+	bool IsMeshBeingUpdated() const { return bMeshBeingUpdated; }
+
+	// While the mesh is being updated by cooks, it is drawn with the dynamic path instead of caching static draw
+	// commands that the next update would invalidate.
+	UFUNCTION()
+	void SetMeshBeingUpdated(bool bInMeshBeingUpdated);
 	
 	virtual void OnRegister() override;
 
@@ -97,4 +105,8 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Icons")
 	bool bHoudiniIconVisible;
 
+	/** True while cooks are updating the mesh, see SetMeshBeingUpdated(). */
+	UPROPERTY(Transient, DuplicateTransient)
+	bool bMeshBeingUpdated;
+
 };
\ No newline at end of file
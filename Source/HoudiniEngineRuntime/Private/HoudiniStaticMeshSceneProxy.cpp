@@ -158,6 +158,7 @@ FHoudiniStaticMeshSceneProxy::FHoudiniStaticMeshSceneProxy(UHoudiniStaticMeshCom
 	, FeatureLevel(InFeatureLevel)
 	, Component(InComponent)
 	, MaterialRelevance(InComponent ? InComponent->GetMaterialRelevance(InFeatureLevel) : FMaterialRelevance())
+	, bUseDynamicDrawPath(InComponent ? InComponent->IsMeshBeingUpdated() : false)
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	, Owner(InComponent ? InComponent->GetOwner() : nullptr)
 #endif
@@ -240,6 +241,9 @@ void FHoudiniStaticMeshSceneProxy::Build()
 		UHoudiniStaticMesh *Mesh = Component->GetMesh();
 		if (Mesh)
 		{
+			// Welding is deferred until the mesh is first rendered
+			Mesh->EnsureWeldedVertices();
+
 			if (NumMaterials > 1 && Mesh->HasPerFaceMaterials())
 			{
 				BuildBufferSetsByMaterial();
@@ -252,6 +256,56 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::SetUseDynamicDrawPath_RenderThread(bool bInUseDynamicDrawPath)
+{
+	check(IsInRenderingThread());
+
+	if (bUseDynamicDrawPath == bInUseDynamicDrawPath)
+		return;
+
+	bUseDynamicDrawPath = bInUseDynamicDrawPath;
+
+	// Re-add the static mesh batches, DrawStaticElements only adds them when the static path is used
+	GetScene().UpdateCachedRenderStates(this);
+}
+
+void FHoudiniStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+{
+	// The mesh is rebuilt by every cook while it is being updated: don't cache draw commands for it
+	if (bUseDynamicDrawPath)
+		return;
+
+	const uint32 NumBufferSets = BufferSets.Num();
+	for (uint32 BufferSetIdx = 0; BufferSetIdx < NumBufferSets; ++BufferSetIdx)
+	{
+		const FHoudiniStaticMeshRenderBufferSet *BufferSet = BufferSets[BufferSetIdx];
+		if (BufferSet->NumTriangles == 0 || BufferSet->TriangleIndexBuffer.Indices.Num() == 0)
+			continue;
+
+		FMeshBatch MeshBatch;
+		FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
+		BatchElement.IndexBuffer = &BufferSet->TriangleIndexBuffer;
+		BatchElement.FirstIndex = 0;
+		BatchElement.NumPrimitives = BufferSet->NumTriangles;
+		BatchElement.MinVertexIndex = 0;
+		BatchElement.MaxVertexIndex = BufferSet->PositionVertexBuffer.GetNumVertices() - 1;
+
+		MeshBatch.VertexFactory = &BufferSet->LocalVertexFactory;
+		MeshBatch.MaterialRenderProxy = BufferSet->Material->GetRenderProxy();
+		MeshBatch.ReverseCulling = IsLocalToWorldDeterminantNegative();
+		MeshBatch.Type = PT_TriangleList;
+		MeshBatch.DepthPriorityGroup = SDPG_World;
+		MeshBatch.LODIndex = 0;
+		MeshBatch.SegmentIndex = (uint8)FMath::Min<uint32>(BufferSetIdx, MAX_uint8);
+		MeshBatch.CastShadow = true;
+		MeshBatch.bUseForDepthPass = true;
+		MeshBatch.bUseAsOccluder = ShouldUseAsOccluder();
+		MeshBatch.bCanApplyViewModeOverrides = true;
+
+		PDI->DrawMesh(MeshBatch, FLT_MAX);
+	}
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	const FEngineShowFlags EngineShowFlags = ViewFamily.EngineShowFlags;
@@ -372,8 +426,12 @@ FPrimitiveViewRelevance FHoudiniStaticMeshSceneProxy::GetViewRelevance(const FSc
 {
 	FPrimitiveViewRelevance Result;
 
+	// Like static meshes, rich views (wireframe, debug view modes...) always use the dynamic path
+	const bool bDrawDynamic = bUseDynamicDrawPath || IsRichView(*View->Family);
+
 	Result.bDrawRelevance = IsShown(View);
-	Result.bDynamicRelevance = true;
+	Result.bStaticRelevance = !bDrawDynamic;
+	Result.bDynamicRelevance = bDrawDynamic;
 	Result.bRenderCustomDepth = ShouldRenderCustomDepth();
 	Result.bRenderInMainPass = ShouldRenderInMainPass();
 	Result.bShadowRelevance = IsShadowCast(View);
@@ -413,67 +471,114 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	InBuffers->ColorVertexBuffer.Init(NumVertices);
 	InBuffers->TriangleIndexBuffer.Indices.AddUninitialized(NumTriangles * 3);
 
-	const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
-	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
-	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
-	const TArray<FVector3f>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
-	const TArray<FVector3f>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
-	const TArray<FVector3f>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
-	const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
-
-	const bool bHasColors = InMesh->HasColors();
-	const bool bHasNormals = InMesh->HasNormals();
-	const bool bHasTangents = InMesh->HasTangents();
-
 	FThreadSafeCounter VertCounter(0);
 	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
 	ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
 	{
 		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
-		const FIntVector &TriIndices = TriangleIndices[TriangleID];
 
-		FVector3f TangentU;
-		FVector3f TangentV;
 		uint32 VertIdx = VertCounter.Add(3);
 		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
 		{
-			const uint32 MeshVtxIdx = TriIndices[TriVertIdx];
-			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
+			PopulateVertex(InMesh, InBuffers, VertIdx, TriangleID * 3 + TriVertIdx);
+
+			InBuffers->TriangleIndexBuffer.Indices[VertIdx] = VertIdx;
+			VertIdx++;
+		}
+	});
+}
 
-			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
+void FHoudiniStaticMeshSceneProxy::PopulateWeldedBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>& InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTrianglesInGroup)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::PopulateWeldedBuffers"));
 
-			FVector3f Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
-			if (bHasTangents)
-			{
-				TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
-				TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
-			}
-			else
-			{
-				Normal.FindBestAxisVectors(TangentU, TangentV);
-			}
-			InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
+	check(InMesh);
+	check(InBuffers);
 
-			if (NumUVLayers > 0)
-			{
-				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
-				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
-				}
-			}
-			else
-			{
-				InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2f::ZeroVector);
-			}
+	const uint32 NumTriangles = InNumTrianglesInGroup;
+	InBuffers->NumTriangles = NumTriangles;
+
+	if (NumTriangles == 0)
+		return;
 
-			InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
+	const TArray<uint32>& WeldedVertexIndices = InMesh->GetWeldedVertexIndices();
 
-			InBuffers->TriangleIndexBuffer.Indices[VertIdx] = VertIdx;
-			VertIdx++;
+	// Assign buffer vertices to the welded vertices used by the triangles, in order of first use, so that the
+	// vertex fetches follow the triangle order.
+	TArray<int32> BufferVertexIndices;
+	BufferVertexIndices.Init(INDEX_NONE, InMesh->GetNumWeldedVertices());
+	TArray<uint32> BufferVertexSourceInstances;
+	BufferVertexSourceInstances.Reserve(FMath::Min<int32>(NumTriangles * 3, InMesh->GetNumWeldedVertices()));
+
+	InBuffers->TriangleIndexBuffer.Indices.SetNumUninitialized(NumTriangles * 3);
+	for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
+	{
+		const uint32 TriangleID = InTriangleIDs[InTriangleGroupStartIdx + TriangleIDIdx];
+		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+		{
+			// All the vertex instances of a welded vertex have bitwise identical attributes, so the first one
+			// seen is used as the source
+			const uint32 VertexInstanceIdx = TriangleID * 3 + TriVertIdx;
+			int32& BufferVertexIdx = BufferVertexIndices[WeldedVertexIndices[VertexInstanceIdx]];
+			if (BufferVertexIdx == INDEX_NONE)
+				BufferVertexIdx = BufferVertexSourceInstances.Add(VertexInstanceIdx);
+
+			InBuffers->TriangleIndexBuffer.Indices[TriangleIDIdx * 3 + TriVertIdx] = BufferVertexIdx;
 		}
+	}
+
+	const uint32 NumVertices = BufferVertexSourceInstances.Num();
+	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+
+	InBuffers->PositionVertexBuffer.Init(NumVertices);
+	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
+	InBuffers->ColorVertexBuffer.Init(NumVertices);
+
+	ParallelFor(NumVertices, [&](uint32 VertIdx)
+	{
+		PopulateVertex(InMesh, InBuffers, VertIdx, BufferVertexSourceInstances[VertIdx]);
 	});
 }
 
+void FHoudiniStaticMeshSceneProxy::PopulateVertex(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, uint32 InVertIdx, uint32 InVertexInstanceIdx) const
+{
+	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+	const uint32 TriangleID = InVertexInstanceIdx / 3;
+	const uint32 TriVertIdx = InVertexInstanceIdx % 3;
+
+	InBuffers->PositionVertexBuffer.VertexPosition(InVertIdx) = InMesh->GetVertexPositions()[InMesh->GetTriangleIndices()[TriangleID][TriVertIdx]];
+
+	FVector3f TangentU;
+	FVector3f TangentV;
+	FVector3f Normal = InMesh->HasNormals() ? InMesh->GetVertexInstanceNormals()[InVertexInstanceIdx] : FVector3f(0, 0, 1);
+	if (InMesh->HasTangents())
+	{
+		TangentU = InMesh->GetVertexInstanceUTangents()[InVertexInstanceIdx];
+		TangentV = InMesh->GetVertexInstanceVTangents()[InVertexInstanceIdx];
+	}
+	else
+	{
+		Normal.FindBestAxisVectors(TangentU, TangentV);
+	}
+	InBuffers->StaticMeshVertexBuffer.SetVertexTangents(InVertIdx, TangentU, TangentV, Normal);
+
+	if (NumUVLayers > 0)
+	{
+		const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
+		const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
+		for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+		{
+			InBuffers->StaticMeshVertexBuffer.SetVertexUV(InVertIdx, UVLayerIdx, VertexInstanceUVs[UVLayerIdx * NumVertexInstances + InVertexInstanceIdx]);
+		}
+	}
+	else
+	{
+		InBuffers->StaticMeshVertexBuffer.SetVertexUV(InVertIdx, 0, FVector2f::ZeroVector);
+	}
+
+	InBuffers->ColorVertexBuffer.VertexColor(InVertIdx) = InMesh->HasColors() ? InMesh->GetVertexInstanceColors()[InVertexInstanceIdx] : DefaultVertexColor;
+}
+
 void FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet"));
@@ -490,7 +595,10 @@ void FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet()
 
 	FHoudiniStaticMeshRenderBufferSet *Buffers = BufferSets.Last();
 
-	PopulateBuffers(Mesh, Buffers);
+	if (Mesh->HasWeldedVertices())
+		PopulateWeldedBuffers(Mesh, Buffers, Mesh->GetWeldedTriangleOrder(), 0, Mesh->GetNumTriangles());
+	else
+		PopulateBuffers(Mesh, Buffers);
 
 	ENQUEUE_RENDER_COMMAND(FHoudiniStaticMeshSceneProxy_BuildSingleBufferSet)(
 		[Buffers](FRHICommandListImmediate& RHICMdList)
@@ -546,16 +654,32 @@ void FHoudiniStaticMeshSceneProxy::BuildBufferSetsByMaterial()
 		}
 	}
 
+	const bool bHasWeldedVertices = Mesh->HasWeldedVertices();
 	TArray<uint32> GroupTriangleIDs;
 	GroupTriangleIDs.SetNumZeroed(NumTriangles);
-	ParallelFor(NumTriangles, [&](uint32 TriangleID) 
+	if (bHasWeldedVertices)
 	{
-		const int32 MatID = MaterialIDsPerTriangle[TriangleID];
-		if (MatID >= 0 && (uint32) MatID < NumMaterials)
+		// Keep the vertex cache optimized triangle order within each material group
+		for (const uint32 TriangleID : Mesh->GetWeldedTriangleOrder())
 		{
-			GroupTriangleIDs[OffsetPerMaterial[MatID] + WrittenPerMaterial[MatID].Add(1)] = TriangleID;
+			const int32 MatID = MaterialIDsPerTriangle[TriangleID];
+			if (MatID >= 0 && (uint32) MatID < NumMaterials)
+			{
+				GroupTriangleIDs[OffsetPerMaterial[MatID] + WrittenPerMaterial[MatID].Add(1)] = TriangleID;
+			}
 		}
-	});
+	}
+	else
+	{
+		ParallelFor(NumTriangles, [&](uint32 TriangleID) 
+		{
+			const int32 MatID = MaterialIDsPerTriangle[TriangleID];
+			if (MatID >= 0 && (uint32) MatID < NumMaterials)
+			{
+				GroupTriangleIDs[OffsetPerMaterial[MatID] + WrittenPerMaterial[MatID].Add(1)] = TriangleID;
+			}
+		});
+	}
 
 	for (int32 MatID = 0; (uint32) MatID < NumMaterials; ++MatID)
 	{
@@ -564,10 +688,20 @@ void FHoudiniStaticMeshSceneProxy::BuildBufferSetsByMaterial()
 
 		FHoudiniStaticMeshRenderBufferSet *Buffers = BufferSets[MatID];
 
-		PopulateBuffers(
-			Mesh, Buffers,
-			&GroupTriangleIDs, OffsetPerMaterial[MatID], TriCountPerMaterial[MatID]
-		);
+		if (bHasWeldedVertices)
+		{
+			PopulateWeldedBuffers(
+				Mesh, Buffers,
+				GroupTriangleIDs, OffsetPerMaterial[MatID], TriCountPerMaterial[MatID]
+			);
+		}
+		else
+		{
+			PopulateBuffers(
+				Mesh, Buffers,
+				&GroupTriangleIDs, OffsetPerMaterial[MatID], TriCountPerMaterial[MatID]
+			);
+		}
 
 		ENQUEUE_RENDER_COMMAND(FHoudiniStaticMeshSceneProxy_BuildSingleBufferSet)(
 			[Buffers](FRHICommandListImmediate& RHICMdList)
@@ -109,7 +109,15 @@ public:
 	// Build buffer sets to render the mesh.
 	virtual void Build();
 
+	/**
+	 * Switch between drawing the mesh with cached static draw commands and the dynamic path.
+	 * @warning Render thread only.
+	 */
+	void SetUseDynamicDrawPath_RenderThread(bool bInUseDynamicDrawPath);
+
 	// FPrimitiveSceneProxy
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
@@ -134,6 +142,13 @@ public:
 protected:
 	void PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs=nullptr, uint32 InTriangleGroupStartIdx=0u, uint32 InNumTrianglesInGroup=0u);
 
+	// Populate the buffers from the welded vertices of the mesh: only the welded vertices used by the triangles
+	// are added to the vertex buffers, and the triangles are indexed in the given (vertex cache optimized) order.
+	void PopulateWeldedBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>& InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTrianglesInGroup);
+
+	// Write the attributes of the vertex instance InVertexInstanceIdx of InMesh to the vertex InVertIdx of the buffers.
+	void PopulateVertex(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, uint32 InVertIdx, uint32 InVertexInstanceIdx) const;
+
 	// Virtual function for creating a new buffer set instances.
 	// Subclasses can overwrite this is they use a different buffer set with 
 	// different instantiation requirements.
@@ -166,6 +181,10 @@ protected:
 
 	FMaterialRelevance MaterialRelevance;
 
+	// If true the mesh is drawn via GetDynamicMeshElements (while cooks are updating it), otherwise via the cached
+	// static mesh batches from DrawStaticElements.
+	bool bUseDynamicDrawPath;
+
 private:
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	AActor* Owner;
@@ -4,7 +4,17 @@
 
 #include "HoudiniRuntimeTests.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniBoundsUtils.h"
+#include "HoudiniCookStats.h"
+#include "HoudiniParameter.h"
+#include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniStaticMesh.h"
+#include "Async/ParallelFor.h"
 #include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestAutomation, "Houdini.Runtime.TestAutomation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
@@ -14,4 +24,532 @@ bool HoudiniRuntimeTestAutomation::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestDirtyQueue, "Houdini.Runtime.DirtyComponentQueue", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestDirtyQueue::RunTest(const FString & Parameters)
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return true;
+
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+
+	// Don't steal the components that were already queued by the editor
+	TArray<UHoudiniAssetComponent*> PreviouslyQueued;
+	Runtime.DequeueDirtyHoudiniComponents(PreviouslyQueued);
+
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+	HAC->AddToRoot();
+
+	// Unregistered components are never processed
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(HAC);
+	TArray<UHoudiniAssetComponent*> Queued;
+	Runtime.DequeueDirtyHoudiniComponents(Queued);
+	TestEqual(TEXT("Unregistered component isn't queued"), Queued.Num(), 0);
+
+	// Registering queues the component
+	Runtime.RegisterHoudiniComponent(HAC);
+	TestTrue(TEXT("Component registered"), HAC->IsRegisteredInRuntime());
+	Queued.Reset();
+	Runtime.DequeueDirtyHoudiniComponents(Queued);
+	TestEqual(TEXT("Registered component is queued"), Queued.Num(), 1);
+
+	// Nothing changed, nothing is queued
+	Queued.Reset();
+	Runtime.DequeueDirtyHoudiniComponents(Queued);
+	TestEqual(TEXT("Queue is empty"), Queued.Num(), 0);
+
+	// Several changes only queue the component once
+	UHoudiniParameter* Parameter = UHoudiniParameter::Create(HAC, TEXT("TestParm"));
+	Parameter->MarkChanged(true);
+	HAC->MarkAsNeedCook();
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(HAC);
+	Queued.Reset();
+	Runtime.DequeueDirtyHoudiniComponents(Queued);
+	TestEqual(TEXT("Component is queued once"), Queued.Num(), 1);
+	TestTrue(TEXT("Queued component"), Queued.Num() > 0 && Queued[0] == HAC);
+
+	// Unregistered components are dropped from the queue
+	FHoudiniEngineRuntime::MarkHoudiniComponentDirty(HAC);
+	Runtime.UnRegisterHoudiniComponent(HAC);
+	Queued.Reset();
+	Runtime.DequeueDirtyHoudiniComponents(Queued);
+	TestEqual(TEXT("Unregistered component is dropped"), Queued.Num(), 0);
+
+	HAC->RemoveFromRoot();
+
+	for (UHoudiniAssetComponent* PreviousHAC : PreviouslyQueued)
+		FHoudiniEngineRuntime::MarkHoudiniComponentDirty(PreviousHAC);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestCookOutOfDate, "Houdini.Runtime.CookOutOfDate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestCookOutOfDate::RunTest(const FString & Parameters)
+{
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+	HAC->AddToRoot();
+	TestFalse(TEXT("New component's cook is up to date"), HAC->IsCookOutOfDate());
+
+	// Clearing a parameter's changed flag doesn't affect the cook
+	UHoudiniParameter* Parameter = UHoudiniParameter::Create(HAC, TEXT("TestParm"));
+	Parameter->MarkChanged(false);
+	TestFalse(TEXT("Cook is up to date"), HAC->IsCookOutOfDate());
+
+	// Changing a parameter makes the current cook out of date
+	Parameter->MarkChanged(true);
+	TestTrue(TEXT("Cook is out of date after a parameter change"), HAC->IsCookOutOfDate());
+
+	// Changes made by the manager while it processes the component don't make the cook out of date
+	UHoudiniAssetComponent* OtherHAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+	OtherHAC->AddToRoot();
+	UHoudiniParameter* OtherParameter = UHoudiniParameter::Create(OtherHAC, TEXT("TestParm"));
+	FHoudiniEngineRuntime::SetProcessingHoudiniComponents(true);
+	OtherParameter->MarkChanged(true);
+	FHoudiniEngineRuntime::SetProcessingHoudiniComponents(false);
+	TestFalse(TEXT("Processing changes don't make the cook out of date"), OtherHAC->IsCookOutOfDate());
+	TestTrue(TEXT("Out of date cooks can be discarded"), OtherHAC->CanDiscardOutOfDateCook());
+
+	OtherHAC->RemoveFromRoot();
+	HAC->RemoveFromRoot();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestCookStats, "Houdini.Runtime.CookStats", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestCookStats::RunTest(const FString & Parameters)
+{
+	// Phase times are exclusive, and bytes are only recorded inside a stats scope
+	FHoudiniCookStats Stats;
+	FHoudiniCookStats::AddBytesSent(100);
+	{
+		FHoudiniCookStatsScope StatsScope(&Stats);
+		FHoudiniCookStatsPhaseScope UpdateScope(EHoudiniCookStatsPhase::ComponentUpdate);
+		{
+			FHoudiniCookStatsPhaseScope MeshScope(EHoudiniCookStatsPhase::MeshBuild);
+			FPlatformProcess::Sleep(0.02f);
+			FHoudiniCookStats::AddBytesReceived(64);
+			FHoudiniCookStats::AddAttributeLookupRoundTrips(3);
+		}
+		{
+			FHoudiniCookStatsPhaseScope InputScope(EHoudiniCookStatsPhase::InputUpload, TEXT("Geometry"));
+			FHoudiniCookStats::AddBytesSent(32);
+		}
+	}
+	FHoudiniCookStats::AddBytesSent(100);
+
+	TestEqual(TEXT("Bytes sent"), Stats.BytesSent, (int64)32);
+	TestEqual(TEXT("Bytes received"), Stats.BytesReceived, (int64)64);
+	TestEqual(TEXT("Attribute lookups"), Stats.AttributeLookupRoundTrips, (int64)3);
+	TestTrue(TEXT("Mesh build time"), Stats.GetPhaseTime(EHoudiniCookStatsPhase::MeshBuild) >= 0.015);
+	TestTrue(TEXT("Nested phase is excluded from its parent"),
+		Stats.GetPhaseTime(EHoudiniCookStatsPhase::ComponentUpdate) < Stats.GetPhaseTime(EHoudiniCookStatsPhase::MeshBuild));
+	TestTrue(TEXT("Input upload time by type"), Stats.InputUploadTimes.Contains(TEXT("Geometry")));
+
+	// Worker threads scoping the cook's stats all record into them
+	FHoudiniCookStats WorkerStats;
+	ParallelFor(64, [&WorkerStats](int32 Index)
+	{
+		FHoudiniCookStatsScope StatsScope(&WorkerStats);
+		FHoudiniCookStats::AddBytesSent(Index + 1);
+		FHoudiniCookStats::AddBytesReceived(2);
+		FHoudiniCookStats::RecordScratchMemoryUsed(Index * 10);
+	});
+	TestEqual(TEXT("Bytes sent by workers"), WorkerStats.BytesSent, (int64)(64 * 65 / 2));
+	TestEqual(TEXT("Bytes received by workers"), WorkerStats.BytesReceived, (int64)128);
+	TestEqual(TEXT("Peak scratch memory of workers"), WorkerStats.ScratchMemoryUsed, (int64)630);
+
+	// The history keeps the most recent cooks
+	FHoudiniCookStatsHistory History(3);
+	for (int32 Idx = 0; Idx < 5; Idx++)
+	{
+		FHoudiniCookStats CookStats;
+		CookStats.BytesSent = Idx;
+		History.Add(CookStats);
+	}
+	TestEqual(TEXT("History size"), History.Num(), 3);
+	TestEqual(TEXT("Most recent cook"), History.Get(0).BytesSent, (int64)4);
+	TestEqual(TEXT("Oldest cook"), History.Get(2).BytesSent, (int64)2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestStaticMeshWelding, "Houdini.Runtime.StaticMeshWelding", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestStaticMeshWelding::RunTest(const FString & Parameters)
+{
+	// A grid of quads whose triangles share smooth vertices, stored per vertex instance like the translator does
+	const int32 GridSize = 64;
+	const int32 NumGridVertices = (GridSize + 1) * (GridSize + 1);
+	const int32 NumTriangles = GridSize * GridSize * 2;
+
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>();
+	Mesh->Initialize(NumGridVertices, NumTriangles, 1, 0, true, false, true, false);
+	for (int32 Y = 0; Y <= GridSize; Y++)
+	{
+		for (int32 X = 0; X <= GridSize; X++)
+			Mesh->SetVertexPosition(Y * (GridSize + 1) + X, FVector3f(X, Y, 0));
+	}
+
+	int32 TriangleIdx = 0;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			const int32 V0 = Y * (GridSize + 1) + X;
+			const int32 V1 = V0 + 1;
+			const int32 V2 = V0 + GridSize + 1;
+			const int32 V3 = V2 + 1;
+			for (const FIntVector& Triangle : { FIntVector(V0, V2, V1), FIntVector(V1, V2, V3) })
+			{
+				Mesh->SetTriangleVertexIndices(TriangleIdx, Triangle);
+				for (uint8 TriVertIdx = 0; TriVertIdx < 3; TriVertIdx++)
+				{
+					const FVector3f Position = Mesh->GetVertexPositions()[Triangle[TriVertIdx]];
+					Mesh->SetTriangleVertexNormal(TriangleIdx, TriVertIdx, FVector3f(0, 0, 1));
+					Mesh->SetTriangleVertexColor(TriangleIdx, TriVertIdx, FColor::White);
+					Mesh->SetTriangleVertexUV(TriangleIdx, TriVertIdx, 0, FVector2f(Position.X, Position.Y) / GridSize);
+				}
+				TriangleIdx++;
+			}
+		}
+	}
+
+	// A UV seam on a vertex shared by several triangles: that vertex instance must not be welded
+	Mesh->SetTriangleVertexUV(1, 0, 0, FVector2f(-1, -1));
+
+	Mesh->SetWeldVertices(true);
+	Mesh->Optimize();
+	TestFalse(TEXT("Welding is deferred to the proxy"), Mesh->HasWeldedVertices());
+	Mesh->EnsureWeldedVertices();
+
+	TestTrue(TEXT("Has welded vertices"), Mesh->HasWeldedVertices());
+	TestEqual(TEXT("Welded vertex count"), (int32)Mesh->GetNumWeldedVertices(), NumGridVertices + 1);
+
+	// Every vertex instance has the same position and attributes as the first instance of its welded vertex
+	const TArray<uint32>& WeldedIndices = Mesh->GetWeldedVertexIndices();
+	TArray<int32> FirstInstances;
+	FirstInstances.Init(INDEX_NONE, Mesh->GetNumWeldedVertices());
+	bool bAttributesMatch = true;
+	for (int32 InstanceIdx = 0; InstanceIdx < (int32)Mesh->GetNumVertexInstances(); InstanceIdx++)
+	{
+		int32& SourceIdx = FirstInstances[WeldedIndices[InstanceIdx]];
+		if (SourceIdx == INDEX_NONE)
+			SourceIdx = InstanceIdx;
+		bAttributesMatch &= Mesh->GetTriangleIndices()[InstanceIdx / 3][InstanceIdx % 3] == Mesh->GetTriangleIndices()[SourceIdx / 3][SourceIdx % 3];
+		bAttributesMatch &= Mesh->GetVertexInstanceUVs()[InstanceIdx] == Mesh->GetVertexInstanceUVs()[SourceIdx];
+		bAttributesMatch &= Mesh->GetVertexInstanceNormals()[InstanceIdx] == Mesh->GetVertexInstanceNormals()[SourceIdx];
+	}
+	TestTrue(TEXT("Welded attributes match"), bAttributesMatch);
+
+	// The optimized triangle order is a permutation, and has fewer misses in a FIFO cache than the row order
+	TArray<uint32> SortedOrder = Mesh->GetWeldedTriangleOrder();
+	SortedOrder.Sort();
+	bool bIsPermutation = SortedOrder.Num() == NumTriangles;
+	for (int32 Idx = 0; bIsPermutation && Idx < NumTriangles; Idx++)
+		bIsPermutation = SortedOrder[Idx] == (uint32)Idx;
+	TestTrue(TEXT("Triangle order is a permutation"), bIsPermutation);
+
+	auto GetCacheMissRatio = [&WeldedIndices, NumTriangles](const TArray<uint32>& InTriangleOrder)
+	{
+		const int32 CacheSize = 32;
+		TArray<uint32> Cache;
+		int32 NumMisses = 0;
+		for (const uint32 TriangleID : InTriangleOrder)
+		{
+			for (int32 TriVertIdx = 0; TriVertIdx < 3; TriVertIdx++)
+			{
+				const uint32 VertexIdx = WeldedIndices[TriangleID * 3 + TriVertIdx];
+				if (Cache.Contains(VertexIdx))
+					continue;
+				NumMisses++;
+				Cache.Add(VertexIdx);
+				if (Cache.Num() > CacheSize)
+					Cache.RemoveAt(0);
+			}
+		}
+		return (float)NumMisses / NumTriangles;
+	};
+
+	const float OptimizedMissRatio = GetCacheMissRatio(Mesh->GetWeldedTriangleOrder());
+	const float RowOrderMissRatio = GetCacheMissRatio(SortedOrder);
+	AddInfo(FString::Printf(TEXT("Average cache miss ratio: row order %.3f, optimized %.3f"), RowOrderMissRatio, OptimizedMissRatio));
+	TestTrue(TEXT("Optimized order has fewer cache misses"), OptimizedMissRatio < RowOrderMissRatio);
+
+	// Welding can be disabled, and is rebuilt with the data
+	Mesh->SetWeldVertices(false);
+	Mesh->Optimize();
+	Mesh->EnsureWeldedVertices();
+	TestFalse(TEXT("Welded vertices cleared"), Mesh->HasWeldedVertices());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestStaticMeshCompactSerialization, "Houdini.Runtime.StaticMeshCompactSerialization", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestStaticMeshCompactSerialization::RunTest(const FString & Parameters)
+{
+	// A mesh with random attributes, large enough to be split in several compressed chunks
+	const int32 NumVertices = 40000;
+	const int32 NumTriangles = 60000;
+	const int32 NumUVLayers = 2;
+	const float Extent = 5000.0f;
+
+	FRandomStream Random(1234);
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>();
+	Mesh->Initialize(NumVertices, NumTriangles, NumUVLayers, 0, true, true, true, true);
+	for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		Mesh->SetVertexPosition(VertIdx, FVector3f(Random.VRand()) * Random.FRandRange(0.0f, Extent));
+
+	for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+	{
+		Mesh->SetTriangleVertexIndices(TriIdx, FIntVector(Random.RandHelper(NumVertices), Random.RandHelper(NumVertices), Random.RandHelper(NumVertices)));
+		Mesh->SetTriangleMaterialID(TriIdx, Random.RandHelper(4));
+		for (uint8 TriVertIdx = 0; TriVertIdx < 3; TriVertIdx++)
+		{
+			Mesh->SetTriangleVertexNormal(TriIdx, TriVertIdx, FVector3f(Random.VRand()));
+			Mesh->SetTriangleVertexUTangent(TriIdx, TriVertIdx, FVector3f(Random.VRand()));
+			Mesh->SetTriangleVertexVTangent(TriIdx, TriVertIdx, FVector3f(Random.VRand()));
+			Mesh->SetTriangleVertexColor(TriIdx, TriVertIdx, FColor(Random.RandHelper(256), Random.RandHelper(256), Random.RandHelper(256), 255));
+			for (uint8 UVLayer = 0; UVLayer < NumUVLayers; UVLayer++)
+				Mesh->SetTriangleVertexUV(TriIdx, TriVertIdx, UVLayer, FVector2f(Random.FRandRange(-2.0f, 2.0f), Random.FRandRange(-2.0f, 2.0f)));
+		}
+	}
+
+	for (const bool bQuantizePositions : { false, true })
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Mesh->SerializeCompact(Writer, bQuantizePositions);
+
+		UHoudiniStaticMesh* Loaded = NewObject<UHoudiniStaticMesh>();
+		FMemoryReader Reader(Bytes);
+		Loaded->SerializeCompact(Reader);
+
+		const FString Suffix = bQuantizePositions ? TEXT(" (quantized positions)") : TEXT("");
+		AddInfo(FString::Printf(TEXT("Compact size%s: %d bytes"), *Suffix, Bytes.Num()));
+		TestFalse(TEXT("Read without errors") + Suffix, Reader.IsError());
+		if (Reader.IsError())
+			return false;
+
+		// Exact data
+		TestTrue(TEXT("Triangle indices") + Suffix, Loaded->GetTriangleIndices() == Mesh->GetTriangleIndices());
+		TestTrue(TEXT("Colors") + Suffix, Loaded->GetVertexInstanceColors() == Mesh->GetVertexInstanceColors());
+		TestTrue(TEXT("Material IDs") + Suffix, Loaded->GetMaterialIDsPerTriangle() == Mesh->GetMaterialIDsPerTriangle());
+
+		// Positions are exact, or within half a quantization step of the bounds
+		const FVector3f MaxPositionError = bQuantizePositions ? FVector3f(Mesh->CalcBounds().GetSize()) / 65535.0f * 0.5f + 1e-3f : FVector3f::ZeroVector;
+		bool bPositionsInBounds = Loaded->GetNumVertices() == Mesh->GetNumVertices();
+		for (int32 VertIdx = 0; bPositionsInBounds && VertIdx < NumVertices; VertIdx++)
+		{
+			const FVector3f Error = (Loaded->GetVertexPositions()[VertIdx] - Mesh->GetVertexPositions()[VertIdx]).GetAbs();
+			bPositionsInBounds = Error.X <= MaxPositionError.X && Error.Y <= MaxPositionError.Y && Error.Z <= MaxPositionError.Z;
+		}
+		TestTrue(TEXT("Position error") + Suffix, bPositionsInBounds);
+
+		// Octahedral directions are within 0.01 degree
+		const float MinDirectionDot = FMath::Cos(FMath::DegreesToRadians(0.01f));
+		auto TestDirections = [&](const TCHAR* InName, const TArray<FVector3f>& InExpected, const TArray<FVector3f>& InLoaded)
+		{
+			bool bInBounds = InExpected.Num() == InLoaded.Num();
+			for (int32 Idx = 0; bInBounds && Idx < InExpected.Num(); Idx++)
+				bInBounds = FVector3f::DotProduct(InExpected[Idx], InLoaded[Idx]) >= MinDirectionDot;
+			TestTrue(FString(InName) + Suffix, bInBounds);
+		};
+		TestDirections(TEXT("Normal error"), Mesh->GetVertexInstanceNormals(), Loaded->GetVertexInstanceNormals());
+		TestDirections(TEXT("U tangent error"), Mesh->GetVertexInstanceUTangents(), Loaded->GetVertexInstanceUTangents());
+		TestDirections(TEXT("V tangent error"), Mesh->GetVertexInstanceVTangents(), Loaded->GetVertexInstanceVTangents());
+
+		// Half float UVs have an 11 bit mantissa
+		bool bUVsInBounds = Loaded->GetVertexInstanceUVs().Num() == Mesh->GetVertexInstanceUVs().Num();
+		for (int32 Idx = 0; bUVsInBounds && Idx < Mesh->GetVertexInstanceUVs().Num(); Idx++)
+		{
+			const FVector2f Expected = Mesh->GetVertexInstanceUVs()[Idx];
+			const FVector2f Error = (Loaded->GetVertexInstanceUVs()[Idx] - Expected).GetAbs();
+			bUVsInBounds = Error.X <= FMath::Max(FMath::Abs(Expected.X), 1.0f) / 2048.0f
+				&& Error.Y <= FMath::Max(FMath::Abs(Expected.Y), 1.0f) / 2048.0f;
+		}
+		TestTrue(TEXT("UV error") + Suffix, bUVsInBounds);
+	}
+
+	// Round trip through Serialize(): persistent archives are compact, the others are lossless
+	for (const bool bPersistent : { true, false })
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes, bPersistent);
+		FObjectAndNameAsStringProxyArchive WriterProxy(Writer, false);
+		Mesh->Serialize(WriterProxy);
+		TestEqual(TEXT("Custom version recorded"),
+			WriterProxy.CustomVer(FHoudiniCustomSerializationVersion::GUID), (int32)VER_HOUDINI_PLUGIN_SERIALIZATION_AUTOMATIC_VERSION);
+
+		UHoudiniStaticMesh* Loaded = NewObject<UHoudiniStaticMesh>();
+		FMemoryReader Reader(Bytes, bPersistent);
+		Reader.SetCustomVersions(WriterProxy.GetCustomVersions());
+		FObjectAndNameAsStringProxyArchive ReaderProxy(Reader, false);
+		Loaded->Serialize(ReaderProxy);
+
+		const FString Suffix = bPersistent ? TEXT(" (persistent)") : TEXT(" (transient)");
+		AddInfo(FString::Printf(TEXT("Serialized size%s: %d bytes"), *Suffix, Bytes.Num()));
+		TestFalse(TEXT("Serialize read without errors") + Suffix, Reader.IsError());
+		TestEqual(TEXT("Whole archive read") + Suffix, Reader.Tell(), (int64)Bytes.Num());
+		TestTrue(TEXT("Serialize triangle indices") + Suffix, Loaded->GetTriangleIndices() == Mesh->GetTriangleIndices());
+		TestTrue(TEXT("Serialize positions") + Suffix, Loaded->GetVertexPositions() == Mesh->GetVertexPositions());
+
+		// Only the compact format alters the normals
+		TestEqual(TEXT("Serialize normals are lossless") + Suffix,
+			Loaded->GetVertexInstanceNormals() == Mesh->GetVertexInstanceNormals(), !bPersistent);
+	}
+
+	return true;
+}
+
+// Scalar Ritter sphere, as computed by the mesh translator before the bounds reductions were vectorized
+static FSphere
+HoudiniRuntimeTests_ScalarRitterSphere(const TArray<FVector>& InPoints)
+{
+	FBox Box;
+	FVector MinIx[3], MaxIx[3];
+	for (int32 Idx = 0; Idx < InPoints.Num(); Idx++)
+	{
+		const FVector& p = InPoints[Idx];
+		if (Idx == 0)
+		{
+			Box.Min = Box.Max = p;
+			MinIx[0] = MinIx[1] = MinIx[2] = MaxIx[0] = MaxIx[1] = MaxIx[2] = p;
+			continue;
+		}
+
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			if (p[Axis] < Box.Min[Axis]) { Box.Min[Axis] = p[Axis]; MinIx[Axis] = p; }
+			else if (p[Axis] > Box.Max[Axis]) { Box.Max[Axis] = p[Axis]; MaxIx[Axis] = p; }
+		}
+	}
+
+	const FVector Extremes[3] = { MaxIx[0] - MinIx[0], MaxIx[1] - MinIx[1], MaxIx[2] - MinIx[2] };
+
+	FSphere Sphere(InPoints[0], 0.0);
+	float d2 = 0.f;
+	for (int32 i = 0; i < 3; i++)
+	{
+		const float tmpd2 = Extremes[i].SizeSquared();
+		if (tmpd2 > d2)
+		{
+			d2 = tmpd2;
+			Sphere.Center = MinIx[i] + (0.5f * Extremes[i]);
+		}
+	}
+
+	float r = 0.5f * FVector(Extremes[0].X, Extremes[1].Y, Extremes[2].Z).GetMax();
+	float r2 = FMath::Square(r);
+	for (const FVector& Point : InPoints)
+	{
+		const FVector cToP = Point - Sphere.Center;
+		const float pr2 = cToP.SizeSquared();
+		if (pr2 > r2)
+		{
+			const float pr = FMath::Sqrt(pr2);
+			r = 0.5f * (r + pr);
+			r2 = FMath::Square(r);
+			Sphere.Center += ((pr - r) / pr * cToP);
+		}
+	}
+
+	Sphere.W = r;
+	return Sphere;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestBoundsUtils, "Houdini.Runtime.BoundsUtils", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeTestBoundsUtils::RunTest(const FString & Parameters)
+{
+	const FVector Directions[] = {
+		FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1),
+		FVector(0.7071, 0.7071, 0), FVector(0.7071, -0.7071, 0), FVector(-0.7071, 0.7071, 0), FVector(-0.7071, -0.7071, 0),
+		FVector(0.5774, 0.5774, 0.5774), FVector(-0.5774, -0.5774, -0.5774) };
+	const int32 NumDirections = UE_ARRAY_COUNT(Directions);
+
+	// Small sets (single chunk, remainders of the four points blocks) and a set reduced in parallel chunks
+	FRandomStream RandomStream(2024);
+	for (const int32 NumPoints : { 1, 3, 7, 1000, FHoudiniBoundsUtils::ParallelChunkSize * 3 + 5 })
+	{
+		TArray<FVector> Points;
+		TArray<FVector3f> Points3f;
+		for (int32 Idx = 0; Idx < NumPoints; Idx++)
+		{
+			const FVector Point(
+				RandomStream.FRandRange(-500.0f, 1500.0f), RandomStream.FRandRange(-20.0f, 20.0f), RandomStream.FRandRange(0.0f, 300.0f));
+			Points.Add(Point);
+			Points3f.Add(FVector3f(Point));
+		}
+
+		// Boxes: exact
+		FBox ScalarBox(ForceInit);
+		for (const FVector& Point : Points)
+			ScalarBox += Point;
+		TestTrue(FString::Printf(TEXT("%d points: box"), NumPoints), FHoudiniBoundsUtils::CalcBox(Points.GetData(), NumPoints) == ScalarBox);
+
+		FBox ScalarBox3f(ForceInit);
+		for (const FVector3f& Point : Points3f)
+			ScalarBox3f += FVector(Point);
+		TestTrue(FString::Printf(TEXT("%d points: float box"), NumPoints), FHoudiniBoundsUtils::CalcBox(Points3f.GetData(), NumPoints) == ScalarBox3f);
+
+		// Extreme points: first point reaching the min / max on each axis
+		int32 MinIndices[3], MaxIndices[3];
+		FHoudiniBoundsUtils::CalcExtremePoints(Points.GetData(), NumPoints, MinIndices, MaxIndices);
+		bool bExtremesMatch = true;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const int32 ScalarMin = Points.IndexOfByPredicate([&](const FVector& P) { return P[Axis] == ScalarBox.Min[Axis]; });
+			const int32 ScalarMax = Points.IndexOfByPredicate([&](const FVector& P) { return P[Axis] == ScalarBox.Max[Axis]; });
+			bExtremesMatch &= MinIndices[Axis] == ScalarMin && MaxIndices[Axis] == ScalarMax;
+		}
+		TestTrue(FString::Printf(TEXT("%d points: extreme points"), NumPoints), bExtremesMatch);
+
+		// k-DOP slab extents
+		double SlabExtents[UE_ARRAY_COUNT(Directions)];
+		FHoudiniBoundsUtils::CalcSlabExtents(Points.GetData(), NumPoints, Directions, NumDirections, SlabExtents);
+		bool bSlabsMatch = true;
+		for (int32 DirIdx = 0; DirIdx < NumDirections; DirIdx++)
+		{
+			double ScalarExtent = TNumericLimits<double>::Lowest();
+			for (const FVector& Point : Points)
+				ScalarExtent = FMath::Max(ScalarExtent, Point | Directions[DirIdx]);
+			bSlabsMatch &= FMath::IsNearlyEqual(SlabExtents[DirIdx], ScalarExtent, 1.e-9);
+		}
+		TestTrue(FString::Printf(TEXT("%d points: k-DOP slab extents"), NumPoints), bSlabsMatch);
+
+		// Distance to the furthest point
+		const FVector Center = ScalarBox.GetCenter();
+		double ScalarMaxDistSquared = 0.0;
+		for (const FVector& Point : Points)
+			ScalarMaxDistSquared = FMath::Max(ScalarMaxDistSquared, FVector::DistSquared(Point, Center));
+		TestTrue(
+			FString::Printf(TEXT("%d points: max distance"), NumPoints),
+			FMath::IsNearlyEqual(FHoudiniBoundsUtils::CalcMaxDistSquared(Points.GetData(), NumPoints, Center), ScalarMaxDistSquared, ScalarMaxDistSquared * 1.e-12));
+
+		// Ritter sphere: same result as the scalar algorithm, and contains all the points
+		const FSphere Sphere = FHoudiniBoundsUtils::CalcRitterSphere(Points.GetData(), NumPoints);
+		const FSphere ScalarSphere = HoudiniRuntimeTests_ScalarRitterSphere(Points);
+		TestTrue(
+			FString::Printf(TEXT("%d points: Ritter sphere"), NumPoints),
+			Sphere.Center.Equals(ScalarSphere.Center, 1.e-6) && FMath::IsNearlyEqual(Sphere.W, ScalarSphere.W, 1.e-6));
+
+		bool bContainsAll = true;
+		for (const FVector& Point : Points)
+			bContainsAll &= FVector::Dist(Point, Sphere.Center) <= Sphere.W * (1.0 + 1.e-4) + 1.e-3;
+		TestTrue(FString::Printf(TEXT("%d points: Ritter sphere contains the points"), NumPoints), bContainsAll);
+
+		// Determinism: the reductions do not depend on the scheduling of the parallel chunks
+		TestTrue(FString::Printf(TEXT("%d points: deterministic box"), NumPoints),
+			FHoudiniBoundsUtils::CalcBox(Points.GetData(), NumPoints) == FHoudiniBoundsUtils::CalcBox(Points.GetData(), NumPoints));
+		const FSphere SecondSphere = FHoudiniBoundsUtils::CalcRitterSphere(Points.GetData(), NumPoints);
+		TestTrue(FString::Printf(TEXT("%d points: deterministic sphere"), NumPoints),
+			SecondSphere.Center == Sphere.Center && SecondSphere.W == Sphere.W);
+	}
+
+	return true;
+}
+
 #endif
\ No newline at end of file
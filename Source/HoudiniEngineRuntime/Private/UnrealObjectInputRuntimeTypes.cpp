@@ -37,6 +37,7 @@
 #include "Misc/Paths.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniInputObject.h"
 #include "HoudiniInputTypes.h"
 #include "UnrealObjectInputManager.h"
@@ -482,6 +483,7 @@ FUnrealObjectInputIdentifier::FUnrealObjectInputIdentifier()
 	, Path(NAME_None)
 	, Options()
 	, NodeType(EUnrealObjectInputNodeType::Invalid)
+	, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
 {
 }
 
@@ -490,6 +492,7 @@ FUnrealObjectInputIdentifier::FUnrealObjectInputIdentifier(UObject const* const
 	, Path(NAME_None)
 	, Options(InOptions)
 	, NodeType(bIsLeaf ? EUnrealObjectInputNodeType::Leaf : EUnrealObjectInputNodeType::Reference)
+	, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
 {
 }
 
@@ -498,6 +501,7 @@ FUnrealObjectInputIdentifier::FUnrealObjectInputIdentifier(UObject const* const
 	, Path(NAME_None)
 	, Options()
 	, NodeType(EUnrealObjectInputNodeType::Container)
+	, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
 {
 }
 
@@ -506,6 +510,7 @@ FUnrealObjectInputIdentifier::FUnrealObjectInputIdentifier(UPackage const* const
 	, Path(::IsValid(InPackage) ? FName(InPackage->GetPathName()) : NAME_None)
 	, Options()
 	, NodeType(EUnrealObjectInputNodeType::Container)
+	, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
 {
 }
 
@@ -514,6 +519,7 @@ FUnrealObjectInputIdentifier::FUnrealObjectInputIdentifier(const FName& InPath)
 	, Path(InPath)
 	, Options()
 	, NodeType(EUnrealObjectInputNodeType::Container)
+	, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
 {
 }
 
@@ -548,6 +554,7 @@ FUnrealObjectInputIdentifier::Reset()
 	Path = NAME_None;
 	Options = FUnrealObjectInputOptions();
 	NodeType = EUnrealObjectInputNodeType::Invalid;
+	SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 }
 
 uint32
@@ -568,14 +575,14 @@ FUnrealObjectInputIdentifier::GetTypeHash() const
 			//return FName::GetTypeHash(ObjectPath);
 			//return ::GetTypeHash(ObjectPath.GetComparisonIndex()) + ObjectPath.GetNumber();
 			const TPair<FName, FUnrealObjectInputOptions> Pair(ObjectPath, Options);
-			return ::GetTypeHash(Pair);
+			return HashCombine(::GetTypeHash(Pair), ::GetTypeHash(SessionIndex));
 		}
 
 		case EUnrealObjectInputNodeType::Reference:
 		case EUnrealObjectInputNodeType::Leaf:
 		{
 			const TPair<FName, FUnrealObjectInputOptions> Pair(ObjectPath, Options);
-			return ::GetTypeHash(Pair);
+			return HashCombine(::GetTypeHash(Pair), ::GetTypeHash(SessionIndex));
 		}
 	}
 
@@ -597,6 +604,10 @@ FUnrealObjectInputIdentifier::operator==(const FUnrealObjectInputIdentifier& InO
 	if (NodeType == EUnrealObjectInputNodeType::Invalid)
 		return true;
 
+	// Nodes from different sessions are different nodes
+	if (SessionIndex != InOther.SessionIndex)
+		return false;
+
 	if (NodeType == EUnrealObjectInputNodeType::Leaf || NodeType == EUnrealObjectInputNodeType::Reference)
 		return Object == InOther.Object && Options == InOther.Options;
 
@@ -638,6 +649,8 @@ FUnrealObjectInputIdentifier::MakeParentIdentifier(FUnrealObjectInputIdentifier&
 			ParentIdentifier = FUnrealObjectInputIdentifier(ParentPath);
 		}
 
+		// The parent lives in the same session
+		ParentIdentifier.SessionIndex = SessionIndex;
 		if (ParentIdentifier.IsValid())
 		{
 			OutParentIdentifier = ParentIdentifier;
@@ -647,8 +660,9 @@ FUnrealObjectInputIdentifier::MakeParentIdentifier(FUnrealObjectInputIdentifier&
 		return false;
 	}
 
-	const FUnrealObjectInputIdentifier ParentIdentifier = FUnrealObjectInputIdentifier(
+	FUnrealObjectInputIdentifier ParentIdentifier = FUnrealObjectInputIdentifier(
 		FName(FPaths::GetPath(Path.ToString())));
+	ParentIdentifier.SessionIndex = SessionIndex;
 	if (ParentIdentifier.IsValid())
 	{
 		OutParentIdentifier = ParentIdentifier;
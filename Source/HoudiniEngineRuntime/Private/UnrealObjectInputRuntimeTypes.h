@@ -337,6 +337,9 @@ public:
 	/** Gets the Options that forms part of this identifier. */
 	const FUnrealObjectInputOptions& GetOptions() const { return Options; }
 
+	/** Gets the index of the Houdini Engine session the identified node lives in. */
+	int32 GetSessionIndex() const { return SessionIndex; }
+
 private:
 	/** The object this identifier is associated with. */
 	TWeakObjectPtr<const UObject> Object;
@@ -349,6 +352,12 @@ private:
 
 	/** The type of node this identifier represents. */
 	EUnrealObjectInputNodeType NodeType;
+
+	/**
+	 * The session the node lives in: node ids are only valid in the session that created them, so each session has
+	 * its own nodes for the same object. Set to the calling thread's current session on construction.
+	 */
+	int32 SessionIndex;
 };
 
 /** Function used by hashing containers to create a unique hash for this type of object. */
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "UObject/Object.h"
+#include "Async/MappedFileHandle.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "HoudiniAsset.generated.h"
 
@@ -48,6 +49,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// UOBject functions
 		virtual void FinishDestroy() override;
 		virtual void Serialize(FArchive & Ar) override;
+		virtual void PostLoad() override;
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
 		virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
 #endif
@@ -65,6 +67,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Return the size in bytes of raw Houdini OTL data.
 		uint32 GetAssetBytesCount() const;
 
+		// Return the SHA1 hash of the raw Houdini OTL data, empty if the asset has no data.
+		const FString& GetAssetBytesHash() const;
+
+		// Return true if the raw Houdini OTL data is memory-mapped from the HDA cache instead of kept in memory.
+		bool IsAssetBytesMemoryMapped() const;
+
 		// Return true if this asset is a limited commercial asset.
 		bool IsAssetLimitedCommercial() const;
 
@@ -84,6 +92,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Used to load old (version1) versions of HoudiniAssets
 		void SerializeLegacy(FArchive & Ar);
 
+		// Updates the hash of the raw data and, for large HDAs, replaces the raw data by a memory-mapped copy.
+		void UpdateAssetBytesStorage();
+
+		// Memory-maps the raw data from the HDA cache, writing the cache file first if needed.
+		bool MapAssetBytes();
+
+		// Releases the memory-mapped raw data, it must have been replaced by new data.
+		void UnmapAssetBytes();
+
 	public:
 
 		// Source filename of the OTL.
@@ -121,4 +138,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Indicates if this is an expanded HDA file
 		UPROPERTY()
 		bool bAssetExpanded;
+
+		// SHA1 hash of the raw HDA data.
+		FString AssetBytesHash;
+
+		// Memory-mapped raw HDA data, used instead of AssetBytes for large HDAs.
+		TUniquePtr<IMappedFileHandle> MappedAssetFile;
+		TUniquePtr<IMappedFileRegion> MappedAssetBytes;
 };
\ No newline at end of file